@@ -0,0 +1,14 @@
+#pragma once
+#include <stdint.h>
+
+// Scripted value sweep through the real update path (main.cpp), run from
+// /bench on the board and from the host render harness (test/test_render_harness)
+typedef struct {
+  uint32_t frames;
+  uint32_t avg_us, max_us;      // Refresh time, render + flush
+  uint32_t busy_frames;         // Frames that flushed anything
+  uint32_t avg_px;              // Pixels rendered and flushed per frame
+  float avg_inv, avg_flush;     // Invalidated areas and flushes per frame
+} bench_summary_t;
+
+bench_summary_t run_render_bench();
@@ -0,0 +1,82 @@
+#include "Arc_Fill.h"
+
+// Steps covered by the whole-degree rounding of the arc end, plus one
+#define ROUND_STEPS (NEEDLE_LUT_STEPS / 270 + 1)
+
+static int32_t end_angle(const arc_fill_t *af, uint16_t idx) {
+  return (int32_t)(af->start_deg + af->range_deg * idx / NEEDLE_LUT_STEPS + 0.5f);
+}
+
+// Boxes over the band between steps a and b; each spans at most ARC_INV_STEPS,
+// so the arc's bulge past the chord stays under the 2 px padding
+static void invalidate_wedge(arc_fill_t *af, int32_t a, int32_t b) {
+  if (a > b) { int32_t t = a; a = b; b = t; }
+  a = LV_MAX(a - ROUND_STEPS, 0);
+  b = LV_MIN(b + ROUND_STEPS, NEEDLE_LUT_STEPS);
+  for (int32_t k = a; k < b; k += ARC_INV_STEPS) {
+    int32_t e = LV_MIN(k + ARC_INV_STEPS, b);
+    int32_t x[4], y[4];
+    needle_lut_point(k, af->r_in, &x[0], &y[0]);
+    needle_lut_point(k, af->r_out, &x[1], &y[1]);
+    needle_lut_point(e, af->r_in, &x[2], &y[2]);
+    needle_lut_point(e, af->r_out, &x[3], &y[3]);
+    lv_area_t box = { x[0], y[0], x[0], y[0] };
+    for (int i = 1; i < 4; i++) {
+      box.x1 = LV_MIN(box.x1, x[i]); box.y1 = LV_MIN(box.y1, y[i]);
+      box.x2 = LV_MAX(box.x2, x[i]); box.y2 = LV_MAX(box.y2, y[i]);
+    }
+    box.x1 -= 2; box.y1 -= 2; box.x2 += 2; box.y2 += 2;
+    lv_obj_invalidate_area(af->obj, &box);
+  }
+}
+
+static void arc_draw_cb(lv_event_t *e) {
+  arc_fill_t *af = (arc_fill_t *)lv_event_get_user_data(e);
+  int32_t end = end_angle(af, af->idx);
+  int32_t start = (int32_t)(af->start_deg + 0.5f);
+  if (end <= start) return;
+  lv_layer_t *layer = lv_event_get_layer(e);
+  lv_area_t coords;
+  lv_obj_get_coords(af->obj, &coords);
+
+  lv_draw_arc_dsc_t dsc;
+  lv_draw_arc_dsc_init(&dsc);
+  dsc.color = af->color;
+  dsc.width = af->r_out - af->r_in;
+  dsc.radius = af->r_out;
+  dsc.center.x = coords.x1 + af->cx;
+  dsc.center.y = coords.y1 + af->cy;
+  dsc.start_angle = start;
+  dsc.end_angle = end;
+  lv_draw_arc(layer, &dsc);  // SW arc masks work per clipped area: cost follows the wedge
+}
+
+lv_obj_t *arc_fill_create(lv_obj_t *parent, arc_fill_t *af, int cx, int cy, int r_in, int r_out,
+                          float angle_start_deg, float angle_range_deg, lv_color_t color) {
+  af->cx = cx; af->cy = cy;
+  af->r_in = r_in; af->r_out = r_out;
+  af->start_deg = angle_start_deg; af->range_deg = angle_range_deg;
+  af->idx = 0;
+  af->color = color;
+  // Full-parent transparent object, like the needle layer: LUT points are in its coordinates
+  af->obj = lv_obj_create(parent);
+  lv_obj_remove_style_all(af->obj);
+  lv_obj_set_size(af->obj, lv_pct(100), lv_pct(100));
+  lv_obj_set_pos(af->obj, 0, 0);
+  lv_obj_clear_flag(af->obj, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_add_event_cb(af->obj, arc_draw_cb, LV_EVENT_DRAW_MAIN, af);
+  return af->obj;
+}
+
+void arc_fill_set(arc_fill_t *af, uint16_t idx) {
+  if (idx > NEEDLE_LUT_STEPS) idx = NEEDLE_LUT_STEPS;
+  if (idx == af->idx) return;
+  if (end_angle(af, idx) != end_angle(af, af->idx)) invalidate_wedge(af, af->idx, idx);
+  af->idx = idx;
+}
+
+void arc_fill_set_color(arc_fill_t *af, lv_color_t color) {
+  if (lv_color_eq(color, af->color)) return;
+  af->color = color;
+  if (af->idx) invalidate_wedge(af, 0, af->idx);
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include <lvgl.h>
+#include "Needle_LUT.h"
+
+// Filled arc from the start of the needle sweep to the current Needle_LUT
+// step. A move only invalidates the wedge between the old and new step, cut
+// into boxes of at most ARC_INV_STEPS steps taken from the LUT's directions,
+// so the cost follows how far the value moved rather than the arc length.
+// The arc is drawn with whole-degree ends (LVGL without float); the rounding
+// stays under the needle, and the wedge is widened by it.
+#define ARC_INV_STEPS 32     // ~8 deg per box at 1024 steps over 270 deg
+
+typedef struct {
+  lv_obj_t *obj;
+  int32_t cx, cy, r_in, r_out;   // Screen coordinates, same centre as the LUT
+  float start_deg, range_deg;    // As passed to needle_lut_init
+  uint16_t idx;                  // Step drawn, 0 = empty
+  lv_color_t color;
+} arc_fill_t;
+
+lv_obj_t *arc_fill_create(lv_obj_t *parent, arc_fill_t *af, int cx, int cy, int r_in, int r_out,
+                          float angle_start_deg, float angle_range_deg, lv_color_t color);
+void arc_fill_set(arc_fill_t *af, uint16_t idx);          // Invalidates the changed wedge only
+void arc_fill_set_color(arc_fill_t *af, lv_color_t color); // Invalidates the filled span
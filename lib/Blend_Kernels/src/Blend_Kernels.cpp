@@ -0,0 +1,165 @@
+#include "Blend_Kernels.h"
+#include <string.h>
+
+bool blend_kernels_enabled = true;
+
+// G in the top half, R and B in the bottom: each field gets headroom for a 5-bit weight
+#define SPREAD_MASK 0x07E0F81Fu
+
+static inline uint32_t spread(uint16_t c) { return (c | ((uint32_t)c << 16)) & SPREAD_MASK; }
+
+// lv_color_16_16_mix with the foreground pre-spread; exact for every mix incl. 0 and 255
+static inline uint16_t mix_spread(uint32_t fg, uint16_t bg, uint8_t mix) {
+  uint32_t m = ((uint32_t)mix + 4) >> 3;
+  uint32_t b = spread(bg);
+  uint32_t r = ((((fg - b) * m) >> 5) + b) & SPREAD_MASK;
+  return (uint16_t)((r >> 16) | r);
+}
+
+static inline uint16_t mix565(uint16_t fg, uint16_t bg, uint8_t mix) { return mix_spread(spread(fg), bg, mix); }
+
+// Unaligned-safe word access; compiles to single loads/stores where allowed
+static inline uint32_t load32(const void *p) { uint32_t v; memcpy(&v, p, 4); return v; }
+static inline void store32(void *p, uint32_t v) { memcpy(p, &v, 4); }
+
+#define ROW(ptr, stride, y) ((uint16_t *)((uint8_t *)(ptr) + (y) * (stride)))
+#define CROW(ptr, stride, y) ((const uint16_t *)((const uint8_t *)(ptr) + (y) * (stride)))
+
+void blend_fill_rgb565(uint16_t *dst, int32_t w, int32_t h, int32_t dst_stride, uint16_t color) {
+  uint32_t pair = color | ((uint32_t)color << 16);
+  for (int32_t y = 0; y < h; y++) {
+    uint16_t *d = ROW(dst, dst_stride, y);
+    int32_t x = 0;
+    if (((uintptr_t)d & 2) && w > 0) d[x++] = color;   // Word-align the stores
+    for (; x + 8 <= w; x += 8) {
+      store32(d + x, pair); store32(d + x + 2, pair);
+      store32(d + x + 4, pair); store32(d + x + 6, pair);
+    }
+    for (; x + 2 <= w; x += 2) store32(d + x, pair);
+    if (x < w) d[x] = color;
+  }
+}
+
+void blend_fill_opa_rgb565(uint16_t *dst, int32_t w, int32_t h, int32_t dst_stride, uint16_t color, uint8_t opa) {
+  uint32_t fg = spread(color);
+  // Flat backgrounds repeat the same destination pair; reuse the last result
+  uint32_t last_in = 0;
+  uint32_t last_out = mix_spread(fg, 0, opa) | ((uint32_t)mix_spread(fg, 0, opa) << 16);
+  for (int32_t y = 0; y < h; y++) {
+    uint16_t *d = ROW(dst, dst_stride, y);
+    int32_t x = 0;
+    if (((uintptr_t)d & 2) && w > 0) { d[0] = mix_spread(fg, d[0], opa); x = 1; }
+    for (; x + 2 <= w; x += 2) {
+      uint32_t in = load32(d + x);
+      if (in != last_in) {
+        last_in = in;
+        last_out = mix_spread(fg, (uint16_t)in, opa) | ((uint32_t)mix_spread(fg, (uint16_t)(in >> 16), opa) << 16);
+      }
+      store32(d + x, last_out);
+    }
+    if (x < w) d[x] = mix_spread(fg, d[x], opa);
+  }
+}
+
+void blend_fill_mask_rgb565(uint16_t *dst, int32_t w, int32_t h, int32_t dst_stride, uint16_t color,
+                            const uint8_t *mask, int32_t mask_stride) {
+  uint32_t fg = spread(color);
+  uint32_t pair = color | ((uint32_t)color << 16);
+  for (int32_t y = 0; y < h; y++) {
+    uint16_t *d = ROW(dst, dst_stride, y);
+    const uint8_t *m = mask + y * mask_stride;
+    int32_t x = 0;
+    for (; x + 4 <= w; x += 4) {
+      uint32_t m4 = load32(m + x);
+      if (m4 == 0) continue;                                              // Outside the shape
+      if (m4 == 0xFFFFFFFFu) { store32(d + x, pair); store32(d + x + 2, pair); continue; }  // Inside
+      for (int k = 0; k < 4; k++)
+        if (m[x + k]) d[x + k] = mix_spread(fg, d[x + k], m[x + k]);      // Edge
+    }
+    for (; x < w; x++)
+      if (m[x]) d[x] = mix_spread(fg, d[x], m[x]);
+  }
+}
+
+void blend_fill_mask_opa_rgb565(uint16_t *dst, int32_t w, int32_t h, int32_t dst_stride, uint16_t color,
+                                const uint8_t *mask, int32_t mask_stride, uint8_t opa) {
+  uint32_t fg = spread(color);
+  for (int32_t y = 0; y < h; y++) {
+    uint16_t *d = ROW(dst, dst_stride, y);
+    const uint8_t *m = mask + y * mask_stride;
+    int32_t x = 0;
+    for (; x + 4 <= w; x += 4) {
+      if (load32(m + x) == 0) continue;
+      for (int k = 0; k < 4; k++) {
+        uint8_t a = (uint8_t)(((uint32_t)m[x + k] * opa) >> 8);   // LV_OPA_MIX2
+        if (a) d[x + k] = mix_spread(fg, d[x + k], a);
+      }
+    }
+    for (; x < w; x++) {
+      uint8_t a = (uint8_t)(((uint32_t)m[x] * opa) >> 8);
+      if (a) d[x] = mix_spread(fg, d[x], a);
+    }
+  }
+}
+
+void blend_image_rgb565(uint16_t *dst, int32_t w, int32_t h, int32_t dst_stride,
+                        const uint16_t *src, int32_t src_stride) {
+  for (int32_t y = 0; y < h; y++) memcpy(ROW(dst, dst_stride, y), CROW(src, src_stride, y), w * 2);
+}
+
+void blend_image_opa_rgb565(uint16_t *dst, int32_t w, int32_t h, int32_t dst_stride,
+                            const uint16_t *src, int32_t src_stride, uint8_t opa) {
+  for (int32_t y = 0; y < h; y++) {
+    uint16_t *d = ROW(dst, dst_stride, y);
+    const uint16_t *s = CROW(src, src_stride, y);
+    int32_t x = 0;
+    for (; x + 2 <= w; x += 2) {
+      uint32_t sp = load32(s + x), dp = load32(d + x);
+      if (sp == dp) continue;                                  // Mixing equal colours is a no-op
+      store32(d + x, mix565((uint16_t)sp, (uint16_t)dp, opa) |
+                     ((uint32_t)mix565((uint16_t)(sp >> 16), (uint16_t)(dp >> 16), opa) << 16));
+    }
+    if (x < w) d[x] = mix565(s[x], d[x], opa);
+  }
+}
+
+void blend_image_mask_rgb565(uint16_t *dst, int32_t w, int32_t h, int32_t dst_stride,
+                             const uint16_t *src, int32_t src_stride, const uint8_t *mask, int32_t mask_stride) {
+  for (int32_t y = 0; y < h; y++) {
+    uint16_t *d = ROW(dst, dst_stride, y);
+    const uint16_t *s = CROW(src, src_stride, y);
+    const uint8_t *m = mask + y * mask_stride;
+    int32_t x = 0;
+    for (; x + 4 <= w; x += 4) {
+      uint32_t m4 = load32(m + x);
+      if (m4 == 0) continue;
+      if (m4 == 0xFFFFFFFFu) { memcpy(d + x, s + x, 8); continue; }
+      for (int k = 0; k < 4; k++)
+        if (m[x + k]) d[x + k] = mix565(s[x + k], d[x + k], m[x + k]);
+    }
+    for (; x < w; x++)
+      if (m[x]) d[x] = mix565(s[x], d[x], m[x]);
+  }
+}
+
+void blend_image_mask_opa_rgb565(uint16_t *dst, int32_t w, int32_t h, int32_t dst_stride,
+                                 const uint16_t *src, int32_t src_stride, const uint8_t *mask,
+                                 int32_t mask_stride, uint8_t opa) {
+  for (int32_t y = 0; y < h; y++) {
+    uint16_t *d = ROW(dst, dst_stride, y);
+    const uint16_t *s = CROW(src, src_stride, y);
+    const uint8_t *m = mask + y * mask_stride;
+    int32_t x = 0;
+    for (; x + 4 <= w; x += 4) {
+      if (load32(m + x) == 0) continue;
+      for (int k = 0; k < 4; k++) {
+        uint8_t a = (uint8_t)(((uint32_t)m[x + k] * opa) >> 8);
+        if (a) d[x + k] = mix565(s[x + k], d[x + k], a);
+      }
+    }
+    for (; x < w; x++) {
+      uint8_t a = (uint8_t)(((uint32_t)m[x] * opa) >> 8);
+      if (a) d[x] = mix565(s[x], d[x], a);
+    }
+  }
+}
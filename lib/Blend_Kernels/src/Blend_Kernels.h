@@ -0,0 +1,42 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+// Packed-pixel RGB565 blend kernels for LVGL's software renderer, in plain
+// portable C++ (no intrinsics, no LVGL dependency). Rows are walked two pixels
+// per 32-bit word and masks four coverage bytes per word, so fully covered and
+// fully transparent runs cost one compare. Every mix uses the same 5-bit
+// packed formula as LVGL's lv_color_16_16_mix, so results are bit-exact with
+// the stock path.
+//
+// Strides are in bytes. Hooked into LVGL by Blend_Kernels_LVGL.h.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern bool blend_kernels_enabled;   // false = LVGL's stock path (A/B checks)
+
+// Solid colour
+void blend_fill_rgb565(uint16_t *dst, int32_t w, int32_t h, int32_t dst_stride, uint16_t color);
+void blend_fill_opa_rgb565(uint16_t *dst, int32_t w, int32_t h, int32_t dst_stride, uint16_t color, uint8_t opa);
+// Solid colour through an A8 coverage mask (glyphs, anti-aliased edges, A8 images)
+void blend_fill_mask_rgb565(uint16_t *dst, int32_t w, int32_t h, int32_t dst_stride, uint16_t color,
+                            const uint8_t *mask, int32_t mask_stride);
+void blend_fill_mask_opa_rgb565(uint16_t *dst, int32_t w, int32_t h, int32_t dst_stride, uint16_t color,
+                                const uint8_t *mask, int32_t mask_stride, uint8_t opa);
+
+// RGB565 source; with a mask this is also the RGB565A8 image path (mask = A8 plane)
+void blend_image_rgb565(uint16_t *dst, int32_t w, int32_t h, int32_t dst_stride,
+                        const uint16_t *src, int32_t src_stride);
+void blend_image_opa_rgb565(uint16_t *dst, int32_t w, int32_t h, int32_t dst_stride,
+                            const uint16_t *src, int32_t src_stride, uint8_t opa);
+void blend_image_mask_rgb565(uint16_t *dst, int32_t w, int32_t h, int32_t dst_stride,
+                             const uint16_t *src, int32_t src_stride, const uint8_t *mask, int32_t mask_stride);
+void blend_image_mask_opa_rgb565(uint16_t *dst, int32_t w, int32_t h, int32_t dst_stride,
+                                 const uint16_t *src, int32_t src_stride, const uint8_t *mask,
+                                 int32_t mask_stride, uint8_t opa);
+
+#ifdef __cplusplus
+}
+#endif
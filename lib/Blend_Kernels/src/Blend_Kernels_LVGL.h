@@ -0,0 +1,45 @@
+#pragma once
+// Included by LVGL's draw_sw blend code via LV_DRAW_SW_ASM_CUSTOM_INCLUDE
+// (lv_conf.h). Each hook evaluates to LV_RESULT_INVALID while the kernels are
+// switched off, which makes LVGL run its stock loop instead.
+#include "Blend_Kernels.h"
+
+#define BLEND_KERNEL_CALL(call) (blend_kernels_enabled ? ((call), LV_RESULT_OK) : LV_RESULT_INVALID)
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565(dsc) \
+  BLEND_KERNEL_CALL(blend_fill_rgb565((uint16_t *)(dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, \
+                                      (dsc)->dest_stride, lv_color_to_u16((dsc)->color)))
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA(dsc) \
+  BLEND_KERNEL_CALL(blend_fill_opa_rgb565((uint16_t *)(dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, \
+                                          (dsc)->dest_stride, lv_color_to_u16((dsc)->color), (dsc)->opa))
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK(dsc) \
+  BLEND_KERNEL_CALL(blend_fill_mask_rgb565((uint16_t *)(dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, \
+                                           (dsc)->dest_stride, lv_color_to_u16((dsc)->color), \
+                                           (dsc)->mask_buf, (dsc)->mask_stride))
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_MIX_MASK_OPA(dsc) \
+  BLEND_KERNEL_CALL(blend_fill_mask_opa_rgb565((uint16_t *)(dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, \
+                                               (dsc)->dest_stride, lv_color_to_u16((dsc)->color), \
+                                               (dsc)->mask_buf, (dsc)->mask_stride, (dsc)->opa))
+
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565(dsc) \
+  BLEND_KERNEL_CALL(blend_image_rgb565((uint16_t *)(dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, \
+                                       (dsc)->dest_stride, (const uint16_t *)(dsc)->src_buf, (dsc)->src_stride))
+
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc) \
+  BLEND_KERNEL_CALL(blend_image_opa_rgb565((uint16_t *)(dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, \
+                                           (dsc)->dest_stride, (const uint16_t *)(dsc)->src_buf, \
+                                           (dsc)->src_stride, (dsc)->opa))
+
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc) \
+  BLEND_KERNEL_CALL(blend_image_mask_rgb565((uint16_t *)(dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, \
+                                            (dsc)->dest_stride, (const uint16_t *)(dsc)->src_buf, \
+                                            (dsc)->src_stride, (dsc)->mask_buf, (dsc)->mask_stride))
+
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc) \
+  BLEND_KERNEL_CALL(blend_image_mask_opa_rgb565((uint16_t *)(dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, \
+                                                (dsc)->dest_stride, (const uint16_t *)(dsc)->src_buf, \
+                                                (dsc)->src_stride, (dsc)->mask_buf, (dsc)->mask_stride, \
+                                                (dsc)->opa))
@@ -0,0 +1,291 @@
+#include "Channel_History.h"
+#include <freertos/FreeRTOS.h>
+#include <esp_cpu.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include <stdio.h>
+#include <string.h>
+
+#define BUCKET_LEVELS 3
+#define FAN_OUT       10   // Buckets of one level per bucket of the next
+#define ADVANCE_CHUNK 10   // 100 ms buckets closed per critical section
+
+typedef struct __attribute__((packed)) {
+  uint32_t t_ms;
+  int16_t v;
+} raw_sample_t;
+
+typedef struct {
+  int16_t min, max, avg;
+} bucket_t;
+
+typedef struct {
+  bucket_t *ring;
+  uint32_t newest;        // Bucket number last closed
+  uint32_t count;
+  // Open bucket
+  int16_t min, max;
+  int32_t sum;
+  uint32_t n;
+} level_t;
+
+typedef struct {
+  raw_sample_t *raw;
+  uint32_t raw_head, raw_count;
+  uint32_t raw_total;     // Readings ever appended; tells a query which slots were reused
+  float scale;
+  int16_t last;           // Repeated into buckets that saw no readings
+  level_t lv[BUCKET_LEVELS];
+} channel_t;
+
+static const uint32_t BUCKET_MS[BUCKET_LEVELS] = { 100, 1000, 10000 };
+static const uint32_t DEFAULT_SPAN[BUCKET_LEVELS] = { 6000, 3600, 8640 };  // 10 min, 1 h, 24 h
+
+static channel_t chans[HISTORY_MAX_CHANNELS];
+static int channel_count = 0;
+static uint8_t *pool = NULL;
+static uint32_t open_bucket = 0;      // 100 ms bucket number currently filling
+static history_stats_t stats;
+static uint64_t append_cycles_sum = 0;
+static portMUX_TYPE history_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static int16_t to_fixed(const channel_t *c, float v) {
+  float f = v * c->scale;
+  if (f > INT16_MAX) return INT16_MAX;
+  if (f < -INT16_MAX) return -INT16_MAX;
+  return (int16_t)(f < 0 ? f - 0.5f : f + 0.5f);
+}
+
+bool history_init(const float *scales, int channels, size_t budget_bytes) {
+  if (channels > HISTORY_MAX_CHANNELS) channels = HISTORY_MAX_CHANNELS;
+  if (pool) { heap_caps_free(pool); pool = NULL; }
+  memset(chans, 0, sizeof(chans));
+  memset(&stats, 0, sizeof(stats));
+
+  // Bucket levels first (at most 80% of the budget), raw samples get the rest
+  size_t per_ch = budget_bytes / channels;
+  size_t buckets = 0;
+  for (int l = 0; l < BUCKET_LEVELS; l++) buckets += DEFAULT_SPAN[l] * sizeof(bucket_t);
+  float shrink = buckets > per_ch * 4 / 5 ? (per_ch * 4 / 5) / (float)buckets : 1.0f;
+  size_t used = 0;
+  for (int l = 0; l < BUCKET_LEVELS; l++) {
+    stats.capacity[1 + l] = (uint32_t)(DEFAULT_SPAN[l] * shrink);
+    if (stats.capacity[1 + l] < 2) stats.capacity[1 + l] = 2;
+    used += stats.capacity[1 + l] * sizeof(bucket_t);
+  }
+  stats.capacity[HISTORY_RAW] = per_ch > used ? (per_ch - used) / sizeof(raw_sample_t) : 0;
+  if (stats.capacity[HISTORY_RAW] < 16) {
+    printf("Channel_History: Budget too small for %d channels!\n", channels);
+    return false;
+  }
+  stats.bytes = (stats.capacity[HISTORY_RAW] * sizeof(raw_sample_t) + used) * channels;
+  pool = (uint8_t *)heap_caps_malloc(stats.bytes, MALLOC_CAP_SPIRAM);
+  if (!pool) {
+    printf("Channel_History: Failed to allocate %u bytes!\n", (unsigned)stats.bytes);
+    return false;
+  }
+
+  uint8_t *p = pool;
+  for (int ch = 0; ch < channels; ch++) {
+    channel_t *c = &chans[ch];
+    c->scale = scales[ch];
+    c->raw = (raw_sample_t *)p;
+    p += stats.capacity[HISTORY_RAW] * sizeof(raw_sample_t);
+    for (int l = 0; l < BUCKET_LEVELS; l++) {
+      c->lv[l].ring = (bucket_t *)p;
+      p += stats.capacity[1 + l] * sizeof(bucket_t);
+    }
+  }
+  channel_count = channels;
+  open_bucket = (uint32_t)(esp_timer_get_time() / 1000) / BUCKET_MS[0];
+  return true;
+}
+
+static inline void accum_add(level_t *lv, int16_t v) {
+  if (lv->n == 0 || v < lv->min) lv->min = v;
+  if (lv->n == 0 || v > lv->max) lv->max = v;
+  lv->sum += v;
+  lv->n++;
+}
+
+// Close the open bucket of `l` as bucket number k and fold it into level l + 1.
+// Upper levels average their buckets (time-weighted), not the raw readings.
+static void close_bucket(channel_t *c, int l, uint32_t k) {
+  level_t *lv = &c->lv[l];
+  uint32_t cap = stats.capacity[1 + l];
+  bucket_t b;
+  if (lv->n) b = { lv->min, lv->max, (int16_t)(lv->sum / (int32_t)lv->n) };
+  else b = { c->last, c->last, c->last };
+  lv->ring[k % cap] = b;
+  lv->newest = k;
+  if (lv->count < cap) lv->count++;
+  lv->n = 0;
+  lv->sum = 0;
+
+  if (l + 1 < BUCKET_LEVELS) {
+    level_t *up = &c->lv[l + 1];
+    if (up->n == 0 || b.min < up->min) up->min = b.min;
+    if (up->n == 0 || b.max > up->max) up->max = b.max;
+    up->sum += b.avg;
+    up->n++;
+    if ((k + 1) % FAN_OUT == 0) close_bucket(c, l + 1, k / FAN_OUT);
+  }
+}
+
+// Close the 100 ms buckets before `due` on all channels, so buckets stay
+// aligned across channels whichever of tick or sample gets there first.
+// At most ADVANCE_CHUNK per call; true if more remain.
+static bool advance_locked(uint32_t due) {
+  if (due <= open_bucket) return false;
+  // A long stall closes at most one ring's worth of (repeated) buckets
+  if (due - open_bucket > stats.capacity[1]) open_bucket = due - stats.capacity[1];
+  uint32_t end = due - open_bucket > ADVANCE_CHUNK ? open_bucket + ADVANCE_CHUNK : due;
+  for (; open_bucket < end; open_bucket++) {
+    for (int ch = 0; ch < channel_count; ch++) close_bucket(&chans[ch], 0, open_bucket);
+  }
+  return open_bucket < due;
+}
+
+// Enters the critical section with every bucket before `due` closed. A catch-up
+// after a stall (up to a ring of buckets per channel) is done in chunks, with
+// interrupts let in between, instead of in one long critical section.
+static void enter_advanced(uint32_t due) {
+  portENTER_CRITICAL(&history_lock);
+  while (advance_locked(due)) {
+    portEXIT_CRITICAL(&history_lock);
+    portENTER_CRITICAL(&history_lock);
+  }
+}
+
+void history_sample(int ch, float v) {
+  if (ch < 0 || ch >= channel_count) return;
+  uint32_t t0 = esp_cpu_get_cycle_count();
+  channel_t *c = &chans[ch];
+  int16_t f = to_fixed(c, v);
+  uint32_t now_ms = (uint32_t)(esp_timer_get_time() / 1000);
+  uint32_t cap = stats.capacity[HISTORY_RAW];
+
+  enter_advanced(now_ms / BUCKET_MS[0]);  // Boundary passed since the last tick
+  c->raw[c->raw_head] = { now_ms, f };
+  c->raw_head = (c->raw_head + 1) % cap;
+  if (c->raw_count < cap) c->raw_count++;
+  c->raw_total++;
+  c->last = f;
+  accum_add(&c->lv[0], f);
+  uint32_t dt = esp_cpu_get_cycle_count() - t0;
+  stats.appends++;
+  append_cycles_sum += dt;
+  if (dt > stats.append_max_cycles) stats.append_max_cycles = dt;
+  portEXIT_CRITICAL(&history_lock);
+}
+
+bool history_tick(uint32_t now_ms) {
+  if (!pool) return false;
+  static uint32_t seen = 0;
+  enter_advanced(now_ms / BUCKET_MS[0]);
+  uint32_t closed = open_bucket;
+  portEXIT_CRITICAL(&history_lock);
+  // True once per newly closed bucket, even if a sample closed it first
+  if (closed == seen) return false;
+  seen = closed;
+  return true;
+}
+
+uint32_t history_bucket_ms(history_level_t level) {
+  return level == HISTORY_RAW ? 0 : BUCKET_MS[level - 1];
+}
+
+uint32_t history_newest(history_level_t level) {
+  return (level == HISTORY_RAW || !channel_count) ? 0 : chans[0].lv[level - 1].newest;
+}
+
+int history_available(history_level_t level) {
+  if (!channel_count) return 0;
+  return level == HISTORY_RAW ? chans[0].raw_count : chans[0].lv[level - 1].count;
+}
+
+// Only the ring positions are taken under the lock; the PSRAM reads and the
+// scaling run with interrupts enabled. Appends may reuse the oldest slots in
+// the meantime, so whatever the writer reached by the end is dropped from
+// the front of the result.
+int history_query(int ch, history_level_t level, uint32_t from_ms, uint32_t to_ms,
+                  history_point_t *out, int max_points) {
+  if (ch < 0 || ch >= channel_count || max_points <= 0 || to_ms < from_ms) return 0;
+  int64_t t0 = esp_timer_get_time();
+  channel_t *c = &chans[ch];
+  float inv = 1.0f / c->scale;
+  int n = 0, stale = 0;
+
+  if (level == HISTORY_RAW) {
+    uint32_t cap = stats.capacity[HISTORY_RAW];
+    portENTER_CRITICAL(&history_lock);
+    uint32_t first = (c->raw_head + cap - c->raw_count) % cap;
+    // Readings are in time order: binary search the first one at or after from_ms
+    uint32_t lo = 0, hi = c->raw_count;
+    while (lo < hi) {
+      uint32_t mid = (lo + hi) / 2;
+      if (c->raw[(first + mid) % cap].t_ms < from_ms) lo = mid + 1;
+      else hi = mid;
+    }
+    uint32_t pos = (first + lo) % cap, avail = c->raw_count - lo;
+    uint32_t start = c->raw_total - c->raw_count + lo;   // Append number of out[0]
+    portEXIT_CRITICAL(&history_lock);
+
+    for (uint32_t i = 0; i < avail && n < max_points; i++) {
+      const raw_sample_t *s = &c->raw[(pos + i) % cap];
+      if (s->t_ms > to_ms) break;
+      float v = s->v * inv;
+      out[n++] = { s->t_ms, v, v, v };
+    }
+
+    portENTER_CRITICAL(&history_lock);
+    int32_t reused = (int32_t)(c->raw_total - c->raw_count - start);
+    portEXIT_CRITICAL(&history_lock);
+    if (reused > 0) stale = reused;
+  } else {
+    const level_t *lv = &c->lv[level - 1];
+    uint32_t ms = BUCKET_MS[level - 1], cap = stats.capacity[level];
+    portENTER_CRITICAL(&history_lock);
+    uint32_t count = lv->count, newest = lv->newest;
+    portEXIT_CRITICAL(&history_lock);
+
+    uint32_t k0 = from_ms / ms;
+    if (count) {
+      uint32_t oldest = newest + 1 - count, k1 = to_ms / ms;
+      if (k0 < oldest) k0 = oldest;
+      if (k1 > newest) k1 = newest;
+      for (uint32_t k = k0; k <= k1 && n < max_points; k++) {
+        const bucket_t *b = &lv->ring[k % cap];
+        out[n++] = { k * ms, b->min * inv, b->max * inv, b->avg * inv };
+      }
+    }
+
+    portENTER_CRITICAL(&history_lock);
+    int32_t reused = (int32_t)(lv->newest + 1 - lv->count - k0);
+    portEXIT_CRITICAL(&history_lock);
+    if (reused > 0) stale = reused;
+  }
+  if (stale > n) stale = n;
+  if (stale) {
+    n -= stale;
+    memmove(out, out + stale, n * sizeof(*out));
+  }
+
+  stats.queries++;
+  stats.last_query_points = n;
+  stats.last_query_us = (uint32_t)(esp_timer_get_time() - t0);
+  return n;
+}
+
+history_level_t history_level_for(uint32_t span_ms, int max_points) {
+  for (int l = HISTORY_100MS; l < HISTORY_LEVELS; l++) {
+    uint32_t points = span_ms / BUCKET_MS[l - 1];
+    if (points <= (uint32_t)max_points && points <= stats.capacity[l]) return (history_level_t)l;
+  }
+  return HISTORY_10S;
+}
+
+const history_stats_t *history_stats() {
+  stats.append_avg_cycles = stats.appends ? (uint32_t)(append_cycles_sum / stats.appends) : 0;
+  return &stats;
+}
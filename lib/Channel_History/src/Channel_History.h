@@ -0,0 +1,52 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Per-channel history in PSRAM at several resolutions. Every reading lands
+// in a raw ring at its native (CAN) rate and is folded incrementally into
+// 100 ms buckets, which cascade into 1 s and 10 s buckets of min/max/avg.
+// Values are stored as int16 fixed point (value * scale). Bucket k of a level
+// covers [k * bucket_ms, (k + 1) * bucket_ms), so a time window maps straight
+// to ring indices and a query costs O(points returned).
+//
+// One allocation holds everything. The bucket levels get their default spans
+// (10 min / 1 h / 24 h) when they fit in 80% of the budget, otherwise they are
+// shortened proportionally. The rest of the budget is shared out as raw samples.
+#define HISTORY_MAX_CHANNELS 8
+#define HISTORY_DEFAULT_BUDGET (1024 * 1024)
+
+typedef enum {
+  HISTORY_RAW = 0,    // Individual readings, min = max = avg
+  HISTORY_100MS,
+  HISTORY_1S,
+  HISTORY_10S,
+  HISTORY_LEVELS
+} history_level_t;
+
+typedef struct {
+  uint32_t t_ms;      // Reading time, or bucket start
+  float min, max, avg;
+} history_point_t;
+
+typedef struct {
+  uint32_t appends, append_avg_cycles, append_max_cycles;
+  uint32_t queries, last_query_points, last_query_us;
+  uint32_t capacity[HISTORY_LEVELS];   // Per channel: raw samples, then buckets
+  size_t bytes;                        // Allocated
+} history_stats_t;
+
+// scales[ch]: fixed-point factor, chosen so value * scale fits an int16
+bool history_init(const float *scales, int channels, size_t budget_bytes);
+void history_sample(int ch, float v);              // Safe from any task
+bool history_tick(uint32_t now_ms);                // Closes due 100 ms buckets (and cascades)
+
+uint32_t history_bucket_ms(history_level_t level); // 0 for HISTORY_RAW
+uint32_t history_newest(history_level_t level);    // Bucket number of the newest closed bucket
+int history_available(history_level_t level);      // Closed buckets held
+
+// Points in [from_ms, to_ms], oldest first; returns how many were written
+int history_query(int ch, history_level_t level, uint32_t from_ms, uint32_t to_ms,
+                  history_point_t *out, int max_points);
+// Finest level that covers span_ms in no more than max_points
+history_level_t history_level_for(uint32_t span_ms, int max_points);
+const history_stats_t *history_stats();
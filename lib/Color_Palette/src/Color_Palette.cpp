@@ -0,0 +1,28 @@
+#include "Color_Palette.h"
+#include <math.h>
+
+// 0 at or below a, 255 at or above b
+static inline uint8_t ramp(float v, float a, float b) {
+  if (v <= a) return 0;
+  if (v >= b) return 255;
+  return (uint8_t)((v - a) / (b - a) * 255.0f + 0.5f);
+}
+
+void palette_build(palette_t *p, float min, float max, float t_low, float t_high,
+                   lv_color_t low, lv_color_t mid, lv_color_t high) {
+  p->min = min;
+  p->scale = (PALETTE_SIZE - 1) / (max - min);
+  if (isnan(t_low) || isnan(t_high)) {
+    uint16_t m = lv_color_to_u16(mid);
+    for (int i = 0; i < PALETTE_SIZE; i++) p->c[i] = m;
+    return;
+  }
+  float half = (t_high - t_low) / 4;  // Each ramp spans half the mid zone
+  for (int i = 0; i < PALETTE_SIZE; i++) {
+    float v = min + i / p->scale;
+    lv_color_t c;
+    if (v < (t_low + t_high) / 2) c = lv_color_mix(mid, low, ramp(v, t_low - half, t_low + half));
+    else c = lv_color_mix(high, mid, ramp(v, t_high - half, t_high + half));
+    p->c[i] = lv_color_to_u16(c);
+  }
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <lvgl.h>
+
+// Value -> colour table in the panel's native RGB565, built once per theme
+// change so the per-frame path is one multiply and a load. Entry i stands for
+// min + i * (max - min) / (PALETTE_SIZE - 1).
+#define PALETTE_SIZE 256
+
+typedef struct {
+  uint16_t c[PALETTE_SIZE];
+  float min, scale;       // scale = (PALETTE_SIZE - 1) / (max - min)
+} palette_t;
+
+// low -> mid -> high, ramping across each zone threshold over half the mid
+// zone's width (centred on the threshold), so the colour at the threshold
+// is the even mix of the two hard zone colours.
+// t_low / t_high NAN: the channel has no zones and the table is all mid.
+void palette_build(palette_t *p, float min, float max, float t_low, float t_high,
+                   lv_color_t low, lv_color_t mid, lv_color_t high);
+
+static inline uint16_t palette_lookup(const palette_t *p, float v) {
+  int32_t i = (int32_t)((v - p->min) * p->scale + 0.5f);
+  return p->c[i < 0 ? 0 : i >= PALETTE_SIZE ? PALETTE_SIZE - 1 : i];
+}
+
+// RGB565 back to lv_color_t (bit replication, so white stays 0xFFFFFF)
+static inline lv_color_t palette_expand(uint16_t c) {
+  uint8_t r = (c >> 11) & 0x1F, g = (c >> 5) & 0x3F, b = c & 0x1F;
+  return lv_color_make((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2));
+}
@@ -0,0 +1,143 @@
+#include "Digit_Cache.h"
+#include "Segment_Font.h"
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include <esp_memory_utils.h>
+#include <string.h>
+
+static int glyph_index(char c) {
+  const char *p = strchr(DIGIT_CACHE_GLYPHS, c);
+  return (p && c) ? (int)(p - DIGIT_CACHE_GLYPHS) : -1;
+}
+
+static size_t internal_used = 0;   // Across all caches
+
+static uint8_t *tile_alloc(size_t bytes, bool internal) {
+  uint8_t *buf = NULL;
+  if (internal) buf = (uint8_t *)heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  if (!buf) buf = (uint8_t *)heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM);
+  return buf;
+}
+
+// Free every tile of the set and hand its internal RAM back to the budget
+static void release_tiles(digit_cache_t *cache) {
+  for (int i = 0; i < DIGIT_CACHE_COUNT; i++) {
+    if (cache->tiles[i]) heap_caps_free(cache->tiles[i]);
+    cache->tiles[i] = NULL;
+  }
+  internal_used -= cache->internal_bytes;
+  cache->internal_bytes = 0;
+}
+
+bool digit_cache_build(digit_cache_t *cache, int32_t height) {
+  int64_t start = esp_timer_get_time();
+  if (cache->h != height) {
+    release_tiles(cache);
+    cache->h = height;
+  }
+
+  // The whole set goes to internal RAM or none of it
+  bool internal = false;
+  if (!cache->tiles[0]) {
+    size_t set_bytes = 0;
+    for (int i = 0; i < DIGIT_CACHE_COUNT; i++)
+      set_bytes += seg_font_cell_width(DIGIT_CACHE_GLYPHS[i], height) * height;
+    internal = internal_used + set_bytes <= DIGIT_CACHE_INTERNAL_BUDGET;
+  }
+
+  // Rasteriser accumulators sized for the widest glyph, plus an RGB565 blit
+  // target for timing
+  int32_t max_w = seg_font_cell_width('0', height);
+  uint16_t *acc = (uint16_t *)heap_caps_malloc(max_w * height * sizeof(uint16_t), MALLOC_CAP_SPIRAM);
+  uint16_t *scratch = (uint16_t *)heap_caps_malloc(max_w * height * sizeof(uint16_t), MALLOC_CAP_SPIRAM);
+  if (!acc) {
+    printf("Digit_Cache: Failed to allocate glyph scratch!\n");
+    if (scratch) heap_caps_free(scratch);
+    return false;
+  }
+
+  // Scratch canvas, hidden so creating it doesn't invalidate the screen
+  lv_obj_t *canvas = lv_canvas_create(lv_layer_top());
+  lv_obj_add_flag(canvas, LV_OBJ_FLAG_HIDDEN);
+  int64_t render_us = 0, blit_us = 0;
+
+  for (int i = 0; i < DIGIT_CACHE_COUNT; i++) {
+    char c = DIGIT_CACHE_GLYPHS[i];
+    int32_t w = seg_font_cell_width(c, height);
+
+    if (!cache->tiles[i]) {
+      size_t bytes = w * height;
+      cache->tiles[i] = tile_alloc(bytes, internal);
+      if (cache->tiles[i] && internal && esp_ptr_internal(cache->tiles[i])) {
+        cache->internal_bytes += bytes;
+        internal_used += bytes;
+      }
+      if (!cache->tiles[i]) {
+        printf("Digit_Cache: Failed to allocate tile '%c'!\n", c);
+        release_tiles(cache);  // No partial set: the next build starts over
+        lv_obj_delete(canvas);
+        heap_caps_free(acc);
+        if (scratch) heap_caps_free(scratch);
+        return false;
+      }
+    }
+    cache->w[i] = w;
+
+    int64_t t0 = esp_timer_get_time();
+    seg_font_render(c, cache->tiles[i], acc, w, height);
+    render_us += esp_timer_get_time() - t0;
+
+    lv_image_dsc_t *img = &cache->img[i];
+    lv_memzero(img, sizeof(*img));
+    img->header.magic = LV_IMAGE_HEADER_MAGIC;
+    img->header.cf = LV_COLOR_FORMAT_A8;
+    img->header.w = w;
+    img->header.h = height;
+    img->header.stride = w;
+    img->data_size = w * height;
+    img->data = cache->tiles[i];
+
+    // Time the same glyph as a tile blit for comparison with rendering it
+    if (scratch) {
+      t0 = esp_timer_get_time();
+      lv_canvas_set_buffer(canvas, scratch, w, height, LV_COLOR_FORMAT_RGB565);
+      lv_layer_t layer;
+      lv_canvas_init_layer(canvas, &layer);
+      lv_draw_image_dsc_t dsc;
+      lv_draw_image_dsc_init(&dsc);
+      dsc.src = img;
+      dsc.recolor = lv_color_white();
+      dsc.recolor_opa = LV_OPA_COVER;
+      lv_area_t area = { 0, 0, w - 1, height - 1 };
+      lv_draw_image(&layer, &dsc, &area);
+      lv_canvas_finish_layer(canvas, &layer);
+      blit_us += esp_timer_get_time() - t0;
+    }
+  }
+  lv_obj_delete(canvas);
+  heap_caps_free(acc);
+  if (scratch) heap_caps_free(scratch);
+  cache->render_us = (uint32_t)(render_us / DIGIT_CACHE_COUNT);
+  cache->blit_us = scratch ? (uint32_t)(blit_us / DIGIT_CACHE_COUNT) : 0;
+  cache->build_us = (uint32_t)(esp_timer_get_time() - start);
+  return true;
+}
+
+const lv_image_dsc_t *digit_cache_get(const digit_cache_t *cache, char c) {
+  int i = glyph_index(c);
+  return (i >= 0 && cache->tiles[i]) ? &cache->img[i] : NULL;
+}
+
+int32_t digit_cache_char_width(const digit_cache_t *cache, char c) {
+  int i = glyph_index(c);
+  return i >= 0 ? cache->w[i] : 0;
+}
+
+int32_t digit_cache_text_width(const digit_cache_t *cache, const char *text) {
+  int32_t w = 0;
+  for (const char *p = text; *p; p++) {
+    int i = glyph_index(*p);
+    if (i >= 0) w += cache->w[i];
+  }
+  return w;
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include <lvgl.h>
+
+// Glyphs the value display can ever show, rasterised once per size into A8
+// coverage tiles. They are drawn with the text colour as image recolor, so
+// they blend over whatever lies beneath (artwork, tile frames) and a theme
+// change needs no rebuild.
+#define DIGIT_CACHE_GLYPHS   "0123456789.-"
+#define DIGIT_CACHE_COUNT    12
+
+typedef struct {
+  int32_t h;                                  // Tile height (glyph size in px)
+  int32_t w[DIGIT_CACHE_COUNT];               // Tile width (cell advance)
+  uint8_t *tiles[DIGIT_CACHE_COUNT];          // A8 coverage, stride = w
+  size_t internal_bytes;                      // Of the tiles, charged to the internal budget
+  lv_image_dsc_t img[DIGIT_CACHE_COUNT];
+  uint32_t build_us;                          // Time of the last (re)build
+  uint32_t render_us;                         // Avg per-digit procedural render
+  uint32_t blit_us;                           // Avg per-digit render via the tile
+} digit_cache_t;
+
+// Internal RAM all caches together may take. A set goes there only if all
+// of its tiles fit in what is left (the small dashboard set does, the value
+// sets don't); everything else is PSRAM, so WiFi/lwIP keep their SRAM.
+#define DIGIT_CACHE_INTERNAL_BUDGET (24 * 1024)
+
+// Rasterise every glyph once at `height` px (Segment_Font) into the tile buffers,
+// timing each glyph's render and its tile blit (render_us / blit_us).
+// Buffers are allocated on first build (see DIGIT_CACHE_INTERNAL_BUDGET).
+bool digit_cache_build(digit_cache_t *cache, int32_t height);
+const lv_image_dsc_t *digit_cache_get(const digit_cache_t *cache, char c);
+int32_t digit_cache_char_width(const digit_cache_t *cache, char c);
+int32_t digit_cache_text_width(const digit_cache_t *cache, const char *text);
+
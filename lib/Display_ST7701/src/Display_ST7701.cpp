@@ -395,6 +395,14 @@ void lcd_add_window(uint16_t Xstart, uint16_t Xend, uint16_t Ystart, uint16_t Ye
   esp_lcd_panel_draw_bitmap(panel_handle, Xstart, Ystart, Xend, Yend, color);
 }
 
+// The partial flushes copy into frame buffer 0, which is the one scanned out
+uint16_t *lcd_get_framebuffer() {
+  void *fb0 = NULL;
+  if (panel_handle == NULL) return NULL;
+  if (esp_lcd_rgb_panel_get_frame_buffer(panel_handle, 1, &fb0) != ESP_OK) return NULL;
+  return (uint16_t *)fb0;
+}
+
 void backlight_init() {
   ledcAttach(LCD_BACKLIGHT_PIN, frequency, resolution);  
 }
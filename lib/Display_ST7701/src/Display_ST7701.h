@@ -75,6 +75,7 @@
    void lcd_init();
    void lcd_add_window(uint16_t Xstart, uint16_t Xend, uint16_t Ystart, uint16_t Yend,
  uint8_t *color);
+   uint16_t *lcd_get_framebuffer();   // Live RGB565 frame (PSRAM), for snapshots
 
    // backlight
    void backlight_init();
@@ -0,0 +1,153 @@
+#include "Event_Trace.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_cpu.h>
+#include <esp_heap_caps.h>
+#include <esp_ipc.h>
+#include <esp_timer.h>
+#include <stdio.h>
+#include <string.h>
+
+#define TRACE_CORES 2
+
+typedef struct {
+  trace_event_t *ev;
+  uint32_t head;        // Total events written; slot = head % TRACE_RING_EVENTS
+  uint32_t sync_cycles; // Cycle counter and esp_timer read together at trace_stop()
+  int64_t sync_us;
+} trace_ring_t;
+
+// Dump header, little-endian as laid out here
+typedef struct __attribute__((packed)) {
+  char magic[4];        // "GTRC"
+  uint16_t version;
+  uint16_t cpu_mhz;
+  uint8_t cores, names, tasks, reserved;
+  struct __attribute__((packed)) { uint32_t count, sync_cycles; int64_t sync_us; } core[TRACE_CORES];
+} trace_header_t;
+
+static trace_ring_t rings[TRACE_CORES];
+static volatile bool trace_on = false;
+static uint32_t trace_mhz = 240;
+static const char *names[TRACE_MAX_NAMES];
+static int name_count = 0;
+static TaskHandle_t task_handles[TRACE_MAX_TASKS];
+static char task_names[TRACE_MAX_TASKS][TRACE_TASK_NAME];
+static uint32_t task_count = 0;
+
+bool trace_init(uint32_t cpu_mhz) {
+  trace_mhz = cpu_mhz;
+  for (int c = 0; c < TRACE_CORES; c++) {
+    if (rings[c].ev) continue;
+    rings[c].ev = (trace_event_t *)heap_caps_malloc(TRACE_RING_EVENTS * sizeof(trace_event_t), MALLOC_CAP_SPIRAM);
+    if (!rings[c].ev) {
+      printf("Trace: Ring allocation failed!\n");
+      return false;
+    }
+  }
+  return true;
+}
+
+uint16_t trace_name(const char *name) {
+  for (int i = 0; i < name_count; i++) if (strcmp(names[i], name) == 0) return i;
+  if (name_count >= TRACE_MAX_NAMES) {
+    printf("Trace: Name table full, %s shares the last slot!\n", name);
+    return TRACE_MAX_NAMES - 1;
+  }
+  names[name_count] = name;
+  return name_count++;
+}
+
+// Tasks are registered on first sight; a rare duplicate entry from a race
+// between cores only splits that task's lane in the viewer
+static uint8_t current_task_id() {
+  TaskHandle_t t = xTaskGetCurrentTaskHandle();
+  uint32_t n = __atomic_load_n(&task_count, __ATOMIC_ACQUIRE);
+  if (n > TRACE_MAX_TASKS) n = TRACE_MAX_TASKS;
+  for (uint32_t i = 0; i < n; i++) if (task_handles[i] == t) return i;
+  if (n >= TRACE_MAX_TASKS) return TRACE_NO_TASK;
+  uint32_t i = __atomic_fetch_add(&task_count, 1, __ATOMIC_ACQ_REL);
+  if (i >= TRACE_MAX_TASKS) return TRACE_NO_TASK;
+  const char *name = pcTaskGetName(t);
+  for (int k = 0; k < TRACE_TASK_NAME - 1 && name && name[k]; k++) task_names[i][k] = name[k];
+  task_handles[i] = t;
+  return i;
+}
+
+void trace_event(uint16_t name, trace_phase_t phase, uint32_t arg) {
+  if (!trace_on) return;
+  trace_ring_t *r = &rings[esp_cpu_get_core_id()];
+  // Only this core writes this ring; the atomic add also covers a task
+  // switch landing between two writers on the same core
+  uint32_t i = __atomic_fetch_add(&r->head, 1, __ATOMIC_RELAXED);
+  trace_event_t *e = &r->ev[i % TRACE_RING_EVENTS];
+  e->cycles = esp_cpu_get_cycle_count();
+  e->name = name;
+  e->phase = phase;
+  e->task = current_task_id();
+  e->arg = arg;
+}
+
+void trace_start() {
+  if (!rings[0].ev || !rings[1].ev) return;
+  trace_on = false;
+  for (int c = 0; c < TRACE_CORES; c++) rings[c].head = 0;
+  trace_on = true;
+}
+
+static void sync_core(void *arg) {
+  trace_ring_t *r = (trace_ring_t *)arg;
+  r->sync_us = esp_timer_get_time();
+  r->sync_cycles = esp_cpu_get_cycle_count();
+}
+
+void trace_stop() {
+  if (!trace_on) return;
+  trace_on = false;
+  // Each core's counter runs independently; pair it with the shared esp_timer
+  for (int c = 0; c < TRACE_CORES; c++) esp_ipc_call_blocking(c, sync_core, &rings[c]);
+}
+
+bool trace_running() { return trace_on; }
+
+static uint32_t ring_count(const trace_ring_t *r) {
+  return r->head < TRACE_RING_EVENTS ? r->head : TRACE_RING_EVENTS;
+}
+
+size_t trace_export_size() {
+  size_t n = sizeof(trace_header_t);
+  for (int i = 0; i < name_count; i++) n += strlen(names[i]) + 1;
+  uint32_t tasks = task_count < TRACE_MAX_TASKS ? task_count : TRACE_MAX_TASKS;
+  for (uint32_t i = 0; i < tasks; i++) n += strlen(task_names[i]) + 1;
+  for (int c = 0; c < TRACE_CORES; c++) n += ring_count(&rings[c]) * sizeof(trace_event_t);
+  return n;
+}
+
+void trace_export(trace_write_fn write, void *ctx) {
+  trace_stop();
+  trace_header_t h = {};
+  memcpy(h.magic, "GTRC", 4);
+  h.version = 1;
+  h.cpu_mhz = trace_mhz;
+  h.cores = TRACE_CORES;
+  h.names = name_count;
+  h.tasks = task_count < TRACE_MAX_TASKS ? task_count : TRACE_MAX_TASKS;
+  for (int c = 0; c < TRACE_CORES; c++) {
+    h.core[c].count = ring_count(&rings[c]);
+    h.core[c].sync_cycles = rings[c].sync_cycles;
+    h.core[c].sync_us = rings[c].sync_us;
+  }
+  write(&h, sizeof(h), ctx);
+  for (int i = 0; i < name_count; i++) write(names[i], strlen(names[i]) + 1, ctx);
+  for (int i = 0; i < h.tasks; i++) write(task_names[i], strlen(task_names[i]) + 1, ctx);
+  for (int c = 0; c < TRACE_CORES; c++) {
+    const trace_ring_t *r = &rings[c];
+    if (!r->ev) continue;
+    // Oldest first: after a wrap that is the slot the next write would use
+    uint32_t start = r->head < TRACE_RING_EVENTS ? 0 : r->head % TRACE_RING_EVENTS;
+    uint32_t count = ring_count(r);
+    uint32_t first = count < TRACE_RING_EVENTS - start ? count : TRACE_RING_EVENTS - start;
+    write(&r->ev[start], first * sizeof(trace_event_t), ctx);
+    if (count > first) write(&r->ev[0], (count - first) * sizeof(trace_event_t), ctx);
+  }
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Binary event tracer for cross-task timing. Each core records into its own
+// flight-recorder ring in PSRAM (oldest events are overwritten), stamped with
+// that core's cycle counter. Recording is lock-free and safe from any task; not
+// from ISRs, since the rings are in PSRAM and unreachable while the flash
+// cache is off. Download with trace_export() and convert
+// on the host: python tools/trace2chrome.py trace.bin -o trace.json
+#define TRACE_RING_EVENTS 8192   // Per core, 12 bytes each
+#define TRACE_MAX_NAMES   32
+#define TRACE_MAX_TASKS   16
+#define TRACE_TASK_NAME   16     // configMAX_TASK_NAME_LEN
+#define TRACE_NO_TASK     0xFF
+
+typedef enum {
+  TRACE_BEGIN = 0,    // Slice start on the current task
+  TRACE_END,          // Slice end
+  TRACE_COMPLETE,     // Slice ending now, arg = duration in cycles
+  TRACE_INSTANT,
+  TRACE_FLOW,         // Events sharing arg are linked across tasks (first -> last)
+  TRACE_COUNTER,      // arg = value
+} trace_phase_t;
+
+typedef struct __attribute__((packed)) {
+  uint32_t cycles;
+  uint16_t name;      // From trace_name()
+  uint8_t phase;      // trace_phase_t
+  uint8_t task;       // Index into the task table, TRACE_NO_TASK when full
+  uint32_t arg;
+} trace_event_t;
+
+bool trace_init(uint32_t cpu_mhz);        // Allocates the rings, false if out of PSRAM
+uint16_t trace_name(const char *name);    // Register a static string once at boot
+void trace_start();                       // Clears the rings and starts recording
+void trace_stop();                        // Stops and aligns both core clocks to esp_timer
+bool trace_running();
+
+void trace_event(uint16_t name, trace_phase_t phase, uint32_t arg);
+static inline void trace_begin(uint16_t name, uint32_t arg = 0) { trace_event(name, TRACE_BEGIN, arg); }
+static inline void trace_end(uint16_t name) { trace_event(name, TRACE_END, 0); }
+static inline void trace_complete(uint16_t name, uint32_t cycles) { trace_event(name, TRACE_COMPLETE, cycles); }
+static inline void trace_instant(uint16_t name, uint32_t arg = 0) { trace_event(name, TRACE_INSTANT, arg); }
+static inline void trace_flow(uint16_t name, uint32_t id) { trace_event(name, TRACE_FLOW, id); }
+static inline void trace_counter(uint16_t name, uint32_t value) { trace_event(name, TRACE_COUNTER, value); }
+
+// Streams the dump (stopping first if needed): header, names, tasks, then
+// each core's events oldest first. trace_export_size() is the total length.
+typedef void (*trace_write_fn)(const void *data, size_t len, void *ctx);
+size_t trace_export_size();
+void trace_export(trace_write_fn write, void *ctx);
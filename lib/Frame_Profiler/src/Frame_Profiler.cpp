@@ -0,0 +1,97 @@
+#include "Frame_Profiler.h"
+#include <freertos/FreeRTOS.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+  uint32_t samples[PROF_WINDOW_SAMPLES];
+  uint32_t count;
+  uint32_t min, max;
+  uint64_t sum;
+} prof_window_t;
+
+static const char *STAGE_NAMES[PROF_STAGE_COUNT] = { "SMP", "UPD", "REN", "FLS", "IDL" };
+
+static prof_window_t window[PROF_STAGE_COUNT];
+static prof_summary_t history[PROF_HISTORY];
+static int hist_head = 0, hist_count = 0;
+static uint32_t window_start_ms = 0;
+static uint32_t cycles_per_us = 240;
+static uint32_t lcg = 1;
+static portMUX_TYPE prof_lock = portMUX_INITIALIZER_UNLOCKED;
+
+void prof_init(uint32_t cpu_mhz) {
+  cycles_per_us = cpu_mhz ? cpu_mhz : 1;
+  memset(window, 0, sizeof(window));
+  hist_head = hist_count = 0;
+}
+
+void prof_record(prof_stage_t stage, uint32_t cycles) {
+  portENTER_CRITICAL(&prof_lock);
+  prof_window_t *w = &window[stage];
+  if (w->count == 0 || cycles < w->min) w->min = cycles;
+  if (cycles > w->max) w->max = cycles;
+  w->sum += cycles;
+  // Reservoir sampling keeps the stored set uniform once the window overflows
+  if (w->count < PROF_WINDOW_SAMPLES) {
+    w->samples[w->count] = cycles;
+  } else {
+    lcg = lcg * 1664525u + 1013904223u;
+    uint32_t j = lcg % (w->count + 1);
+    if (j < PROF_WINDOW_SAMPLES) w->samples[j] = cycles;
+  }
+  w->count++;
+  portEXIT_CRITICAL(&prof_lock);
+}
+
+static int cmp_u32(const void *a, const void *b) {
+  uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+  return x < y ? -1 : x > y;
+}
+
+bool prof_tick(uint32_t now_ms) {
+  if (now_ms - window_start_ms < 1000) return false;
+  window_start_ms = now_ms;
+
+  static prof_window_t closed[PROF_STAGE_COUNT];
+  portENTER_CRITICAL(&prof_lock);
+  memcpy(closed, window, sizeof(window));
+  memset(window, 0, sizeof(window));
+  portEXIT_CRITICAL(&prof_lock);
+
+  prof_summary_t *s = &history[hist_head];
+  s->t_ms = now_ms;
+  for (int i = 0; i < PROF_STAGE_COUNT; i++) {
+    prof_window_t *w = &closed[i];
+    prof_stat_t *st = &s->stage[i];
+    st->count = w->count;
+    if (w->count == 0) {
+      st->min_us = st->avg_us = st->p99_us = st->max_us = 0;
+      continue;
+    }
+    uint32_t n = w->count < PROF_WINDOW_SAMPLES ? w->count : PROF_WINDOW_SAMPLES;
+    qsort(w->samples, n, sizeof(uint32_t), cmp_u32);
+    uint32_t p99 = (n * 99 + 99) / 100;   // ceil(0.99 n), 1-based
+    st->min_us = w->min / cycles_per_us;
+    st->avg_us = (uint32_t)(w->sum / w->count / cycles_per_us);
+    st->p99_us = w->samples[p99 - 1] / cycles_per_us;
+    st->max_us = w->max / cycles_per_us;
+  }
+  hist_head = (hist_head + 1) % PROF_HISTORY;
+  if (hist_count < PROF_HISTORY) hist_count++;
+  return true;
+}
+
+const prof_summary_t *prof_latest() {
+  if (hist_count == 0) return NULL;
+  return &history[(hist_head + PROF_HISTORY - 1) % PROF_HISTORY];
+}
+
+int prof_history_count() { return hist_count; }
+
+const prof_summary_t *prof_history(int i) {
+  if (i < 0 || i >= hist_count) return NULL;
+  return &history[(hist_head + PROF_HISTORY - hist_count + i) % PROF_HISTORY];
+}
+
+const char *prof_stage_name(prof_stage_t stage) { return STAGE_NAMES[stage]; }
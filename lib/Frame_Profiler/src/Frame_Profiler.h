@@ -0,0 +1,41 @@
+#pragma once
+#include <stdint.h>
+#include <esp_cpu.h>
+
+// Per-stage frame timing from the CPU cycle counter. Samples are gathered in
+// a one-second window, reduced to min/avg/p99/max and kept in a ring of
+// PROF_HISTORY summaries for export.
+typedef enum {
+  PROF_SAMPLE = 0,    // Reading inputs (CAN decode, test data)
+  PROF_UPDATE,        // Gauge logic and widget updates
+  PROF_RENDER,        // LVGL refresh minus the flush copies
+  PROF_FLUSH,         // Copies into the panel framebuffer
+  PROF_IDLE,          // UI loop asleep
+  PROF_STAGE_COUNT
+} prof_stage_t;
+
+#define PROF_WINDOW_SAMPLES 128   // Per stage and window, reservoir-sampled for the p99
+#define PROF_HISTORY        120   // One-second summaries kept (2 minutes)
+
+typedef struct {
+  uint32_t count;
+  uint32_t min_us, avg_us, p99_us, max_us;
+} prof_stat_t;
+
+typedef struct {
+  uint32_t t_ms;    // End of the window
+  prof_stat_t stage[PROF_STAGE_COUNT];
+} prof_summary_t;
+
+static inline uint32_t prof_now() { return esp_cpu_get_cycle_count(); }
+
+void prof_init(uint32_t cpu_mhz);
+void prof_record(prof_stage_t stage, uint32_t cycles);   // Safe from any task
+static inline void prof_end(prof_stage_t stage, uint32_t start) { prof_record(stage, prof_now() - start); }
+
+// Closes the window once a second; returns true when a new summary was added
+bool prof_tick(uint32_t now_ms);
+const prof_summary_t *prof_latest();
+int prof_history_count();
+const prof_summary_t *prof_history(int i);   // 0 = oldest
+const char *prof_stage_name(prof_stage_t stage);
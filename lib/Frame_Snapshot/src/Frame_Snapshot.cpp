@@ -0,0 +1,62 @@
+#include "Frame_Snapshot.h"
+#include <esp_heap_caps.h>
+#include <string.h>
+
+uint16_t *fb_snapshot_alloc() {
+  uint16_t *buf = (uint16_t *)heap_caps_malloc(FB_SNAP_PIXELS * sizeof(uint16_t), MALLOC_CAP_SPIRAM);
+  if (!buf) printf("Frame_Snapshot: Failed to allocate snapshot buffer!\n");
+  return buf;
+}
+
+void fb_snapshot_copy(uint16_t *dst, const uint16_t *src) {
+  memcpy(dst, src, FB_SNAP_PIXELS * sizeof(uint16_t));
+}
+
+static inline uint8_t absdiff(uint8_t a, uint8_t b) { return a > b ? a - b : b - a; }
+
+void fb_snapshot_diff(const uint16_t *a, const uint16_t *b, uint8_t tolerance, fb_diff_t *out) {
+  uint32_t diff_px = 0;
+  uint8_t max_delta = 0;
+  for (uint32_t i = 0; i < FB_SNAP_PIXELS; i++) {
+    uint16_t pa = a[i], pb = b[i];
+    if (pa == pb) continue;
+    // Expand 5/6/5 to 8-bit so the tolerance means the same on every channel
+    uint8_t dr = absdiff((pa >> 11) << 3, (pb >> 11) << 3);
+    uint8_t dg = absdiff(((pa >> 5) & 0x3F) << 2, ((pb >> 5) & 0x3F) << 2);
+    uint8_t db = absdiff((pa & 0x1F) << 3, (pb & 0x1F) << 3);
+    uint8_t d = dr > dg ? dr : dg;
+    if (db > d) d = db;
+    if (d > max_delta) max_delta = d;
+    if (d > tolerance) diff_px++;
+  }
+  out->diff_px = diff_px;
+  out->max_delta = max_delta;
+  out->diff_ppm = (uint32_t)((uint64_t)diff_px * 1000000 / FB_SNAP_PIXELS);
+}
+
+bool fb_diff_pass(const fb_diff_t *d, uint32_t max_diff_ppm) {
+  return d->diff_ppm <= max_diff_ppm;
+}
+
+static void put_le(uint8_t *p, uint32_t v, int n) {
+  for (int i = 0; i < n; i++) p[i] = (v >> (8 * i)) & 0xFF;
+}
+
+size_t fb_bmp_header(uint8_t *hdr, int w, int h) {
+  uint32_t data_size = (uint32_t)w * h * 2;
+  memset(hdr, 0, FB_BMP_HEADER_SIZE);
+  hdr[0] = 'B'; hdr[1] = 'M';
+  put_le(hdr + 2, FB_BMP_HEADER_SIZE + data_size, 4);
+  put_le(hdr + 10, FB_BMP_HEADER_SIZE, 4);        // Pixel data offset
+  put_le(hdr + 14, 40, 4);                         // BITMAPINFOHEADER
+  put_le(hdr + 18, w, 4);
+  put_le(hdr + 22, (uint32_t)(-h), 4);             // Negative height = top-down
+  put_le(hdr + 26, 1, 2);                          // Planes
+  put_le(hdr + 28, 16, 2);                         // Bits per pixel
+  put_le(hdr + 30, 3, 4);                          // BI_BITFIELDS
+  put_le(hdr + 34, data_size, 4);
+  put_le(hdr + 54, 0xF800, 4);                     // Red mask
+  put_le(hdr + 58, 0x07E0, 4);                     // Green mask
+  put_le(hdr + 62, 0x001F, 4);                     // Blue mask
+  return FB_BMP_HEADER_SIZE;
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// RGB565 frame snapshots: copy out of whatever holds the composed frame
+// (the panel's PSRAM framebuffer on the device), compare two frames with a
+// per-channel tolerance, and export as a 16-bit BMP.
+#define FB_SNAP_W          480
+#define FB_SNAP_H          480
+#define FB_SNAP_PIXELS     (FB_SNAP_W * FB_SNAP_H)
+#define FB_BMP_HEADER_SIZE 66
+
+typedef struct {
+  uint32_t diff_px;        // Pixels with any channel delta above tolerance
+  uint8_t max_delta;       // Largest channel delta seen (8-bit scale)
+  uint32_t diff_ppm;       // diff_px per million pixels
+} fb_diff_t;
+
+uint16_t *fb_snapshot_alloc();                          // PSRAM, FB_SNAP_PIXELS
+void fb_snapshot_copy(uint16_t *dst, const uint16_t *src);
+
+// Channel deltas are compared on an 8-bit scale; tolerance 0 = bit-exact
+void fb_snapshot_diff(const uint16_t *a, const uint16_t *b, uint8_t tolerance, fb_diff_t *out);
+bool fb_diff_pass(const fb_diff_t *d, uint32_t max_diff_ppm);
+
+// Top-down BI_BITFIELDS RGB565 BMP header; pixel rows follow unpadded
+// (480 px * 2 bytes is already 4-byte aligned)
+size_t fb_bmp_header(uint8_t *hdr, int w, int h);
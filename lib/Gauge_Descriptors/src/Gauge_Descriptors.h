@@ -0,0 +1,41 @@
+#pragma once
+#include <stdint.h>
+
+// Everything that differs between gauge modes, fixed at compile time. The
+// update path is a template over the mode, so each field below is a
+// constant in its instantiation: zone tests on modes without zones vanish
+// and the divisions (normalisation, fixed-point scale) fold into multiplies.
+struct GaugeDesc {
+  const char *name;         // Mode label
+  const char *units;
+  float min, max;           // Dial range
+  bool zoned;               // Has low | mid | high colour zones; otherwise mid only
+  float zone_low, zone_high, zone_hyst;
+  uint8_t decimals;         // Fixed-point digits of the value display
+  float smoothing;          // Fraction of the gap closed per update (lower = smoother)
+  float max_rate;           // Units per second the shown value may move
+  float snap;               // Gap below which the value jumps to the target
+  float sweep_start_deg, sweep_range_deg;  // Needle sweep (LVGL angles)
+
+  constexpr float inv_span() const { return 1.0f / (max - min); }
+  constexpr int32_t scale() const { return decimals == 0 ? 1 : decimals == 1 ? 10 : decimals == 2 ? 100 : 1000; }
+};
+
+// Indexed by GaugeMode
+constexpr GaugeDesc GAUGES[] = {
+  { "BOOST", "psi", -15,  30, true,   0, 20, 0.5f, 1, 0.24f, 40.0f, 0.05f, 135.0f, 270.0f },
+  { "AFR",   "AFR",   8,  22, true,  10, 15, 0.2f, 1, 0.24f, 40.0f, 0.05f, 135.0f, 270.0f },
+  { "WATER", "C",     0, 120, false,  0,  0, 0.0f, 1, 0.24f, 40.0f, 0.05f, 135.0f, 270.0f },
+  { "OIL P", "psi",   0, 100, false,  0,  0, 0.0f, 1, 0.24f, 40.0f, 0.05f, 135.0f, 270.0f },
+};
+constexpr int GAUGE_COUNT = sizeof(GAUGES) / sizeof(GAUGES[0]);
+
+// The needle LUT and sprites are built once for all modes
+constexpr bool gauges_share_sweep() {
+  for (int i = 1; i < GAUGE_COUNT; i++) {
+    if (GAUGES[i].sweep_start_deg != GAUGES[0].sweep_start_deg ||
+        GAUGES[i].sweep_range_deg != GAUGES[0].sweep_range_deg) return false;
+  }
+  return true;
+}
+static_assert(gauges_share_sweep(), "Needle LUT is shared: every mode needs the same sweep");
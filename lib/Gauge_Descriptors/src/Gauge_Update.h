@@ -0,0 +1,61 @@
+#pragma once
+#include <math.h>
+#include "Gauge_Descriptors.h"
+
+// The per-frame gauge arithmetic: value filter, peak hold and colour zone,
+// plus the fixed-point value and needle position handed to the UI. No LVGL,
+// so host tests run the same code as the firmware. Inlined with a constexpr
+// GaugeDesc (update_gauge<M>() in main.cpp) every descriptor field is a
+// constant; with GAUGES[mode] it is the table-driven runtime path.
+typedef struct {
+  float target, displayed, peak;
+  unsigned long peak_timer;
+  unsigned long last_update_ms;   // Shared by all modes: dt spans a mode switch
+  int zone;                       // 0 low, 1 mid, 2 high
+} gauge_state_t;
+
+// Zone 0/1/2 = low/mid/high. A zone only changes once the value is `hyst`
+// past the threshold, so readings sitting on a boundary don't flicker the ring.
+// Each threshold is tested on its own, so a jump across both (2 -> 0 or
+// 0 -> 2) lands in the middle zone unless it is also `hyst` past the far one.
+static inline int zone_with_hysteresis(float v, float t_low, float t_high, float hyst, int prev) {
+  int z = prev;
+  if (z == 0 && v >= t_low + hyst) z = 1;
+  if (z == 1 && v >= t_high + hyst) z = 2;
+  if (z == 2 && v < t_high - hyst) z = 1;
+  if (z == 1 && v < t_low - hyst) z = 0;
+  return z;
+}
+
+static inline int gauge_zone(const GaugeDesc &G, float v, int prev) {
+  return G.zoned ? zone_with_hysteresis(v, G.zone_low, G.zone_high, G.zone_hyst, prev) : 1;
+}
+
+// Time-aware smoothing with a per-frame clamp to avoid large jumps
+static inline void gauge_step(const GaugeDesc &G, gauge_state_t *s, float reading, unsigned long now_ms,
+                              bool peak_hold, unsigned long peak_hold_ms) {
+  s->target = reading;
+  float dt = s->last_update_ms ? (now_ms - s->last_update_ms) * 0.001f : (1.0f/30.0f);
+  s->last_update_ms = now_ms;
+  float delta = s->target - s->displayed;
+  if (fabsf(delta) < G.snap) {
+    s->displayed = s->target;
+  } else {
+    float step = delta * G.smoothing;
+    float max_step = G.max_rate * dt;
+    if (fabsf(step) > max_step) step = (step > 0) ? max_step : -max_step;
+    s->displayed += step;
+  }
+
+  if (peak_hold) {
+    if (s->target > s->peak) { s->peak = s->target; s->peak_timer = now_ms; }
+    if (now_ms - s->peak_timer > peak_hold_ms) s->peak = s->target;
+  }
+  s->zone = gauge_zone(G, s->displayed, s->zone);
+}
+
+// Value display cells, in units of 10^-decimals
+static inline int32_t gauge_fixed(const GaugeDesc &G, float v) { return (int32_t)(v * G.scale()); }
+
+// 0..1 along the dial (needle LUT / arc fill)
+static inline float gauge_position(const GaugeDesc &G, float v) { return (v - G.min) * G.inv_span(); }
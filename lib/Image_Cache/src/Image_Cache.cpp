@@ -0,0 +1,172 @@
+#include "Image_Cache.h"
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include <string.h>
+
+typedef struct {
+  const img_pack_t *src;
+  uint8_t *buf;
+  lv_image_dsc_t dsc;
+  uint32_t last_use;
+} cache_slot_t;
+
+static cache_slot_t slots[IMAGE_CACHE_SLOTS];
+static image_cache_stats_t stats = { 0, 0, 0, 0, 0, 0, IMAGE_CACHE_DEF_BUDGET, 0, 0 };
+static uint32_t use_tick = 0;
+
+static bool unpack_rle(const uint8_t *in, uint32_t in_size, uint8_t *out, uint32_t out_size) {
+  const uint8_t *in_end = in + in_size;
+  uint8_t *out_end = out + out_size;
+  while (in < in_end) {
+    uint8_t ctrl = *in++;
+    uint32_t bytes = ((ctrl & 0x7F) + 1) * 2;
+    if (out + bytes > out_end) return false;
+    if (ctrl & 0x80) {
+      if (in + 2 > in_end) return false;
+      for (uint32_t i = 0; i < bytes; i += 2) { out[i] = in[0]; out[i + 1] = in[1]; }
+      in += 2;
+    } else {
+      if (in + bytes > in_end) return false;
+      memcpy(out, in, bytes);
+      in += bytes;
+    }
+    out += bytes;
+  }
+  return out == out_end;
+}
+
+static inline bool lz4_len(const uint8_t *&in, const uint8_t *in_end, uint32_t &len) {
+  if (len != 15) return true;
+  uint8_t b;
+  do {
+    if (in >= in_end) return false;
+    b = *in++;
+    len += b;
+  } while (b == 255);
+  return true;
+}
+
+static bool unpack_lz4(const uint8_t *in, uint32_t in_size, uint8_t *out, uint32_t out_size) {
+  const uint8_t *in_end = in + in_size;
+  uint8_t *op = out, *out_end = out + out_size;
+  while (in < in_end) {
+    uint8_t token = *in++;
+    uint32_t lit = token >> 4;
+    if (!lz4_len(in, in_end, lit)) return false;
+    if (in + lit > in_end || op + lit > out_end) return false;
+    memcpy(op, in, lit);
+    in += lit; op += lit;
+    if (in >= in_end) break;             // Last sequence is literals only
+    if (in + 2 > in_end) return false;
+    uint32_t offset = in[0] | (in[1] << 8);
+    in += 2;
+    if (offset == 0 || offset > (uint32_t)(op - out)) return false;
+    uint32_t mlen = token & 0x0F;
+    if (!lz4_len(in, in_end, mlen)) return false;
+    mlen += 4;
+    if (op + mlen > out_end) return false;
+    const uint8_t *match = op - offset;
+    if (offset >= mlen) { memcpy(op, match, mlen); op += mlen; }
+    else { while (mlen--) *op++ = *match++; }   // Overlapping copy repeats the pattern
+  }
+  return op == out_end;
+}
+
+bool img_unpack(const img_pack_t *src, uint8_t *dst) {
+  switch (src->method) {
+    case IMG_PACK_RAW:
+      if (src->packed_size != src->raw_size) return false;
+      memcpy(dst, src->data, src->raw_size);
+      return true;
+    case IMG_PACK_RLE: return unpack_rle(src->data, src->packed_size, dst, src->raw_size);
+    case IMG_PACK_LZ4: return unpack_lz4(src->data, src->packed_size, dst, src->raw_size);
+  }
+  return false;
+}
+
+static void free_slot(cache_slot_t *s) {
+  heap_caps_free(s->buf);
+  stats.bytes_used -= s->src->raw_size;
+  stats.entries--;
+  memset(s, 0, sizeof(*s));
+}
+
+// Evict least recently used entries until `need` more bytes fit and a slot is free
+static cache_slot_t *make_room(uint32_t need) {
+  while (true) {
+    cache_slot_t *free_s = NULL, *lru = NULL;
+    for (int i = 0; i < IMAGE_CACHE_SLOTS; i++) {
+      cache_slot_t *s = &slots[i];
+      if (!s->src) { if (!free_s) free_s = s; continue; }
+      if (!lru || s->last_use < lru->last_use) lru = s;
+    }
+    if (free_s && stats.bytes_used + need <= stats.budget) return free_s;
+    if (!lru) return NULL;
+    free_slot(lru);
+    stats.evictions++;
+  }
+}
+
+const lv_image_dsc_t *image_cache_get(const img_pack_t *src) {
+  for (int i = 0; i < IMAGE_CACHE_SLOTS; i++) {
+    if (slots[i].src == src) {
+      slots[i].last_use = ++use_tick;
+      stats.hits++;
+      return &slots[i].dsc;
+    }
+  }
+  stats.misses++;
+  if (src->raw_size > stats.budget) {
+    printf("Image_Cache: %ux%u image exceeds cache budget!\n", src->w, src->h);
+    stats.failures++;
+    return NULL;
+  }
+  cache_slot_t *s = make_room(src->raw_size);
+  uint8_t *buf = s ? (uint8_t *)heap_caps_malloc(src->raw_size, MALLOC_CAP_SPIRAM) : NULL;
+  if (!buf) {
+    printf("Image_Cache: Failed to allocate image buffer!\n");
+    stats.failures++;
+    return NULL;
+  }
+  int64_t t0 = esp_timer_get_time();
+  if (!img_unpack(src, buf)) {
+    printf("Image_Cache: Corrupt image data!\n");
+    heap_caps_free(buf);
+    stats.failures++;
+    return NULL;
+  }
+  stats.last_decode_us = (uint32_t)(esp_timer_get_time() - t0);
+  stats.total_decode_us += stats.last_decode_us;
+
+  s->src = src;
+  s->buf = buf;
+  s->last_use = ++use_tick;
+  memset(&s->dsc, 0, sizeof(s->dsc));
+  s->dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
+  s->dsc.header.cf = src->cf;
+  s->dsc.header.w = src->w;
+  s->dsc.header.h = src->h;
+  s->dsc.data_size = src->raw_size;
+  s->dsc.data = buf;
+  stats.bytes_used += src->raw_size;
+  stats.entries++;
+  return &s->dsc;
+}
+
+void image_cache_drop(const img_pack_t *src) {
+  for (int i = 0; i < IMAGE_CACHE_SLOTS; i++)
+    if (slots[i].src == src) free_slot(&slots[i]);
+}
+
+void image_cache_set_budget(uint32_t bytes) {
+  stats.budget = bytes;
+  while (stats.bytes_used > stats.budget) {
+    cache_slot_t *lru = NULL;
+    for (int i = 0; i < IMAGE_CACHE_SLOTS; i++)
+      if (slots[i].src && (!lru || slots[i].last_use < lru->last_use)) lru = &slots[i];
+    free_slot(lru);
+    stats.evictions++;
+  }
+}
+
+image_cache_stats_t image_cache_stats() { return stats; }
@@ -0,0 +1,41 @@
+#pragma once
+#include <lvgl.h>
+
+// Images stored compressed in flash (tools/img_pack.py) and decompressed once
+// into PSRAM on first use. The cache hands out plain lv_image_dsc_t's, so LVGL
+// draws straight from raw pixels with no per-frame decode.
+#define IMAGE_CACHE_SLOTS       8
+#define IMAGE_CACHE_DEF_BUDGET  (1536 * 1024)   // Bytes of decoded pixels kept in PSRAM
+
+typedef enum {
+  IMG_PACK_RAW = 0,
+  IMG_PACK_RLE = 1,   // 16-bit units: ctrl byte, bit 7 = run, bits 0-6 = count - 1
+  IMG_PACK_LZ4 = 2,   // Single LZ4 block (no frame header)
+} img_pack_method_t;
+
+typedef struct {
+  uint16_t w, h;
+  uint8_t cf;             // lv_color_format_t of the decoded data
+  uint8_t method;         // img_pack_method_t
+  uint32_t raw_size;
+  uint32_t packed_size;
+  const uint8_t *data;
+} img_pack_t;
+
+typedef struct {
+  uint32_t hits, misses, evictions, failures;
+  uint32_t entries;
+  uint32_t bytes_used, budget;
+  uint32_t last_decode_us, total_decode_us;
+} image_cache_stats_t;
+
+// Decode into dst (raw_size bytes); false on a corrupt or truncated stream
+bool img_unpack(const img_pack_t *src, uint8_t *dst);
+
+// Decoded image, or NULL if it cannot fit. Least recently used entries are
+// evicted to stay within the budget, so re-fetch rather than hold the pointer
+// across calls that may load other images.
+const lv_image_dsc_t *image_cache_get(const img_pack_t *src);
+void image_cache_drop(const img_pack_t *src);
+void image_cache_set_budget(uint32_t bytes);
+image_cache_stats_t image_cache_stats();
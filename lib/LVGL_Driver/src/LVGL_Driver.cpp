@@ -1,5 +1,6 @@
 #include "LVGL_Driver.h"
 #include "Display_ST7701.h"
+#include <esp_cpu.h>
 
 // Buffer Size: 1/20th of the screen (~23KB per buffer)
 // Stable, low memory footprint, safe for SRAM.
@@ -7,12 +8,17 @@
 
 static lv_color_t *buf1 = NULL;
 static lv_color_t *buf2 = NULL;
+static lvgl_flush_hook_t flush_hook = NULL;
+
+void lvgl_set_flush_hook(lvgl_flush_hook_t hook) { flush_hook = hook; }
 
 void lvgl_flush_callback(lv_display_t *disp, const lv_area_t *area, uint8_t *color_p) {
+    uint32_t start = esp_cpu_get_cycle_count();
     if (panel_handle != NULL) {
         // Copy SRAM -> PSRAM (LCD Framebuffer)
         esp_lcd_panel_draw_bitmap(panel_handle, area->x1, area->y1, area->x2 + 1, area->y2 + 1, (const void*)color_p);
     }
+    if (flush_hook) flush_hook(area, esp_cpu_get_cycle_count() - start);
     lv_display_flush_ready(disp);
 }
 
@@ -14,5 +14,10 @@
    #define LCD_HEIGHT 480
    #endif
 
+   // Optional observer called after each flushed area with the CPU cycles the
+   // copy into the panel framebuffer took (render statistics / profiler)
+   typedef void (*lvgl_flush_hook_t)(const lv_area_t *area, uint32_t copy_cycles);
+   void lvgl_set_flush_hook(lvgl_flush_hook_t hook);
+
    void lvgl_flush_callback(lv_display_t *disp, const lv_area_t *area, uint8_t *color_p);
    void lvgl_init(void);
\ No newline at end of file
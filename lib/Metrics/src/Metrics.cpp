@@ -0,0 +1,109 @@
+#include "Metrics.h"
+#include <stdio.h>
+#include <string.h>
+
+static metric_t registry[METRICS_MAX];
+static int metric_count = 0;
+
+static inline uint32_t float_bits(float v) { uint32_t b; memcpy(&b, &v, 4); return b; }
+static inline float bits_float(uint32_t b) { float v; memcpy(&v, &b, 4); return v; }
+
+static metric_t *metric_register(const char *name, const char *help, metric_type_t type) {
+  if (metric_count >= METRICS_MAX) {
+    printf("Metrics: Registry full, %s not registered!\n", name);
+    return NULL;
+  }
+  metric_t *m = &registry[metric_count++];
+  memset(m, 0, sizeof(*m));
+  m->name = name;
+  m->help = help;
+  m->type = type;
+  return m;
+}
+
+metric_t *metric_counter(const char *name, const char *help) { return metric_register(name, help, METRIC_COUNTER); }
+metric_t *metric_gauge(const char *name, const char *help) { return metric_register(name, help, METRIC_GAUGE); }
+
+metric_t *metric_histogram(const char *name, const char *help, const float *bounds, int n_bounds) {
+  if (n_bounds > METRIC_MAX_BUCKETS) n_bounds = METRIC_MAX_BUCKETS;
+  metric_t *m = metric_register(name, help, METRIC_HISTOGRAM);
+  if (m) { m->bounds = bounds; m->n_bounds = n_bounds; }
+  return m;
+}
+
+void metric_add(metric_t *m, uint32_t n) {
+  if (m) __atomic_fetch_add(&m->value, n, __ATOMIC_RELAXED);
+}
+
+void metric_set(metric_t *m, float v) {
+  if (m) __atomic_store_n(&m->value, float_bits(v), __ATOMIC_RELAXED);
+}
+
+void metric_observe(metric_t *m, float v) {
+  if (!m) return;
+  int b = 0;
+  while (b < m->n_bounds && v > m->bounds[b]) b++;
+  __atomic_fetch_add(&m->buckets[b], 1, __ATOMIC_RELAXED);
+  __atomic_fetch_add(&m->count, 1, __ATOMIC_RELAXED);
+  // Float sum via compare-and-swap on its bit pattern
+  uint32_t old_bits = __atomic_load_n(&m->sum_bits, __ATOMIC_RELAXED);
+  uint32_t new_bits;
+  do {
+    new_bits = float_bits(bits_float(old_bits) + v);
+  } while (!__atomic_compare_exchange_n(&m->sum_bits, &old_bits, new_bits, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+// Append with snprintf semantics, never running past the buffer
+#define APPEND(...) do { if (n < size) n += snprintf(buf + n, size - n, __VA_ARGS__); } while (0)
+
+size_t metrics_format_prometheus(char *buf, size_t size) {
+  size_t n = 0;
+  if (size) buf[0] = 0;
+  for (int i = 0; i < metric_count; i++) {
+    const metric_t *m = &registry[i];
+    uint32_t v = __atomic_load_n(&m->value, __ATOMIC_RELAXED);
+    static const char *TYPES[] = { "counter", "gauge", "histogram" };
+    APPEND("# HELP %s %s\n# TYPE %s %s\n", m->name, m->help, m->name, TYPES[m->type]);
+    if (m->type == METRIC_COUNTER) {
+      APPEND("%s %u\n", m->name, (unsigned)v);
+    } else if (m->type == METRIC_GAUGE) {
+      APPEND("%s %g\n", m->name, bits_float(v));
+    } else {
+      uint32_t cum = 0;
+      for (int b = 0; b <= m->n_bounds; b++) {
+        cum += __atomic_load_n(&m->buckets[b], __ATOMIC_RELAXED);
+        if (b < m->n_bounds) APPEND("%s_bucket{le=\"%g\"} %u\n", m->name, m->bounds[b], (unsigned)cum);
+        else APPEND("%s_bucket{le=\"+Inf\"} %u\n", m->name, (unsigned)cum);
+      }
+      APPEND("%s_sum %g\n%s_count %u\n", m->name, bits_float(__atomic_load_n(&m->sum_bits, __ATOMIC_RELAXED)),
+             m->name, (unsigned)__atomic_load_n(&m->count, __ATOMIC_RELAXED));
+    }
+  }
+  return n < size ? n : size - 1;
+}
+
+size_t metrics_format_json(char *buf, size_t size) {
+  size_t n = 0;
+  if (size) buf[0] = 0;
+  APPEND("{");
+  for (int i = 0; i < metric_count; i++) {
+    const metric_t *m = &registry[i];
+    uint32_t v = __atomic_load_n(&m->value, __ATOMIC_RELAXED);
+    APPEND("%s\"%s\":", i ? "," : "", m->name);
+    if (m->type == METRIC_COUNTER) {
+      APPEND("%u", (unsigned)v);
+    } else if (m->type == METRIC_GAUGE) {
+      APPEND("%g", bits_float(v));
+    } else {
+      // {"le":[bounds],"b":[per-bucket counts, last = +Inf],"sum":s,"count":c}
+      APPEND("{\"le\":[");
+      for (int b = 0; b < m->n_bounds; b++) APPEND("%s%g", b ? "," : "", m->bounds[b]);
+      APPEND("],\"b\":[");
+      for (int b = 0; b <= m->n_bounds; b++) APPEND("%s%u", b ? "," : "", (unsigned)__atomic_load_n(&m->buckets[b], __ATOMIC_RELAXED));
+      APPEND("],\"sum\":%g,\"count\":%u}", bits_float(__atomic_load_n(&m->sum_bits, __ATOMIC_RELAXED)),
+             (unsigned)__atomic_load_n(&m->count, __ATOMIC_RELAXED));
+    }
+  }
+  APPEND("}");
+  return n < size ? n : size - 1;
+}
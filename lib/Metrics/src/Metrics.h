@@ -0,0 +1,37 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Counters, gauges and fixed-bucket histograms. Register everything once at
+// boot; updates are lock-free 32-bit atomics, safe from any task or callback
+// (CAN tasks, render loop, ESP-NOW). Exported as Prometheus text or compact JSON.
+#define METRICS_MAX         32
+#define METRIC_MAX_BUCKETS  10
+
+typedef enum { METRIC_COUNTER, METRIC_GAUGE, METRIC_HISTOGRAM } metric_type_t;
+
+typedef struct {
+  const char *name;
+  const char *help;
+  metric_type_t type;
+  uint32_t value;                           // Counter total, or gauge float bits
+  const float *bounds;                      // Histogram upper bounds, ascending
+  uint8_t n_bounds;
+  uint32_t buckets[METRIC_MAX_BUCKETS + 1]; // Non-cumulative; last is +Inf
+  uint32_t count;
+  uint32_t sum_bits;                        // Float sum of observations
+} metric_t;
+
+// NULL when the registry is full
+metric_t *metric_counter(const char *name, const char *help);
+metric_t *metric_gauge(const char *name, const char *help);
+metric_t *metric_histogram(const char *name, const char *help, const float *bounds, int n_bounds);
+
+void metric_add(metric_t *m, uint32_t n);
+static inline void metric_inc(metric_t *m) { metric_add(m, 1); }
+void metric_set(metric_t *m, float v);
+void metric_observe(metric_t *m, float v);
+
+// Formatted into buf; returns the length written (truncated at size - 1)
+size_t metrics_format_prometheus(char *buf, size_t size);
+size_t metrics_format_json(char *buf, size_t size);
@@ -0,0 +1,68 @@
+#include "Needle_LUT.h"
+#include <math.h>
+
+static needle_seg_t needle_lut[NEEDLE_LUT_STEPS + 1];
+static int16_t needle_dir[NEEDLE_LUT_STEPS + 1][2];   // cos, sin in Q14
+static int lut_cx, lut_cy;
+
+void needle_lut_init(int center_x, int center_y, int radius_start, int radius_end,
+                     float angle_start_deg, float angle_range_deg) {
+  lut_cx = center_x; lut_cy = center_y;
+  for (int i = 0; i <= NEEDLE_LUT_STEPS; i++) {
+    float angle_deg = angle_start_deg + angle_range_deg * i / NEEDLE_LUT_STEPS;
+    float angle_rad = angle_deg * M_PI / 180.0f;
+    float c = cosf(angle_rad);
+    float s = sinf(angle_rad);
+    // Same truncation as the old per-frame maths so the needle lands on the same pixels
+    needle_lut[i].x0 = center_x + (int)(radius_start * c);
+    needle_lut[i].y0 = center_y + (int)(radius_start * s);
+    needle_lut[i].x1 = center_x + (int)(radius_end * c);
+    needle_lut[i].y1 = center_y + (int)(radius_end * s);
+    needle_dir[i][0] = (int16_t)lroundf(c * 16384.0f);
+    needle_dir[i][1] = (int16_t)lroundf(s * 16384.0f);
+  }
+}
+
+uint16_t needle_lut_index(float normalized) {
+  if (normalized <= 0.0f) return 0;
+  if (normalized >= 1.0f) return NEEDLE_LUT_STEPS;
+  return (uint16_t)(normalized * NEEDLE_LUT_STEPS + 0.5f);
+}
+
+const needle_seg_t *needle_lut_get(uint16_t idx) {
+  if (idx > NEEDLE_LUT_STEPS) idx = NEEDLE_LUT_STEPS;
+  return &needle_lut[idx];
+}
+
+void needle_lut_point(uint16_t idx, int radius, int32_t *x, int32_t *y) {
+  if (idx > NEEDLE_LUT_STEPS) idx = NEEDLE_LUT_STEPS;
+  *x = lut_cx + ((radius * needle_dir[idx][0] + 8192) >> 14);
+  *y = lut_cy + ((radius * needle_dir[idx][1] + 8192) >> 14);
+}
+
+bool needle_seg_equal(const needle_seg_t *a, const needle_seg_t *b) {
+  return a->x0 == b->x0 && a->y0 == b->y0 && a->x1 == b->x1 && a->y1 == b->y1;
+}
+
+int needle_seg_areas(const needle_seg_t *seg, int line_width, lv_area_t *out) {
+  int pad = line_width / 2 + 1;  // Half the stroke plus one for anti-aliasing
+  int dx = seg->x1 - seg->x0;
+  int dy = seg->y1 - seg->y0;
+  for (int i = 0; i < NEEDLE_INV_SLICES; i++) {
+    int ax = seg->x0 + dx * i / NEEDLE_INV_SLICES;
+    int ay = seg->y0 + dy * i / NEEDLE_INV_SLICES;
+    int bx = seg->x0 + dx * (i + 1) / NEEDLE_INV_SLICES;
+    int by = seg->y0 + dy * (i + 1) / NEEDLE_INV_SLICES;
+    out[i].x1 = LV_MIN(ax, bx) - pad;
+    out[i].y1 = LV_MIN(ay, by) - pad;
+    out[i].x2 = LV_MAX(ax, bx) + pad;
+    out[i].y2 = LV_MAX(ay, by) + pad;
+  }
+  return NEEDLE_INV_SLICES;
+}
+
+void needle_invalidate(lv_obj_t *obj, const needle_seg_t *seg, int line_width) {
+  lv_area_t areas[NEEDLE_INV_SLICES];
+  int n = needle_seg_areas(seg, line_width, areas);
+  for (int i = 0; i < n; i++) lv_obj_invalidate_area(obj, &areas[i]);
+}
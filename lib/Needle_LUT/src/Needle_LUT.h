@@ -0,0 +1,29 @@
+#pragma once
+#include <lvgl.h>
+
+// Angular resolution of the needle: ~1 px of travel at the 225 px tip across a 270 deg sweep
+#define NEEDLE_LUT_STEPS      1024
+#define NEEDLE_INV_SLICES     3       // Tight rects per needle when invalidating
+
+typedef struct {
+  int16_t x0, y0;   // Inner end
+  int16_t x1, y1;   // Tip
+} needle_seg_t;
+
+// Build the angle -> endpoint table once (trig only runs here)
+void needle_lut_init(int center_x, int center_y, int radius_start, int radius_end,
+                     float angle_start_deg, float angle_range_deg);
+
+// Quantise a 0..1 position to a table index (clamped)
+uint16_t needle_lut_index(float normalized);
+const needle_seg_t *needle_lut_get(uint16_t idx);
+// Point at any radius along step idx (same centre and angle as the needle)
+void needle_lut_point(uint16_t idx, int radius, int32_t *x, int32_t *y);
+bool needle_seg_equal(const needle_seg_t *a, const needle_seg_t *b);
+
+// Split the needle into NEEDLE_INV_SLICES small boxes padded for the line width.
+// Returns the number of areas written to out.
+int needle_seg_areas(const needle_seg_t *seg, int line_width, lv_area_t *out);
+
+// Invalidate tight rects around a needle drawn on obj (screen coordinates)
+void needle_invalidate(lv_obj_t *obj, const needle_seg_t *seg, int line_width);
@@ -0,0 +1,86 @@
+#include "Needle_Rotate.h"
+#include <math.h>
+
+static inline uint8_t sample_a8(const uint8_t *a8, int w, int h, float x, float y) {
+  int x0 = (int)floorf(x), y0 = (int)floorf(y);
+  float fx = x - x0, fy = y - y0;
+  uint8_t p[4];
+  for (int i = 0; i < 4; i++) {
+    int sx = x0 + (i & 1), sy = y0 + (i >> 1);
+    p[i] = (sx >= 0 && sy >= 0 && sx < w && sy < h) ? a8[sy * w + sx] : 0;
+  }
+  float top = p[0] + (p[1] - p[0]) * fx;
+  float bot = p[2] + (p[3] - p[2]) * fx;
+  return (uint8_t)(top + (bot - top) * fy + 0.5f);
+}
+
+bool needle_art_init(needle_art_t *art, const uint8_t *a8, int w, int h, int pivot_x, int pivot_y) {
+  int bx1 = w, by1 = h, bx2 = -1, by2 = -1;
+  for (int y = 0; y < h; y++)
+    for (int x = 0; x < w; x++)
+      if (a8[y * w + x]) {
+        if (x < bx1) bx1 = x;
+        if (x > bx2) bx2 = x;
+        if (y < by1) by1 = y;
+        if (y > by2) by2 = y;
+      }
+  if (bx2 < 0) return false;
+  *art = { a8, w, h, pivot_x, pivot_y, bx1, by1, bx2, by2 };
+  return true;
+}
+
+int needle_rotate_scratch_size(const needle_art_t *art) {
+  // Worst-case rotation of the covered box padded for the bilinear fringe
+  float bw = art->x2 - art->x1 + 3, bh = art->y2 - art->y1 + 3;
+  int diag = (int)ceilf(sqrtf(bw * bw + bh * bh)) + 2;
+  return diag * diag;
+}
+
+void needle_rotate(const needle_art_t *art, float angle_deg, int center_x, int center_y,
+                   uint8_t *scratch, needle_rot_t *out) {
+  float a = angle_deg * M_PI / 180.0f;
+  float c = cosf(a), s = sinf(a);
+
+  // Corners relative to the pivot, padded a pixel for the bilinear fringe
+  float cu[4] = { (float)(art->x1 - 1 - art->pivot_x), (float)(art->x2 + 2 - art->pivot_x),
+                  (float)(art->x1 - 1 - art->pivot_x), (float)(art->x2 + 2 - art->pivot_x) };
+  float cv[4] = { (float)(art->y1 - 1 - art->pivot_y), (float)(art->y1 - 1 - art->pivot_y),
+                  (float)(art->y2 + 2 - art->pivot_y), (float)(art->y2 + 2 - art->pivot_y) };
+
+  // Screen box of the rotated artwork box
+  float x1 = 1e9f, y1 = 1e9f, x2 = -1e9f, y2 = -1e9f;
+  for (int k = 0; k < 4; k++) {
+    float x = cu[k] * c - cv[k] * s, y = cu[k] * s + cv[k] * c;
+    x1 = fminf(x1, x); x2 = fmaxf(x2, x);
+    y1 = fminf(y1, y); y2 = fmaxf(y2, y);
+  }
+  int ox = center_x + (int)floorf(x1), oy = center_y + (int)floorf(y1);
+  int bw = center_x + (int)ceilf(x2) - ox, bh = center_y + (int)ceilf(y2) - oy;
+
+  // Inverse-rotate each destination pixel centre into the artwork, tracking coverage
+  int cx1 = bw, cy1 = bh, cx2 = -1, cy2 = -1;
+  for (int y = 0; y < bh; y++) {
+    float dy = oy + y + 0.5f - center_y;
+    for (int x = 0; x < bw; x++) {
+      float dx = ox + x + 0.5f - center_x;
+      float u = dx * c + dy * s, v = -dx * s + dy * c;
+      uint8_t cov = sample_a8(art->a8, art->w, art->h, art->pivot_x + u - 0.5f, art->pivot_y + v - 0.5f);
+      scratch[y * bw + x] = cov;
+      if (cov) {
+        if (x < cx1) cx1 = x;
+        if (x > cx2) cx2 = x;
+        if (y < cy1) cy1 = y;
+        if (y > cy2) cy2 = y;
+      }
+    }
+  }
+
+  // Keep only the covered box: a diagonal needle's bounding box is mostly empty
+  if (cx2 < 0) cx1 = cy1 = cx2 = cy2 = 0;
+  out->x = ox + cx1;
+  out->y = oy + cy1;
+  out->w = cx2 - cx1 + 1;
+  out->h = cy2 - cy1 + 1;
+  out->px = scratch + cy1 * bw + cx1;
+  out->stride = bw;
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <stdint.h>
+
+// Rotation of the needle artwork's A8 coverage for Needle_Sprites. No LVGL,
+// so host tests run the same code as the firmware. Each destination pixel
+// centre is rotated back into the artwork and sampled bilinearly.
+typedef struct {
+  const uint8_t *a8;            // Coverage pointing along +x, stride w
+  int w, h;
+  int pivot_x, pivot_y;
+  int x1, y1, x2, y2;           // Covered box of the artwork
+} needle_art_t;
+
+typedef struct {
+  int x, y, w, h;               // Screen rectangle of the covered pixels
+  const uint8_t *px;            // Its first pixel, inside the scratch buffer
+  int stride;
+} needle_rot_t;
+
+// Crops the artwork to its covered pixels, so empty arm space costs nothing.
+// False if nothing is covered.
+bool needle_art_init(needle_art_t *art, const uint8_t *a8, int w, int h, int pivot_x, int pivot_y);
+
+// Scratch bytes needle_rotate() needs at any angle
+int needle_rotate_scratch_size(const needle_art_t *art);
+
+// The artwork turned by angle_deg about its pivot, with the pivot placed at
+// (center_x, center_y). out is cropped to the covered pixels (1x1 if none).
+void needle_rotate(const needle_art_t *art, float angle_deg, int center_x, int center_y,
+                   uint8_t *scratch, needle_rot_t *out);
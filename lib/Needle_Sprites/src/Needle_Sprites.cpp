@@ -0,0 +1,95 @@
+#include "Needle_Sprites.h"
+#include "Needle_Rotate.h"
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include <string.h>
+
+static lv_image_dsc_t *sprites = NULL;   // Per-step descriptors, one PSRAM block of A8 each
+static lv_area_t *sprite_areas = NULL;   // Screen rectangle of each sprite
+static bool ready = false;
+
+bool needle_sprites_init(const uint8_t *a8, int w, int h, int pivot_x, int pivot_y,
+                         int center_x, int center_y, float angle_start_deg, float angle_range_deg) {
+  if (needle_sprites_ready()) return true;
+  int64_t t0 = esp_timer_get_time();
+
+  needle_art_t art;
+  if (!needle_art_init(&art, a8, w, h, pivot_x, pivot_y)) {
+    printf("Needle_Sprites: Needle artwork is empty!\n");
+    return false;
+  }
+
+  sprites = (lv_image_dsc_t *)heap_caps_calloc(NEEDLE_SPRITE_COUNT, sizeof(lv_image_dsc_t), MALLOC_CAP_SPIRAM);
+  sprite_areas = (lv_area_t *)heap_caps_malloc(NEEDLE_SPRITE_COUNT * sizeof(lv_area_t), MALLOC_CAP_SPIRAM);
+  if (!sprites || !sprite_areas) {
+    printf("Needle_Sprites: Failed to allocate sprite table!\n");
+    needle_sprites_free();
+    return false;
+  }
+
+  uint8_t *scratch = (uint8_t *)heap_caps_malloc(needle_rotate_scratch_size(&art), MALLOC_CAP_SPIRAM);
+  if (!scratch) {
+    printf("Needle_Sprites: Failed to allocate scratch buffer!\n");
+    needle_sprites_free();
+    return false;
+  }
+
+  uint32_t total = 0;
+  for (int i = 0; i < NEEDLE_SPRITE_COUNT; i++) {
+    needle_rot_t rot;
+    needle_rotate(&art, angle_start_deg + angle_range_deg * i / NEEDLE_LUT_STEPS, center_x, center_y, scratch, &rot);
+    uint8_t *px = (uint8_t *)heap_caps_malloc(rot.w * rot.h, MALLOC_CAP_SPIRAM);
+    if (!px) {
+      printf("Needle_Sprites: Failed to allocate sprite %d!\n", i);
+      heap_caps_free(scratch);
+      needle_sprites_free();
+      return false;
+    }
+    for (int y = 0; y < rot.h; y++) memcpy(px + y * rot.w, rot.px + y * rot.stride, rot.w);
+    total += rot.w * rot.h;
+
+    lv_area_t *ar = &sprite_areas[i];
+    ar->x1 = rot.x; ar->y1 = rot.y;
+    ar->x2 = rot.x + rot.w - 1; ar->y2 = rot.y + rot.h - 1;
+    lv_image_dsc_t *d = &sprites[i];
+    d->header.magic = LV_IMAGE_HEADER_MAGIC;
+    d->header.cf = LV_COLOR_FORMAT_A8;
+    d->header.w = rot.w;
+    d->header.h = rot.h;
+    d->header.stride = rot.w;
+    d->data_size = rot.w * rot.h;
+    d->data = px;
+  }
+  heap_caps_free(scratch);
+  __atomic_store_n(&ready, true, __ATOMIC_RELEASE);   // Publishes the finished table to the UI task
+  printf("Needle_Sprites: %d sprites, %u bytes, built in %u ms\n", NEEDLE_SPRITE_COUNT,
+         (unsigned)total, (unsigned)((esp_timer_get_time() - t0) / 1000));
+  return true;
+}
+
+bool needle_sprites_ready() { return __atomic_load_n(&ready, __ATOMIC_ACQUIRE); }
+
+void needle_sprites_free() {
+  __atomic_store_n(&ready, false, __ATOMIC_RELEASE);
+  if (sprites) {
+    for (int i = 0; i < NEEDLE_SPRITE_COUNT; i++) {
+      if (sprites[i].data) heap_caps_free((void *)sprites[i].data);
+    }
+    heap_caps_free(sprites);
+    sprites = NULL;
+  }
+  if (sprite_areas) heap_caps_free(sprite_areas);
+  sprite_areas = NULL;
+}
+
+const lv_image_dsc_t *needle_sprite_get(uint16_t idx, lv_area_t *area) {
+  if (idx > NEEDLE_LUT_STEPS) idx = NEEDLE_LUT_STEPS;
+  *area = sprite_areas[idx];
+  return &sprites[idx];
+}
+
+void needle_sprite_invalidate(lv_obj_t *obj, uint16_t idx) {
+  if (!needle_sprites_ready()) return;
+  if (idx > NEEDLE_LUT_STEPS) idx = NEEDLE_LUT_STEPS;
+  lv_obj_invalidate_area(obj, &sprite_areas[idx]);
+}
@@ -0,0 +1,23 @@
+#pragma once
+#include <lvgl.h>
+#include "Needle_LUT.h"
+
+// Image needle pre-rotated once into an atlas of A8 sprites (PSRAM),
+// one per Needle_LUT step, each cropped to its own bounding box. Drawing is a
+// plain recoloured A8 blit and only the old/new sprite boxes are invalidated,
+// so an image needle costs about the same as the line needle.
+#define NEEDLE_SPRITE_COUNT (NEEDLE_LUT_STEPS + 1)
+
+// a8: needle artwork coverage pointing along +x, rotated about (pivot_x, pivot_y)
+// and placed with the pivot at (center_x, center_y). Angles match needle_lut_init.
+// Touches no LVGL state, so it may run on a background task; the atlas is only
+// handed out once needle_sprites_ready() turns true.
+bool needle_sprites_init(const uint8_t *a8, int w, int h, int pivot_x, int pivot_y,
+                         int center_x, int center_y, float angle_start_deg, float angle_range_deg);
+bool needle_sprites_ready();
+// Release the atlas; the caller must have stopped drawing sprites first
+void needle_sprites_free();
+
+// Sprite for a Needle_LUT index; area receives its screen rectangle
+const lv_image_dsc_t *needle_sprite_get(uint16_t idx, lv_area_t *area);
+void needle_sprite_invalidate(lv_obj_t *obj, uint16_t idx);
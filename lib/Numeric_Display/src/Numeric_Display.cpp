@@ -0,0 +1,111 @@
+#include "Numeric_Display.h"
+
+static const int32_t POW10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+
+void numeric_format(int32_t value_scaled, uint8_t int_cells, uint8_t decimals, char *out) {
+  bool neg = value_scaled < 0;
+  uint32_t mag = neg ? -(uint32_t)value_scaled : (uint32_t)value_scaled;
+  uint32_t ip = mag / POW10[decimals];
+  uint32_t fp = mag % POW10[decimals];
+
+  // Clamp to what fits (one cell reserved for the sign when negative). With a
+  // single integer cell a negative value shows "-" there, e.g. -0.5 -> "-.50".
+  uint8_t digits = neg ? int_cells - 1 : int_cells;
+  if (ip >= (uint32_t)POW10[digits]) {
+    ip = POW10[digits] - 1;
+    fp = POW10[decimals] - 1;
+  }
+
+  int i = int_cells - 1;
+  if (digits) { do { out[i--] = '0' + ip % 10; ip /= 10; } while (ip && i >= 0); }
+  if (neg && i >= 0) out[i--] = '-';
+  while (i >= 0) out[i--] = ' ';
+
+  if (decimals) {
+    out[int_cells] = '.';
+    for (int d = decimals - 1; d >= 0; d--) { out[int_cells + 1 + d] = '0' + fp % 10; fp /= 10; }
+  }
+}
+
+static void numeric_display_draw_cb(lv_event_t *e) {
+  numeric_display_t *nd = (numeric_display_t *)lv_event_get_user_data(e);
+  lv_layer_t *layer = lv_event_get_layer(e);
+  lv_area_t coords;
+  lv_obj_get_coords(nd->obj, &coords);
+
+  lv_draw_image_dsc_t dsc;
+  lv_draw_image_dsc_init(&dsc);
+  dsc.recolor = lv_obj_get_style_text_color(nd->obj, LV_PART_MAIN);  // A8 tiles take the text colour
+  dsc.recolor_opa = LV_OPA_COVER;
+  for (int i = 0; i < nd->cell_count; i++) {
+    const numeric_cell_t *cell = &nd->cells[i];
+    const lv_image_dsc_t *img = digit_cache_get(cell->cache, cell->ch);
+    if (!img) continue;  // Blank cell: background shows through
+    lv_area_t a = cell->area;
+    lv_area_move(&a, coords.x1, coords.y1);
+    a.x2 = a.x1 + img->header.w - 1;
+    a.y2 = a.y1 + img->header.h - 1;
+    dsc.src = img;
+    lv_draw_image(layer, &dsc, &a);
+  }
+}
+
+lv_obj_t *numeric_display_create(lv_obj_t *parent, numeric_display_t *nd,
+                                 const digit_cache_t *int_font, uint8_t int_cells,
+                                 const digit_cache_t *dec_font, uint8_t decimals, int32_t gap) {
+  if (decimals > 0 && int_cells + 1 + decimals > NUMERIC_MAX_CELLS) decimals = NUMERIC_MAX_CELLS - int_cells - 1;
+  nd->int_cells = int_cells;
+  nd->decimals = decimals;
+  nd->cell_count = decimals ? int_cells + 1 + decimals : int_cells;
+  nd->valid = false;
+
+  // All DSEG digits (and '-') share one advance, so '0' sizes every digit cell
+  int32_t cw = digit_cache_char_width(int_font, '0');
+  int32_t x = 0;
+  for (int i = 0; i < int_cells; i++) {
+    nd->cells[i] = { int_font, { x, 0, x + cw - 1, int_font->h - 1 }, ' ' };
+    x += cw;
+  }
+  nd->int_width = x;
+
+  if (decimals) {
+    // Decimal part is vertically centred on the integer part
+    int32_t y = (int_font->h - dec_font->h) / 2;
+    x += gap;
+    int32_t dot_w = digit_cache_char_width(dec_font, '.');
+    nd->cells[int_cells] = { dec_font, { x, y, x + dot_w - 1, y + dec_font->h - 1 }, ' ' };
+    x += dot_w;
+    int32_t dw = digit_cache_char_width(dec_font, '0');
+    for (int i = 0; i < decimals; i++) {
+      nd->cells[int_cells + 1 + i] = { dec_font, { x, y, x + dw - 1, y + dec_font->h - 1 }, ' ' };
+      x += dw;
+    }
+  }
+
+  nd->obj = lv_obj_create(parent);
+  lv_obj_remove_style_all(nd->obj);
+  lv_obj_clear_flag(nd->obj, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_set_size(nd->obj, x, int_font->h);
+  lv_obj_add_event_cb(nd->obj, numeric_display_draw_cb, LV_EVENT_DRAW_MAIN, nd);
+  return nd->obj;
+}
+
+void numeric_display_set(numeric_display_t *nd, int32_t value_scaled) {
+  if (nd->valid && value_scaled == nd->last_scaled) return;
+  nd->last_scaled = value_scaled;
+  nd->valid = true;
+
+  char buf[NUMERIC_MAX_CELLS];
+  numeric_format(value_scaled, nd->int_cells, nd->decimals, buf);
+
+  lv_area_t coords;
+  lv_obj_get_coords(nd->obj, &coords);
+  for (int i = 0; i < nd->cell_count; i++) {
+    numeric_cell_t *cell = &nd->cells[i];
+    if (cell->ch == buf[i]) continue;
+    cell->ch = buf[i];
+    lv_area_t a = cell->area;
+    lv_area_move(&a, coords.x1, coords.y1);
+    lv_obj_invalidate_area(nd->obj, &a);
+  }
+}
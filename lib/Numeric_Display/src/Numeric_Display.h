@@ -0,0 +1,39 @@
+#pragma once
+#include <lvgl.h>
+#include "Digit_Cache.h"
+
+// Fixed-cell numeric display: DSEG digits are monospaced, so every character
+// has a fixed cell and a value change only invalidates the cells that changed.
+// Layout: [int_cells, right-aligned] gap ['.'] [decimals]
+// Glyphs are drawn in the widget's text colour (style text_color) over
+// whatever is behind it.
+#define NUMERIC_MAX_CELLS 8
+
+typedef struct {
+  const digit_cache_t *cache;
+  lv_area_t area;               // Relative to the widget's top-left corner
+  char ch;                      // ' ' = blank
+} numeric_cell_t;
+
+typedef struct {
+  lv_obj_t *obj;
+  numeric_cell_t cells[NUMERIC_MAX_CELLS];
+  uint8_t cell_count;
+  uint8_t int_cells;
+  uint8_t decimals;
+  int32_t int_width;            // Width of the integer cells (for right-anchoring)
+  int32_t last_scaled;
+  bool valid;
+} numeric_display_t;
+
+lv_obj_t *numeric_display_create(lv_obj_t *parent, numeric_display_t *nd,
+                                 const digit_cache_t *int_font, uint8_t int_cells,
+                                 const digit_cache_t *dec_font, uint8_t decimals, int32_t gap);
+
+// value_scaled = value * 10^decimals, truncated toward zero
+void numeric_display_set(numeric_display_t *nd, int32_t value_scaled);
+
+// Integer-only formatting into int_cells + ('.' + decimals) chars, no stdio.
+// Overflowing values clamp to all nines; a negative value with one integer cell
+// shows just "-" there. out must hold NUMERIC_MAX_CELLS chars.
+void numeric_format(int32_t value_scaled, uint8_t int_cells, uint8_t decimals, char *out);
@@ -0,0 +1,225 @@
+#include "Redraw_Heatmap.h"
+#include <stdio.h>
+#include <string.h>
+
+#define HEAT_LEVELS 8
+
+// Redraws per second -> tint, from blue (occasional) to red (every frame)
+static const uint32_t HEAT_COLORS[HEAT_LEVELS] = {
+  0x000000, 0x1E3A8A, 0x2563EB, 0x10B981, 0x84CC16, 0xFACC15, 0xF97316, 0xDC2626
+};
+static const uint8_t HEAT_MIN_RATE[HEAT_LEVELS] = { 0, 1, 2, 4, 8, 15, 25, 40 };
+
+static lv_obj_t *overlay = NULL;
+static lv_obj_t *overlay_label = NULL;
+static int cols = 0, rows = 0;
+static bool recording = false, shown = false;
+static bool skip_frame = false;   // Refresh carrying the overlay's own repaint
+static bool self_inv = false;
+static bool frame_work = false;   // Anything flushed this refresh
+static uint32_t frame_seq = 1;
+static uint32_t window_start_ms = 0;
+
+static uint16_t cell_window[HEATMAP_MAX_CELLS];   // Redraws in the open window
+static uint16_t cell_stamp[HEATMAP_MAX_CELLS];    // Last frame counted (low 16 bits)
+static uint8_t cell_level[HEATMAP_MAX_CELLS];     // Shown on the overlay
+static uint32_t cell_total[HEATMAP_MAX_CELLS];    // Since heatmap_reset()
+static heatmap_totals_t window, last_second, total;
+
+static uint8_t rate_level(uint32_t rate) {
+  uint8_t l = 0;
+  while (l + 1 < HEAT_LEVELS && rate >= HEAT_MIN_RATE[l + 1]) l++;
+  return l;
+}
+
+static void cell_area(int i, lv_area_t *a) {
+  a->x1 = (i % cols) * HEATMAP_CELL;
+  a->y1 = (i / cols) * HEATMAP_CELL;
+  a->x2 = a->x1 + HEATMAP_CELL - 1;
+  a->y2 = a->y1 + HEATMAP_CELL - 1;
+}
+
+static void overlay_draw_cb(lv_event_t *e) {
+  lv_layer_t *layer = lv_event_get_layer(e);
+  const lv_area_t *clip = &layer->_clip_area;
+  lv_draw_rect_dsc_t dsc;
+  lv_draw_rect_dsc_init(&dsc);
+  dsc.bg_opa = LV_OPA_50;
+  // Only the cells under this refresh strip
+  int c1 = LV_MAX(clip->x1 / HEATMAP_CELL, 0), c2 = LV_MIN(clip->x2 / HEATMAP_CELL, cols - 1);
+  int r1 = LV_MAX(clip->y1 / HEATMAP_CELL, 0), r2 = LV_MIN(clip->y2 / HEATMAP_CELL, rows - 1);
+  for (int r = r1; r <= r2; r++) {
+    for (int c = c1; c <= c2; c++) {
+      int i = r * cols + c;
+      if (!cell_level[i]) continue;
+      lv_area_t a;
+      cell_area(i, &a);
+      dsc.bg_color = lv_color_hex(HEAT_COLORS[cell_level[i]]);
+      lv_draw_rect(layer, &dsc, &a);
+    }
+  }
+}
+
+static void heatmap_event_cb(lv_event_t *e) {
+  if (!recording) return;
+  switch (lv_event_get_code(e)) {
+    case LV_EVENT_INVALIDATE_AREA: {
+      if (self_inv) break;
+      const lv_area_t *a = (const lv_area_t *)lv_event_get_param(e);
+      window.inv_areas++; total.inv_areas++;
+      window.inv_px += lv_area_get_size(a); total.inv_px += lv_area_get_size(a);
+      break;
+    }
+    case LV_EVENT_REFR_READY:
+      if (skip_frame) { skip_frame = false; break; }
+      if (!frame_work) break;   // Idle refresh
+      frame_work = false;
+      window.frames++; total.frames++;
+      frame_seq++;
+      break;
+    default:
+      break;
+  }
+}
+
+bool heatmap_attach(lv_display_t *disp) {
+  int32_t w = lv_display_get_horizontal_resolution(disp), h = lv_display_get_vertical_resolution(disp);
+  cols = (w + HEATMAP_CELL - 1) / HEATMAP_CELL;
+  rows = (h + HEATMAP_CELL - 1) / HEATMAP_CELL;
+  if (cols * rows > HEATMAP_MAX_CELLS) {
+    printf("Heatmap: %dx%d cells exceed HEATMAP_MAX_CELLS!\n", cols, rows);
+    cols = rows = 0;
+    return false;
+  }
+  lv_display_add_event_cb(disp, heatmap_event_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+  lv_display_add_event_cb(disp, heatmap_event_cb, LV_EVENT_REFR_READY, NULL);
+
+  overlay = lv_obj_create(lv_layer_top());
+  lv_obj_remove_style_all(overlay);
+  lv_obj_set_size(overlay, w, h);
+  lv_obj_clear_flag(overlay, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_add_event_cb(overlay, overlay_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+  overlay_label = lv_label_create(overlay);
+  lv_obj_set_style_text_color(overlay_label, lv_color_white(), 0);
+  lv_obj_set_style_bg_color(overlay_label, lv_color_black(), 0);
+  lv_obj_set_style_bg_opa(overlay_label, LV_OPA_70, 0);
+  lv_obj_align(overlay_label, LV_ALIGN_BOTTOM_MID, 0, -90);
+  lv_label_set_text(overlay_label, "REDRAW --");
+  lv_obj_add_flag(overlay, LV_OBJ_FLAG_HIDDEN);
+  return true;
+}
+
+void heatmap_flush(const lv_area_t *area) {
+  if (!recording || skip_frame || !cols) return;
+  frame_work = true;
+  uint32_t px = lv_area_get_size(area);
+  window.redraw_px += px; total.redraw_px += px;
+  // Partial buffers split a frame into strips; a cell on a strip boundary
+  // still counts once per frame
+  int c1 = LV_MAX(area->x1 / HEATMAP_CELL, 0), c2 = LV_MIN(area->x2 / HEATMAP_CELL, cols - 1);
+  int r1 = LV_MAX(area->y1 / HEATMAP_CELL, 0), r2 = LV_MIN(area->y2 / HEATMAP_CELL, rows - 1);
+  uint16_t stamp = (uint16_t)frame_seq;
+  for (int r = r1; r <= r2; r++) {
+    for (int c = c1; c <= c2; c++) {
+      int i = r * cols + c;
+      if (cell_stamp[i] == stamp) continue;
+      cell_stamp[i] = stamp;
+      if (cell_window[i] < UINT16_MAX) cell_window[i]++;
+      cell_total[i]++;
+    }
+  }
+}
+
+void heatmap_set_recording(bool on) {
+  if (on && !recording) {
+    memset(cell_window, 0, sizeof(cell_window));
+    memset(&window, 0, sizeof(window));
+  }
+  recording = on || shown;
+}
+
+void heatmap_show(bool on) {
+  if (!overlay) return;
+  shown = on;
+  recording = on;
+  memset(cell_level, 0, sizeof(cell_level));
+  memset(cell_window, 0, sizeof(cell_window));
+  memset(&window, 0, sizeof(window));
+  self_inv = true;
+  if (on) lv_obj_clear_flag(overlay, LV_OBJ_FLAG_HIDDEN);
+  else lv_obj_add_flag(overlay, LV_OBJ_FLAG_HIDDEN);
+  self_inv = false;
+  skip_frame = on;
+}
+
+bool heatmap_tick(uint32_t now_ms) {
+  if (now_ms - window_start_ms < 1000) return false;
+  uint32_t elapsed = now_ms - window_start_ms;
+  window_start_ms = now_ms;
+  last_second = window;
+  if (!recording) return true;
+
+  bool dirty = false;
+  self_inv = true;
+  for (int i = 0; i < cols * rows; i++) {
+    uint8_t l = rate_level(cell_window[i] * 1000 / elapsed);
+    cell_window[i] = 0;
+    if (shown && l != cell_level[i]) {
+      cell_level[i] = l;
+      lv_area_t a;
+      cell_area(i, &a);
+      lv_obj_invalidate_area(overlay, &a);
+      dirty = true;
+    }
+  }
+  if (shown) {
+    lv_label_set_text_fmt(overlay_label, "REDRAW %u kpx/s  %u fps  INV %u/s",
+                          (unsigned)(window.redraw_px / 1000), (unsigned)window.frames, (unsigned)window.inv_areas);
+    dirty = true;
+  }
+  self_inv = false;
+  memset(&window, 0, sizeof(window));
+  if (dirty) skip_frame = true;
+  return true;
+}
+
+const heatmap_totals_t *heatmap_last_second() { return &last_second; }
+
+void heatmap_reset() {
+  memset(cell_total, 0, sizeof(cell_total));
+  memset(&total, 0, sizeof(total));
+}
+
+void heatmap_report(const char *title) {
+  uint32_t frames = total.frames ? total.frames : 1;
+  printf("HEAT %s frames=%u redraw_px=%u px/frame=%u inv_areas=%u inv_px=%u\n", title, (unsigned)total.frames,
+         (unsigned)total.redraw_px, (unsigned)(total.redraw_px / frames), (unsigned)total.inv_areas, (unsigned)total.inv_px);
+
+  // Hottest cells, simple selection over a copy-free marker pass
+  static bool picked[HEATMAP_MAX_CELLS];
+  memset(picked, 0, sizeof(picked));
+  for (int k = 0; k < 8; k++) {
+    int best = -1;
+    for (int i = 0; i < cols * rows; i++)
+      if (!picked[i] && cell_total[i] && (best < 0 || cell_total[i] > cell_total[best])) best = i;
+    if (best < 0) break;
+    picked[best] = true;
+    lv_area_t a;
+    cell_area(best, &a);
+    printf("HEAT hot x=%d y=%d redraws=%u (%u%% of frames)\n", (int)a.x1, (int)a.y1,
+           (unsigned)cell_total[best], (unsigned)(100 * cell_total[best] / frames));
+  }
+
+  // One character per cell: share of frames that redrew it
+  static const char RAMP[] = " .:-=+*#%@";
+  char line[HEATMAP_MAX_CELLS / 16 + 2];
+  for (int r = 0; r < rows; r++) {
+    int n = 0;
+    for (int c = 0; c < cols && n < (int)sizeof(line) - 1; c++) {
+      uint32_t pct = 100 * cell_total[r * cols + c] / frames;
+      line[n++] = RAMP[cell_total[r * cols + c] ? 1 + LV_MIN(pct * 9 / 100, 8u) : 0];
+    }
+    line[n] = 0;
+    printf("HEAT |%s|\n", line);
+  }
+}
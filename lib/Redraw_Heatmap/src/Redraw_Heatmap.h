@@ -0,0 +1,30 @@
+#pragma once
+#include <lvgl.h>
+
+// Redraw heat map for finding expensive regions. While recording, every
+// flushed (actually redrawn) area is binned into HEATMAP_CELL px cells,
+// counted at most once per frame, and invalidated areas are tallied too.
+// The overlay on the top layer tints each cell by redraws per second and
+// shows the total redrawn pixels per second; it repaints only the cells whose
+// level changed, and the frame that carries its own repaint is not counted.
+#define HEATMAP_CELL      16
+#define HEATMAP_MAX_CELLS 900   // 480x480 at 16 px
+
+typedef struct {
+  uint32_t frames;      // Refreshes that did work
+  uint32_t redraw_px;   // Pixels rendered and flushed
+  uint32_t inv_areas;   // Invalidation requests
+  uint32_t inv_px;      // Their summed area (before LVGL merges them)
+} heatmap_totals_t;
+
+bool heatmap_attach(lv_display_t *disp);     // Creates the hidden overlay
+void heatmap_flush(const lv_area_t *area);   // Call from the flush hook
+void heatmap_set_recording(bool on);         // Counting only, no overlay
+void heatmap_show(bool on);                  // Overlay on (records while shown)
+bool heatmap_tick(uint32_t now_ms);          // Closes the one-second window
+const heatmap_totals_t *heatmap_last_second();
+
+// Cumulative counts since heatmap_reset(): totals, hottest cells and an ASCII
+// map of redraws per frame, printed to serial for before/after comparisons
+void heatmap_reset();
+void heatmap_report(const char *title);
@@ -0,0 +1,49 @@
+#include "Render_Stats.h"
+#include <esp_timer.h>
+#include <esp_cpu.h>
+
+static render_frame_stats_t cur;
+static render_frame_stats_t last;
+static int64_t refr_start_us = 0;
+static uint32_t refr_start_cycles = 0;
+static uint32_t frame_seq = 1;   // 0 = no frame yet
+static render_stats_cb_t frame_cb = NULL;
+
+static void render_stats_event_cb(lv_event_t *e) {
+  switch (lv_event_get_code(e)) {
+    case LV_EVENT_INVALIDATE_AREA:
+      cur.inv_areas++;
+      break;
+    case LV_EVENT_REFR_START:
+      refr_start_us = esp_timer_get_time();
+      refr_start_cycles = esp_cpu_get_cycle_count();
+      break;
+    case LV_EVENT_REFR_READY:
+      if (cur.flushes == 0 && cur.inv_areas == 0) break;  // Idle refresh
+      cur.render_us = (uint32_t)(esp_timer_get_time() - refr_start_us);
+      cur.refr_cycles = esp_cpu_get_cycle_count() - refr_start_cycles;
+      cur.frame = frame_seq++;
+      last = cur;
+      lv_memzero(&cur, sizeof(cur));
+      if (frame_cb) frame_cb(&last);
+      break;
+    default:
+      break;
+  }
+}
+
+void render_stats_attach(lv_display_t *disp) {
+  lv_display_add_event_cb(disp, render_stats_event_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+  lv_display_add_event_cb(disp, render_stats_event_cb, LV_EVENT_REFR_START, NULL);
+  lv_display_add_event_cb(disp, render_stats_event_cb, LV_EVENT_REFR_READY, NULL);
+}
+
+void render_stats_flush(const lv_area_t *area, uint32_t copy_cycles) {
+  cur.flushes++;
+  cur.px_touched += lv_area_get_size(area);
+  cur.flush_cycles += copy_cycles;
+}
+
+void render_stats_set_frame_cb(render_stats_cb_t cb) { frame_cb = cb; }
+
+const render_frame_stats_t *render_stats_last() { return &last; }
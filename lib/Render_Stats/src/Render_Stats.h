@@ -0,0 +1,21 @@
+#pragma once
+#include <lvgl.h>
+
+// Per-frame render cost, collected from LVGL display events plus a hook in
+// the flush callback. A "frame" is one display refresh that did any work.
+typedef struct {
+  uint32_t frame;           // Sequence number
+  uint32_t render_us;       // REFR_START -> REFR_READY (render + flush)
+  uint16_t inv_areas;       // Invalidation requests since the previous frame
+  uint16_t flushes;         // Flush callbacks (partial buffers) this frame
+  uint32_t px_touched;      // Pixels rendered and flushed this frame
+  uint32_t refr_cycles;     // CPU cycles for the whole refresh
+  uint32_t flush_cycles;    // Of which copying into the panel framebuffer
+} render_frame_stats_t;
+
+typedef void (*render_stats_cb_t)(const render_frame_stats_t *stats);
+
+void render_stats_attach(lv_display_t *disp);
+void render_stats_flush(const lv_area_t *area, uint32_t copy_cycles);  // Call from the flush callback
+void render_stats_set_frame_cb(render_stats_cb_t cb);  // Called after every frame
+const render_frame_stats_t *render_stats_last();
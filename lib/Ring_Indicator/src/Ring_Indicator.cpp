@@ -0,0 +1,106 @@
+#include "Ring_Indicator.h"
+#include <esp_heap_caps.h>
+#include <math.h>
+
+static uint8_t *ring_mask = NULL;
+static lv_image_dsc_t ring_img;
+static lv_area_t ring_segs[RING_SEGMENTS];
+static lv_color_t ring_color;
+
+static inline float clamp01(float v) { return v < 0 ? 0 : (v > 1 ? 1 : v); }
+
+bool ring_mask_init(int ring_size, int ring_width) {
+  if (ring_mask) return true;
+  ring_mask = (uint8_t *)heap_caps_malloc(ring_size * ring_size, MALLOC_CAP_SPIRAM);
+  if (!ring_mask) {
+    printf("Ring_Indicator: Failed to allocate ring mask!\n");
+    return false;
+  }
+
+  // Anti-aliased annulus coverage from each pixel centre's distance
+  float c = (ring_size - 1) / 2.0f;
+  float r_out = ring_size / 2.0f;
+  float r_in = r_out - ring_width;
+  for (int y = 0; y < ring_size; y++) {
+    float dy = y - c;
+    uint8_t *row = ring_mask + y * ring_size;
+    for (int x = 0; x < ring_size; x++) {
+      float dx = x - c;
+      float d = sqrtf(dx * dx + dy * dy);
+      float cov = clamp01(r_out - d + 0.5f) * clamp01(d - r_in + 0.5f);
+      row[x] = (uint8_t)(cov * 255.0f + 0.5f);
+    }
+  }
+
+  lv_memzero(&ring_img, sizeof(ring_img));
+  ring_img.header.magic = LV_IMAGE_HEADER_MAGIC;
+  ring_img.header.cf = LV_COLOR_FORMAT_A8;
+  ring_img.header.w = ring_size;
+  ring_img.header.h = ring_size;
+  ring_img.header.stride = ring_size;
+  ring_img.data_size = ring_size * ring_size;
+  ring_img.data = ring_mask;
+
+  // Segment boxes: sample each arc span on both edges and pad for anti-aliasing
+  for (int s = 0; s < RING_SEGMENTS; s++) {
+    lv_area_t *a = &ring_segs[s];
+    a->x1 = a->y1 = ring_size; a->x2 = a->y2 = 0;
+    for (int k = 0; k <= 8; k++) {
+      float ang = 2.0f * M_PI * (s + k / 8.0f) / RING_SEGMENTS;
+      float cs = cosf(ang), sn = sinf(ang);
+      for (int e = 0; e < 2; e++) {
+        float r = e ? r_out : r_in;
+        int px = (int)floorf(c + r * cs);
+        int py = (int)floorf(c + r * sn);
+        a->x1 = LV_MIN(a->x1, px); a->y1 = LV_MIN(a->y1, py);
+        a->x2 = LV_MAX(a->x2, px + 1); a->y2 = LV_MAX(a->y2, py + 1);
+      }
+    }
+    a->x1 = LV_MAX(a->x1 - 1, 0); a->y1 = LV_MAX(a->y1 - 1, 0);
+    a->x2 = LV_MIN(a->x2 + 1, ring_size - 1); a->y2 = LV_MIN(a->y2 + 1, ring_size - 1);
+  }
+  return true;
+}
+
+static void ring_draw_cb(lv_event_t *e) {
+  if (!ring_mask) return;
+  lv_obj_t *obj = lv_event_get_current_target_obj(e);
+  lv_layer_t *layer = lv_event_get_layer(e);
+  lv_area_t coords;
+  lv_obj_get_coords(obj, &coords);
+
+  lv_draw_image_dsc_t dsc;
+  lv_draw_image_dsc_init(&dsc);
+  dsc.src = &ring_img;
+  dsc.recolor = ring_color;  // A8 images take their colour from recolor
+  dsc.recolor_opa = LV_OPA_COVER;
+  lv_draw_image(layer, &dsc, &coords);
+}
+
+lv_obj_t *ring_indicator_create(lv_obj_t *parent, lv_color_t color) {
+  ring_color = color;
+  lv_obj_t *ring = lv_obj_create(parent);
+  lv_obj_remove_style_all(ring);
+  lv_obj_set_size(ring, ring_img.header.w, ring_img.header.h);
+  lv_obj_clear_flag(ring, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_add_event_cb(ring, ring_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+  return ring;
+}
+
+void ring_indicator_set_color(lv_obj_t *ring, lv_color_t color) {
+  if (lv_color_eq(color, ring_color)) return;
+  ring_color = color;
+
+  // Repaint just the ring band; cost is bounded by the segment boxes
+  lv_area_t coords;
+  lv_obj_get_coords(ring, &coords);
+  for (int s = 0; s < RING_SEGMENTS; s++) {
+    lv_area_t a = ring_segs[s];
+    lv_area_move(&a, coords.x1, coords.y1);
+    lv_obj_invalidate_area(ring, &a);
+  }
+}
+
+lv_color_t ring_indicator_get_color() { return ring_color; }
+
+const lv_area_t *ring_segment_areas() { return ring_segs; }
@@ -0,0 +1,17 @@
+#pragma once
+#include <lvgl.h>
+
+// Zone ring drawn from an A8 coverage mask rasterised once at boot (PSRAM)
+// and recoloured at blit time. A colour change only invalidates the
+// RING_SEGMENTS tight boxes along the ring, not the whole 480x480 object.
+#define RING_SEGMENTS 32
+
+bool ring_mask_init(int ring_size, int ring_width);
+
+// Transparent full-size object that blits the cached mask in ring colour
+lv_obj_t *ring_indicator_create(lv_obj_t *parent, lv_color_t color);
+void ring_indicator_set_color(lv_obj_t *ring, lv_color_t color);
+lv_color_t ring_indicator_get_color();
+
+// Bounding boxes of the ring segments, relative to the ring's top-left corner
+const lv_area_t *ring_segment_areas();
@@ -0,0 +1,108 @@
+#include "Segment_Font.h"
+#include <math.h>
+#include <string.h>
+
+#define SEG_SUBSAMPLES 4    // Vertical subsamples per pixel (horizontal coverage is exact)
+
+typedef struct { float x, y; } seg_pt_t;
+
+uint16_t seg_font_mask(char c) {
+  switch (c) {
+    case '0': return SEG_A | SEG_B | SEG_C | SEG_D | SEG_E | SEG_F;
+    case '1': return SEG_B | SEG_C;
+    case '2': return SEG_A | SEG_B | SEG_G1 | SEG_G2 | SEG_E | SEG_D;
+    case '3': return SEG_A | SEG_B | SEG_G1 | SEG_G2 | SEG_C | SEG_D;
+    case '4': return SEG_F | SEG_G1 | SEG_G2 | SEG_B | SEG_C;
+    case '5': return SEG_A | SEG_F | SEG_G1 | SEG_G2 | SEG_C | SEG_D;
+    case '6': return SEG_A | SEG_F | SEG_G1 | SEG_G2 | SEG_E | SEG_C | SEG_D;
+    case '7': return SEG_A | SEG_F | SEG_B | SEG_C;   // DSEG14 lights the top-left bar too
+    case '8': return SEG_A | SEG_B | SEG_C | SEG_D | SEG_E | SEG_F | SEG_G1 | SEG_G2;
+    case '9': return SEG_A | SEG_B | SEG_C | SEG_D | SEG_F | SEG_G1 | SEG_G2;
+    case '-': return SEG_G1 | SEG_G2;
+    case '.': return SEG_DP;
+    default:  return 0;
+  }
+}
+
+int32_t seg_font_cell_width(char c, int32_t h) {
+  if (c == '.') return (int32_t)ceilf(h * SEG_FONT_THICK_RATIO);   // The DSEG dot's own box
+  return (int32_t)(h * SEG_FONT_WIDTH_RATIO + 0.5f);
+}
+
+// Scanline-fill a convex polygon, accumulating coverage (256 = fully covered)
+static void fill_convex(const seg_pt_t *p, int n, uint16_t *acc, int32_t w, int32_t h) {
+  float ymin = p[0].y, ymax = p[0].y;
+  for (int i = 1; i < n; i++) { ymin = fminf(ymin, p[i].y); ymax = fmaxf(ymax, p[i].y); }
+  int sy0 = (int)floorf(ymin * SEG_SUBSAMPLES);
+  int sy1 = (int)ceilf(ymax * SEG_SUBSAMPLES);
+  if (sy0 < 0) sy0 = 0;
+  if (sy1 > h * SEG_SUBSAMPLES) sy1 = h * SEG_SUBSAMPLES;
+
+  for (int sy = sy0; sy < sy1; sy++) {
+    float y = (sy + 0.5f) / SEG_SUBSAMPLES;
+    float xl = 1e9f, xr = -1e9f;
+    for (int i = 0; i < n; i++) {
+      const seg_pt_t *a = &p[i], *b = &p[(i + 1) % n];
+      if ((y < a->y) == (y < b->y)) continue;  // Edge doesn't cross this row
+      float x = a->x + (y - a->y) * (b->x - a->x) / (b->y - a->y);
+      xl = fminf(xl, x); xr = fmaxf(xr, x);
+    }
+    if (xl < 0) xl = 0;
+    if (xr > w) xr = w;
+    if (xr <= xl) continue;
+
+    uint16_t *row = acc + (sy / SEG_SUBSAMPLES) * w;
+    const float full = 256.0f / SEG_SUBSAMPLES;
+    int px0 = (int)xl, px1 = (int)xr;
+    if (px0 == px1) { row[px0] += (uint16_t)((xr - xl) * full); continue; }
+    row[px0] += (uint16_t)((px0 + 1 - xl) * full);
+    for (int x = px0 + 1; x < px1; x++) row[x] += (uint16_t)full;
+    if (px1 < w) row[px1] += (uint16_t)((xr - px1) * full);
+  }
+}
+
+// Pointed bar between two centreline points, half-thickness r
+static void fill_bar(float x0, float y0, float x1, float y1, float r,
+                     uint16_t *acc, int32_t w, int32_t h) {
+  seg_pt_t p[6];
+  if (y0 == y1) {
+    p[0] = { x0, y0 };     p[1] = { x0 + r, y0 - r }; p[2] = { x1 - r, y0 - r };
+    p[3] = { x1, y0 };     p[4] = { x1 - r, y0 + r }; p[5] = { x0 + r, y0 + r };
+  } else {
+    p[0] = { x0, y0 };     p[1] = { x0 + r, y0 + r }; p[2] = { x0 + r, y1 - r };
+    p[3] = { x0, y1 };     p[4] = { x0 - r, y1 - r }; p[5] = { x0 - r, y0 + r };
+  }
+  fill_convex(p, 6, acc, w, h);
+}
+
+void seg_font_render(char c, uint8_t *a8, uint16_t *acc, int32_t w, int32_t h) {
+  memset(a8, 0, w * h);
+  uint16_t mask = seg_font_mask(c);
+  if (!mask) return;
+  memset(acc, 0, w * h * sizeof(uint16_t));
+
+  float t = h * SEG_FONT_THICK_RATIO;
+  float r = t / 2;
+  float g = t * 0.15f;  // Gap between neighbouring segments
+
+  if (mask & SEG_DP) {
+    seg_pt_t sq[4] = { { (w - t) / 2, h - t }, { (w + t) / 2, h - t }, { (w + t) / 2, (float)h }, { (w - t) / 2, (float)h } };
+    fill_convex(sq, 4, acc, w, h);
+  }
+
+  // Segment centrelines inside the cell (ink box inset like the DSEG advance)
+  float margin = w * 0.12f;
+  float xl = margin + r, xr = w - margin - r, xm = (xl + xr) / 2;
+  float yt = r, yb = h - r, ym = h / 2.0f;
+
+  if (mask & SEG_A)  fill_bar(xl + g, yt, xr - g, yt, r, acc, w, h);
+  if (mask & SEG_G1) fill_bar(xl + g, ym, xm - g, ym, r, acc, w, h);
+  if (mask & SEG_G2) fill_bar(xm + g, ym, xr - g, ym, r, acc, w, h);
+  if (mask & SEG_D)  fill_bar(xl + g, yb, xr - g, yb, r, acc, w, h);
+  if (mask & SEG_F)  fill_bar(xl, yt + g, xl, ym - g, r, acc, w, h);
+  if (mask & SEG_E)  fill_bar(xl, ym + g, xl, yb - g, r, acc, w, h);
+  if (mask & SEG_B)  fill_bar(xr, yt + g, xr, ym - g, r, acc, w, h);
+  if (mask & SEG_C)  fill_bar(xr, ym + g, xr, yb - g, r, acc, w, h);
+
+  for (int32_t i = 0; i < w * h; i++) a8[i] = acc[i] > 255 ? 255 : acc[i];
+}
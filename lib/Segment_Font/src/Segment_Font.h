@@ -0,0 +1,28 @@
+#pragma once
+#include <stdint.h>
+
+// Procedural DSEG-style segment glyphs: each segment is a filled polygon
+// (pointed hexagon) rasterised with anti-aliasing at any height, replacing
+// the per-size bitmap fonts. Only what the gauge shows is defined: digits
+// (7-segment subset with the split middle bar of DSEG14), '-' and '.'.
+
+#define SEG_A    (1 << 0)   // Top
+#define SEG_B    (1 << 1)   // Top right
+#define SEG_C    (1 << 2)   // Bottom right
+#define SEG_D    (1 << 3)   // Bottom
+#define SEG_E    (1 << 4)   // Bottom left
+#define SEG_F    (1 << 5)   // Top left
+#define SEG_G1   (1 << 6)   // Middle left
+#define SEG_G2   (1 << 7)   // Middle right
+#define SEG_DP   (1 << 8)   // Decimal point
+
+#define SEG_FONT_WIDTH_RATIO   0.80f   // Digit cell width / height (DSEG14 advance)
+#define SEG_FONT_THICK_RATIO   0.12f   // Stroke / height (Bold weight)
+
+uint16_t seg_font_mask(char c);
+int32_t seg_font_cell_width(char c, int32_t h);
+
+// Rasterise c into an A8 coverage buffer (w x h, stride w), cleared first.
+// acc is caller-owned scratch of w * h accumulators (kept off the stack:
+// glyphs run to 96x120 and this is called from the loop task).
+void seg_font_render(char c, uint8_t *a8, uint16_t *acc, int32_t w, int32_t h);
@@ -0,0 +1,174 @@
+#include "Shift_Light.h"
+#include <esp_heap_caps.h>
+#include <math.h>
+
+enum { SEG_DIM = 0, SEG_LIT, SEG_FLASH };
+
+static uint8_t *seg_masks = NULL;
+static lv_image_dsc_t seg_img[SHIFT_SEGMENTS];
+static lv_area_t seg_area[SHIFT_SEGMENTS];      // Relative to the object
+static lv_area_t bounds;                        // Union of the segments, parent coordinates
+static uint8_t seg_shown[SHIFT_SEGMENTS];
+static lv_color_t band_color[3];
+static volatile int rpm_start = 5000, rpm_shift = 7000;
+
+static inline float clamp01(float v) { return v < 0 ? 0 : (v > 1 ? 1 : v); }
+
+static inline int band_of(int s) { return s < SHIFT_MID_FROM ? 0 : s < SHIFT_HIGH_FROM ? 1 : 2; }
+
+bool shift_light_init(int cx, int cy, int r_in, int r_out, float angle_start_deg, float angle_range_deg) {
+  if (seg_masks) return true;
+  float c_x = cx - 0.5f, c_y = cy - 0.5f;   // Pixel-centre coordinates of the arc centre
+  float pitch = angle_range_deg / SHIFT_SEGMENTS;
+  float span = pitch * 0.75f;                // Lit part of each pitch, the rest is the gap
+
+  // Segment boxes: sample each arc span on both edges and pad for anti-aliasing
+  lv_area_t box[SHIFT_SEGMENTS];
+  size_t total = 0;
+  for (int s = 0; s < SHIFT_SEGMENTS; s++) {
+    lv_area_t *a = &box[s];
+    a->x1 = a->y1 = INT16_MAX; a->x2 = a->y2 = INT16_MIN;
+    float a0 = angle_start_deg + s * pitch + (pitch - span) / 2;
+    for (int k = 0; k <= 8; k++) {
+      float ang = (a0 + span * k / 8.0f) * (float)M_PI / 180.0f;
+      float cs = cosf(ang), sn = sinf(ang);
+      for (int e = 0; e < 2; e++) {
+        float r = e ? r_out : r_in;
+        int px = (int)floorf(c_x + r * cs);
+        int py = (int)floorf(c_y + r * sn);
+        a->x1 = LV_MIN(a->x1, px); a->y1 = LV_MIN(a->y1, py);
+        a->x2 = LV_MAX(a->x2, px + 1); a->y2 = LV_MAX(a->y2, py + 1);
+      }
+    }
+    a->x1 -= 1; a->y1 -= 1; a->x2 += 1; a->y2 += 1;
+    total += lv_area_get_size(a);
+  }
+
+  seg_masks = (uint8_t *)heap_caps_malloc(total, MALLOC_CAP_SPIRAM);
+  if (!seg_masks) {
+    printf("Shift_Light: Failed to allocate segment masks!\n");
+    return false;
+  }
+
+  // Coverage = radial band x angular span, both measured in px at the pixel's radius
+  bounds = box[0];
+  uint8_t *p = seg_masks;
+  for (int s = 0; s < SHIFT_SEGMENTS; s++) {
+    const lv_area_t *a = &box[s];
+    int32_t w = lv_area_get_width(a), h = lv_area_get_height(a);
+    float a0 = (angle_start_deg + s * pitch + (pitch - span) / 2) * (float)M_PI / 180.0f;
+    float span_rad = span * (float)M_PI / 180.0f;
+    for (int32_t y = 0; y < h; y++) {
+      float dy = a->y1 + y - c_y;
+      for (int32_t x = 0; x < w; x++) {
+        float dx = a->x1 + x - c_x;
+        float d = sqrtf(dx * dx + dy * dy);
+        float rel = atan2f(dy, dx) - a0;
+        while (rel < -(float)M_PI) rel += 2 * (float)M_PI;
+        while (rel > (float)M_PI) rel -= 2 * (float)M_PI;
+        float along = rel * d;
+        float cov = clamp01(r_out - d + 0.5f) * clamp01(d - r_in + 0.5f) *
+                    clamp01(along + 0.5f) * clamp01(span_rad * d - along + 0.5f);
+        p[y * w + x] = (uint8_t)(cov * 255.0f + 0.5f);
+      }
+    }
+
+    lv_image_dsc_t *img = &seg_img[s];
+    lv_memzero(img, sizeof(*img));
+    img->header.magic = LV_IMAGE_HEADER_MAGIC;
+    img->header.cf = LV_COLOR_FORMAT_A8;
+    img->header.w = w;
+    img->header.h = h;
+    img->header.stride = w;
+    img->data_size = w * h;
+    img->data = p;
+    p += w * h;
+    bounds.x1 = LV_MIN(bounds.x1, a->x1); bounds.y1 = LV_MIN(bounds.y1, a->y1);
+    bounds.x2 = LV_MAX(bounds.x2, a->x2); bounds.y2 = LV_MAX(bounds.y2, a->y2);
+  }
+  for (int s = 0; s < SHIFT_SEGMENTS; s++) {
+    seg_area[s] = box[s];
+    lv_area_move(&seg_area[s], -bounds.x1, -bounds.y1);
+  }
+  return true;
+}
+
+static void shift_draw_cb(lv_event_t *e) {
+  if (!seg_masks) return;
+  lv_obj_t *obj = lv_event_get_current_target_obj(e);
+  lv_layer_t *layer = lv_event_get_layer(e);
+  lv_area_t coords, a, clipped;
+  lv_obj_get_coords(obj, &coords);
+
+  lv_draw_image_dsc_t dsc;
+  lv_draw_image_dsc_init(&dsc);
+  dsc.recolor_opa = LV_OPA_COVER;  // A8 images take their colour from recolor
+  for (int s = 0; s < SHIFT_SEGMENTS; s++) {
+    a = seg_area[s];
+    lv_area_move(&a, coords.x1, coords.y1);
+    if (!lv_area_intersect(&clipped, &a, &layer->_clip_area)) continue;
+    uint8_t shown = seg_shown[s];
+    dsc.src = &seg_img[s];
+    dsc.recolor = band_color[shown == SEG_FLASH ? 2 : band_of(s)];
+    dsc.opa = shown == SEG_DIM ? LV_OPA_20 : LV_OPA_COVER;
+    lv_draw_image(layer, &dsc, &a);
+  }
+}
+
+lv_obj_t *shift_light_create(lv_obj_t *parent) {
+  lv_obj_t *obj = lv_obj_create(parent);
+  lv_obj_remove_style_all(obj);
+  lv_obj_set_pos(obj, bounds.x1, bounds.y1);
+  lv_obj_set_size(obj, lv_area_get_width(&bounds), lv_area_get_height(&bounds));
+  lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_add_event_cb(obj, shift_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+  return obj;
+}
+
+void shift_light_set_rpm_range(int start_rpm, int shift_rpm) {
+  if (shift_rpm <= start_rpm) shift_rpm = start_rpm + 1;
+  rpm_start = start_rpm;
+  rpm_shift = shift_rpm;
+}
+
+static void invalidate_segment(lv_obj_t *obj, int s) {
+  lv_area_t coords, a = seg_area[s];
+  lv_obj_get_coords(obj, &coords);
+  lv_area_move(&a, coords.x1, coords.y1);
+  lv_obj_invalidate_area(obj, &a);
+}
+
+void shift_light_set_colors(lv_obj_t *obj, lv_color_t low, lv_color_t mid, lv_color_t high) {
+  lv_color_t c[3] = { low, mid, high };
+  for (int b = 0; b < 3; b++) {
+    if (lv_color_eq(c[b], band_color[b])) continue;
+    band_color[b] = c[b];
+    // Dim segments show their band colour too, so every segment of the band repaints
+    for (int s = 0; s < SHIFT_SEGMENTS; s++) {
+      if (band_of(s) == b || seg_shown[s] == SEG_FLASH) invalidate_segment(obj, s);
+    }
+  }
+}
+
+uint32_t shift_light_state(int rpm) {
+  int start = rpm_start, shift = rpm_shift;
+  if (rpm >= shift) return SHIFT_FLASH | SHIFT_SEGMENTS;
+  if (rpm < start) return 0;
+  // First segment at start_rpm; the full arc only shows at the shift point, flashing
+  return 1 + (uint32_t)((rpm - start) * (SHIFT_SEGMENTS - 1) / (shift - start));
+}
+
+int shift_light_apply(lv_obj_t *obj, uint32_t state, uint32_t now_ms) {
+  uint32_t lit = state & ~SHIFT_FLASH;
+  bool flash_on = (state & SHIFT_FLASH) && ((now_ms / SHIFT_FLASH_MS) & 1) == 0;
+  int changed = 0;
+  for (int s = 0; s < SHIFT_SEGMENTS; s++) {
+    uint8_t want = (state & SHIFT_FLASH) ? (flash_on ? SEG_FLASH : SEG_DIM)
+                                         : ((uint32_t)s < lit ? SEG_LIT : SEG_DIM);
+    if (want == seg_shown[s]) continue;
+    seg_shown[s] = want;
+    invalidate_segment(obj, s);
+    changed++;
+  }
+  return changed;
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include <lvgl.h>
+
+// LED-style RPM shift light: SHIFT_SEGMENTS arc segments, each an A8
+// coverage mask rasterised once at boot and recoloured at blit time.
+// The state is a single word computed from rpm wherever the reading is
+// decoded (CAN rate, any task); the UI side compares it per segment with
+// what is on screen and invalidates only the boxes of segments that changed.
+#define SHIFT_SEGMENTS   15
+#define SHIFT_MID_FROM   9      // Segments [0, 9) low colour, [9, 13) mid,
+#define SHIFT_HIGH_FROM  13     // [13, 15) high
+#define SHIFT_FLASH      0x80000000u  // State flag: at or past the shift point
+#define SHIFT_FLASH_MS   60     // Half period of the shift flash
+
+// Arc centre in parent coordinates, band radii and sweep (LVGL angles:
+// 0 = right, clockwise)
+bool shift_light_init(int cx, int cy, int r_in, int r_out, float angle_start_deg, float angle_range_deg);
+
+lv_obj_t *shift_light_create(lv_obj_t *parent);
+void shift_light_set_rpm_range(int start_rpm, int shift_rpm);  // First segment / flash
+void shift_light_set_colors(lv_obj_t *obj, lv_color_t low, lv_color_t mid, lv_color_t high);
+
+// Lit segment count, ORed with SHIFT_FLASH; safe from any task
+uint32_t shift_light_state(int rpm);
+// Show a state; returns the number of segments invalidated
+int shift_light_apply(lv_obj_t *obj, uint32_t state, uint32_t now_ms);
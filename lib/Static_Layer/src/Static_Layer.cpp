@@ -0,0 +1,52 @@
+#include "Static_Layer.h"
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+
+static lv_draw_buf_t layer_buf;
+static uint8_t *layer_data = NULL;
+static lv_obj_t *layer_img = NULL;
+static lv_obj_t *layer_content = NULL;
+static uint32_t build_us = 0;
+
+lv_obj_t *static_layer_create(lv_obj_t *parent, lv_obj_t *content, int32_t w, int32_t h) {
+  layer_content = content;
+  uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_RGB565);
+  uint32_t size = stride * h;
+  if (!layer_data) layer_data = (uint8_t *)heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+  if (!layer_data) {
+    printf("Static_Layer: Failed to allocate layer buffer!\n");
+    return NULL;
+  }
+  lv_draw_buf_init(&layer_buf, w, h, LV_COLOR_FORMAT_RGB565, stride, layer_data, size);
+
+  // Opaque RGB565 with no transform, so LVGL starts each dirty rect here and
+  // skips everything underneath
+  layer_img = lv_image_create(parent);
+  lv_obj_set_pos(layer_img, 0, 0);
+  lv_obj_clear_flag(layer_img, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_add_flag(layer_img, LV_OBJ_FLAG_HIDDEN);  // Until the first rebuild
+  return layer_img;
+}
+
+bool static_layer_rebuild() {
+  if (!layer_img) return false;
+  int64_t t0 = esp_timer_get_time();
+
+  lv_obj_clear_flag(layer_content, LV_OBJ_FLAG_HIDDEN);
+  lv_obj_update_layout(layer_content);
+  lv_result_t res = lv_snapshot_take_to_draw_buf(layer_content, LV_COLOR_FORMAT_RGB565, &layer_buf);
+  if (res != LV_RESULT_OK) {
+    printf("Static_Layer: Snapshot failed, drawing static content live!\n");
+    lv_obj_add_flag(layer_img, LV_OBJ_FLAG_HIDDEN);
+    return false;
+  }
+  lv_obj_add_flag(layer_content, LV_OBJ_FLAG_HIDDEN);
+  lv_image_set_src(layer_img, &layer_buf);
+  lv_obj_clear_flag(layer_img, LV_OBJ_FLAG_HIDDEN);
+  lv_obj_invalidate(layer_img);
+
+  build_us = (uint32_t)(esp_timer_get_time() - t0);
+  return true;
+}
+
+uint32_t static_layer_build_us() { return build_us; }
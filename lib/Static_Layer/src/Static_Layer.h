@@ -0,0 +1,15 @@
+#pragma once
+#include <lvgl.h>
+
+// Static screen content flattened into one opaque RGB565 layer (PSRAM).
+// The static widgets live under a full-screen `content` container that stays
+// hidden; it is only rendered when the layer is rebuilt (theme, mode or
+// visibility changes). Every frame, the dirty rects under the dynamic widgets
+// are recomposed with a straight copy from the layer, so semi-transparent
+// artwork costs nothing per frame.
+//
+// `content` must carry its own opaque background. If the layer cannot be
+// allocated or snapshotted, `content` is simply left visible and drawn live.
+lv_obj_t *static_layer_create(lv_obj_t *parent, lv_obj_t *content, int32_t w, int32_t h);
+bool static_layer_rebuild();
+uint32_t static_layer_build_us();   // Duration of the last rebuild
@@ -0,0 +1,101 @@
+#include "Trend_Graph.h"
+#include <esp_heap_caps.h>
+#include <stdio.h>
+
+static void trend_draw_cb(lv_event_t *e) {
+  trend_graph_t *tg = (trend_graph_t *)lv_event_get_user_data(e);
+  lv_layer_t *layer = lv_event_get_layer(e);
+  lv_area_t coords;
+  lv_obj_get_coords(tg->obj, &coords);
+
+  // Oldest columns (after head) on the left, then 0..head
+  int32_t split = tg->head + 1;
+  int32_t cols[2][2] = { { split, tg->w - split }, { 0, split } };
+  int32_t x = coords.x1;
+  lv_draw_image_dsc_t dsc;
+  lv_draw_image_dsc_init(&dsc);
+  for (int p = 0; p < 2; p++) {
+    int32_t first = cols[p][0], n = cols[p][1];
+    if (n <= 0) continue;
+    lv_image_dsc_t *img = &tg->part[p];
+    img->header.w = n;
+    img->data = (const uint8_t *)(tg->buf + first);
+    img->data_size = tg->w * tg->h * sizeof(uint16_t) - first * sizeof(uint16_t);
+    lv_area_t a = { x, coords.y1, x + n - 1, coords.y1 + tg->h - 1 };
+    dsc.src = img;
+    lv_draw_image(layer, &dsc, &a);
+    x += n;
+  }
+}
+
+lv_obj_t *trend_create(lv_obj_t *parent, trend_graph_t *tg, int32_t w, int32_t h) {
+  lv_memzero(tg, sizeof(*tg));
+  size_t size = w * h * sizeof(uint16_t);
+  tg->buf = (uint16_t *)heap_caps_malloc(size, MALLOC_CAP_SPIRAM);  // Internal SRAM is left to WiFi/lwIP
+  if (!tg->buf) {
+    printf("Trend_Graph: Failed to allocate %dx%d buffer!\n", (int)w, (int)h);
+    return NULL;
+  }
+  tg->w = w;
+  tg->h = h;
+  tg->min = 0;
+  tg->max = 1;
+  for (int p = 0; p < 2; p++) {
+    tg->part[p].header.magic = LV_IMAGE_HEADER_MAGIC;
+    tg->part[p].header.cf = LV_COLOR_FORMAT_RGB565;
+    tg->part[p].header.h = h;
+    tg->part[p].header.stride = w * sizeof(uint16_t);
+  }
+  trend_clear(tg);
+
+  tg->obj = lv_obj_create(parent);
+  lv_obj_remove_style_all(tg->obj);
+  lv_obj_set_size(tg->obj, w, h);
+  lv_obj_clear_flag(tg->obj, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_add_event_cb(tg->obj, trend_draw_cb, LV_EVENT_DRAW_MAIN, tg);
+  return tg->obj;
+}
+
+void trend_set_range(trend_graph_t *tg, float min, float max) {
+  tg->min = min;
+  tg->max = max > min ? max : min + 1;
+}
+
+void trend_set_colors(trend_graph_t *tg, lv_color_t bg, lv_color_t fg) {
+  tg->bg = lv_color_to_u16(bg);
+  tg->fg = lv_color_to_u16(fg);
+  tg->dim = lv_color_to_u16(lv_color_mix(fg, bg, LV_OPA_20));
+}
+
+void trend_clear(trend_graph_t *tg) {
+  if (!tg->buf) return;
+  for (int32_t i = 0; i < tg->w * tg->h; i++) tg->buf[i] = tg->bg;
+  tg->head = tg->w - 1;   // First push lands in column 0 and shows at the right edge
+  tg->filled = 0;
+  tg->last_y = -1;
+  if (tg->obj) lv_obj_invalidate(tg->obj);
+}
+
+static int32_t value_row(const trend_graph_t *tg, float v) {
+  float t = (v - tg->min) / (tg->max - tg->min);
+  return (int32_t)((1.0f - LV_CLAMP(0.0f, t, 1.0f)) * (tg->h - 1) + 0.5f);
+}
+
+void trend_push(trend_graph_t *tg, float min, float max, float avg) {
+  if (!tg->buf) return;
+  tg->head = (tg->head + 1) % tg->w;
+  if (tg->filled < tg->w) tg->filled++;
+
+  // Span = bucket min..max, extended to the previous average so steps join up
+  int32_t y_avg = value_row(tg, avg);
+  int32_t y1 = value_row(tg, max), y2 = value_row(tg, min);
+  if (tg->last_y >= 0) { y1 = LV_MIN(y1, tg->last_y); y2 = LV_MAX(y2, tg->last_y); }
+  tg->last_y = y_avg;
+
+  uint16_t *p = tg->buf + tg->head;
+  for (int32_t y = 0; y < tg->h; y++, p += tg->w) {
+    *p = (y >= y1 && y <= y2) ? tg->fg : (y > y2 ? tg->dim : tg->bg);
+  }
+  // Every on-screen column moved one step left
+  lv_obj_invalidate(tg->obj);
+}
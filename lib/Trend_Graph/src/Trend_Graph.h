@@ -0,0 +1,26 @@
+#pragma once
+#include <lvgl.h>
+
+// Scrolling sparkline that never redraws its history. Pixels live in an
+// RGB565 column ring: a new sample renders one column at the write position
+// and the draw callback blits the ring as two slices (oldest part first), so
+// scrolling is an addressing change rather than a pixel copy or a chart
+// re-render. Each column draws its min..max span joined to the previous
+// column's average, which keeps the trace continuous.
+typedef struct {
+  lv_obj_t *obj;
+  uint16_t *buf;            // w * h, row-major, stride = w * 2
+  int32_t w, h;
+  int32_t head;             // Column written last
+  int32_t filled;           // Columns holding data (< w until the first wrap)
+  float min, max;           // Vertical scale
+  int32_t last_y;           // Previous column's average row, -1 = none
+  uint16_t bg, fg, dim;     // RGB565: background, trace, area under the trace
+  lv_image_dsc_t part[2];
+} trend_graph_t;
+
+lv_obj_t *trend_create(lv_obj_t *parent, trend_graph_t *tg, int32_t w, int32_t h);
+void trend_set_range(trend_graph_t *tg, float min, float max);   // Takes effect from the next column
+void trend_set_colors(trend_graph_t *tg, lv_color_t bg, lv_color_t fg);
+void trend_clear(trend_graph_t *tg);
+void trend_push(trend_graph_t *tg, float min, float max, float avg);
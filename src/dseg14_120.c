@@ -1,9451 +0,0 @@
-/*******************************************************************************
- * Size: 120 px
- * Bpp: 1
- * Opts: --bpp 1 --size 120 --no-compress --stride 1 --align 1 --font DSEG14Classic-Bold.ttf --symbols 1234567890-. --range 32-127 --format lvgl -o dseg14_120.c
- ******************************************************************************/
-
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-
-#ifndef DSEG14_120
-#define DSEG14_120 1
-#endif
-
-#if DSEG14_120
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-    0x0,
-
-    /* U+0021 "!" */
-    0x0,
-
-    /* U+0022 "\"" */
-    0x18, 0x0, 0x0, 0x0, 0x0, 0x1, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0,
-    0x1, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0xf, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x1, 0xff, 0xf7, 0xff,
-    0xf0, 0x0, 0x7, 0xff, 0x3f, 0xff, 0x80, 0x0,
-    0x3f, 0xf9, 0xff, 0xfc, 0x0, 0x0, 0xff, 0x8f,
-    0xff, 0xe0, 0x0, 0x7, 0xfc, 0x7f, 0xff, 0x0,
-    0x0, 0x1f, 0xc3, 0xff, 0xf0, 0x0, 0x0, 0xfe,
-    0x1f, 0xff, 0x0, 0x0, 0x3, 0xe0, 0xff, 0xf0,
-    0x0, 0x0, 0xe, 0x7, 0xfe, 0x0, 0x0, 0x0,
-    0x70, 0x3f, 0xe0, 0x0, 0x0, 0x1, 0x1, 0xfe,
-    0x0, 0x0, 0x0, 0x8, 0xf, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x6, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x1, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x7e, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x1f, 0xe3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x3, 0xfe, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x7f,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xf, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x1, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x3f, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x7, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xc0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x7f, 0xff,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x1,
-    0xff, 0xfc, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x80, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0xf, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0xf,
-    0xf8, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x1, 0xff, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xc0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xf1, 0xff, 0xfe, 0x3e, 0x3f, 0xff,
-    0xc0, 0x0, 0x3f, 0xfc, 0x7f, 0xff, 0xe7, 0xcf,
-    0xff, 0xfc, 0x0, 0x7, 0xff, 0x1f, 0xff, 0xfc,
-    0x71, 0xff, 0xff, 0xc0, 0x0, 0xff, 0xc7, 0xff,
-    0xff, 0xc4, 0x7f, 0xff, 0xfc, 0x0, 0x1f, 0xf1,
-    0xff, 0xff, 0xf8, 0x8f, 0xff, 0xff, 0xc0, 0x3,
-    0xfc, 0x7f, 0xff, 0xff, 0x83, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x7f, 0xff,
-    0xff, 0xc0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xc1, 0xff, 0xff, 0xff, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf8, 0x3f, 0xff, 0xff, 0xc7, 0xf8, 0x0,
-    0x7f, 0xff, 0xfe, 0x23, 0xff, 0xff, 0xf1, 0xff,
-    0x0, 0x7, 0xff, 0xff, 0xc4, 0x7f, 0xff, 0xfc,
-    0x7f, 0xe0, 0x0, 0x7f, 0xff, 0xf1, 0xc7, 0xff,
-    0xff, 0x1f, 0xfc, 0x0, 0x7, 0xff, 0xfe, 0x7c,
-    0xff, 0xff, 0xc7, 0xff, 0x80, 0x0, 0x7f, 0xff,
-    0x8f, 0x8f, 0xff, 0xf1, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x3, 0xf8, 0x0, 0x0, 0x7f, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x0,
-    0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xe0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x3f, 0xfe, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x1f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x0, 0x1, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xe0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7f, 0xfc, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc7, 0xff, 0x80, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7f, 0xf0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0xfe, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xc0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7,
-    0xf8, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7e, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc7, 0x80, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x60, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0,
-
-    /* U+0025 "%" */
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x78, 0x0, 0x0, 0x0, 0x7, 0x80, 0x0,
-    0x3f, 0xff, 0x9f, 0x0, 0x0, 0x0, 0x3, 0xe0,
-    0x0, 0xf, 0xff, 0xe7, 0xc0, 0x0, 0x0, 0x0,
-    0xf8, 0x0, 0x3, 0xff, 0xf9, 0xf8, 0x0, 0x0,
-    0x0, 0x7e, 0x0, 0x0, 0xff, 0xfe, 0x7e, 0x0,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0x3f, 0xff, 0x9f,
-    0xc0, 0x0, 0x0, 0xf, 0xe0, 0x0, 0xf, 0xff,
-    0xe7, 0xf8, 0x0, 0x0, 0x7, 0xf8, 0x0, 0x3,
-    0xff, 0xf9, 0xfe, 0x0, 0x0, 0x1, 0xfe, 0x0,
-    0x0, 0xff, 0xfe, 0x7f, 0xc0, 0x0, 0x0, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0x9f, 0xf0, 0x0, 0x0,
-    0x3f, 0xe0, 0x0, 0xf, 0xff, 0xe7, 0xfe, 0x0,
-    0x0, 0x1f, 0xf8, 0x0, 0x3, 0xff, 0xf9, 0xff,
-    0x80, 0x0, 0x7, 0xfe, 0x0, 0x0, 0xff, 0xfe,
-    0x7f, 0xe0, 0x0, 0x1, 0xff, 0x80, 0x0, 0x3f,
-    0xff, 0x9f, 0xf8, 0x0, 0x0, 0x7f, 0xe0, 0x0,
-    0xf, 0xff, 0xe7, 0xfe, 0x0, 0x0, 0x1f, 0xf8,
-    0x0, 0x3, 0xff, 0xf9, 0xff, 0x80, 0x0, 0x7,
-    0xfe, 0x0, 0x0, 0xff, 0xfe, 0x7f, 0xe0, 0x0,
-    0x1, 0xff, 0x80, 0x0, 0x3f, 0xff, 0x9f, 0xf8,
-    0x0, 0x0, 0x7f, 0xe0, 0x0, 0xf, 0xff, 0xe7,
-    0xfe, 0x0, 0x0, 0x1f, 0xf8, 0x0, 0x3, 0xff,
-    0xf9, 0xff, 0x80, 0x0, 0x7, 0xfe, 0x0, 0x0,
-    0xff, 0xfe, 0x7f, 0xe0, 0x0, 0x1, 0xff, 0x80,
-    0x0, 0x3f, 0xff, 0x9f, 0xf8, 0x0, 0x0, 0x7f,
-    0xe0, 0x0, 0xf, 0xff, 0xe7, 0xfe, 0x0, 0x0,
-    0x1f, 0xf8, 0x0, 0x3, 0xff, 0xf9, 0xff, 0x80,
-    0x0, 0x7, 0xfe, 0x0, 0x0, 0xff, 0xfe, 0x3f,
-    0xe0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x3f, 0xff,
-    0x8f, 0xf8, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0xf,
-    0xff, 0xe1, 0xfe, 0x0, 0x0, 0x1f, 0xe0, 0x0,
-    0x3, 0xff, 0xf8, 0x3f, 0x80, 0x0, 0x7, 0xf0,
-    0x0, 0x0, 0xff, 0xfe, 0xf, 0xe0, 0x0, 0x1,
-    0xfc, 0x0, 0x0, 0x3f, 0xff, 0x81, 0xf8, 0x0,
-    0x0, 0x7e, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x7e,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0x3, 0xff, 0xf8,
-    0xf, 0x80, 0x0, 0x7, 0xc0, 0x0, 0x0, 0xff,
-    0xfe, 0x1, 0xe0, 0x0, 0x1, 0xe0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xe3, 0xff, 0xf8, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0xff, 0xf1, 0xff, 0xff,
-    0x0, 0x3f, 0xff, 0xe0, 0x0, 0x3f, 0xf8, 0xff,
-    0xff, 0xe0, 0x1f, 0xff, 0xfc, 0x0, 0xf, 0xfc,
-    0x7f, 0xff, 0xf8, 0x7, 0xff, 0xff, 0x80, 0x3,
-    0xfe, 0x3f, 0xff, 0xff, 0x3, 0xff, 0xff, 0xf0,
-    0x0, 0xff, 0x1f, 0xff, 0xff, 0xc0, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf8, 0x7f,
-    0xff, 0xff, 0xc0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x87, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0xff, 0xff, 0xfe, 0x3f, 0xc0,
-    0x3, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x1f,
-    0xf0, 0x0, 0x7f, 0xff, 0xf8, 0x7, 0xff, 0xff,
-    0x8f, 0xfc, 0x0, 0xf, 0xff, 0xfe, 0x1, 0xff,
-    0xff, 0xc7, 0xff, 0x0, 0x1, 0xff, 0xff, 0x0,
-    0x3f, 0xff, 0xe3, 0xff, 0xc0, 0x0, 0x3f, 0xff,
-    0x80, 0x7, 0xff, 0xf1, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x0, 0x0, 0x3, 0xe0, 0x0, 0x1, 0xf0, 0x1f,
-    0xff, 0xc0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x7c,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x7e, 0x0, 0x0,
-    0x1f, 0x81, 0xff, 0xfc, 0x0, 0x0, 0x1f, 0x80,
-    0x0, 0x7, 0xe0, 0x7f, 0xff, 0x0, 0x0, 0xf,
-    0xe0, 0x0, 0x1, 0xfc, 0x1f, 0xff, 0xc0, 0x0,
-    0x3, 0xf8, 0x0, 0x0, 0x7f, 0x7, 0xff, 0xf0,
-    0x0, 0x1, 0xfe, 0x0, 0x0, 0x1f, 0xe1, 0xff,
-    0xfc, 0x0, 0x0, 0xff, 0x80, 0x0, 0x7, 0xfc,
-    0x7f, 0xff, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x1,
-    0xff, 0x1f, 0xff, 0xc0, 0x0, 0x1f, 0xf8, 0x0,
-    0x0, 0x7f, 0xe7, 0xff, 0xf0, 0x0, 0x7, 0xfe,
-    0x0, 0x0, 0x1f, 0xf9, 0xff, 0xfc, 0x0, 0x1,
-    0xff, 0x80, 0x0, 0x7, 0xfe, 0x7f, 0xff, 0x0,
-    0x0, 0x7f, 0xe0, 0x0, 0x1, 0xff, 0x9f, 0xff,
-    0xc0, 0x0, 0x1f, 0xf8, 0x0, 0x0, 0x7f, 0xe7,
-    0xff, 0xf0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x1f,
-    0xf9, 0xff, 0xfc, 0x0, 0x1, 0xff, 0x80, 0x0,
-    0x7, 0xfe, 0x7f, 0xff, 0x0, 0x0, 0x7f, 0xe0,
-    0x0, 0x1, 0xff, 0x9f, 0xff, 0xc0, 0x0, 0x1f,
-    0xf8, 0x0, 0x0, 0x7f, 0xe7, 0xff, 0xf0, 0x0,
-    0x7, 0xfe, 0x0, 0x0, 0x1f, 0xf9, 0xff, 0xfc,
-    0x0, 0x1, 0xff, 0x80, 0x0, 0x7, 0xfe, 0x7f,
-    0xff, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x1, 0xff,
-    0x9f, 0xff, 0xc0, 0x0, 0x1f, 0xf8, 0x0, 0x0,
-    0x7f, 0xe7, 0xff, 0xf0, 0x0, 0x7, 0xfe, 0x0,
-    0x0, 0x1f, 0xf9, 0xff, 0xfc, 0x0, 0x1, 0xff,
-    0x80, 0x0, 0x7, 0xfe, 0x7f, 0xff, 0x0, 0x0,
-    0x7f, 0xc0, 0x0, 0x0, 0xff, 0x9f, 0xff, 0xc0,
-    0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1f, 0xe7, 0xff,
-    0xf0, 0x0, 0x7, 0xf8, 0x0, 0x0, 0x7, 0xf9,
-    0xff, 0xfc, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x0,
-    0xfe, 0x7f, 0xff, 0x0, 0x0, 0x7f, 0x0, 0x0,
-    0x0, 0x3f, 0x9f, 0xff, 0xc0, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x7, 0xe7, 0xff, 0xf0, 0x0, 0x7,
-    0xc0, 0x0, 0x0, 0x0, 0xf9, 0xff, 0xfc, 0x0,
-    0x1, 0xf0, 0x0, 0x0, 0x0, 0x3e, 0x7f, 0xff,
-    0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x7, 0x9f,
-    0xff, 0xc0, 0x0, 0x1e, 0x0, 0x0, 0x0, 0x1,
-    0xe7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0x0,
-
-    /* U+0026 "&" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0,
-    0x7, 0x80, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0,
-    0x0, 0x7c, 0x0, 0x0, 0x0, 0x1f, 0x0, 0x0,
-    0x0, 0x3, 0xe0, 0x0, 0x0, 0x0, 0xfc, 0x0,
-    0x0, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x7, 0xe0,
-    0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x3f,
-    0x80, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x1,
-    0xfe, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x0,
-    0xf, 0xf0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0,
-    0x0, 0x7f, 0xc0, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x3, 0xfe, 0x0, 0x0, 0x7, 0xfc, 0x0,
-    0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0, 0x7f, 0xe0,
-    0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x1f,
-    0xf8, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0,
-    0xff, 0xc0, 0x0, 0x0, 0x1, 0xff, 0x80, 0x0,
-    0x7, 0xfe, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x0,
-    0x0, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x7f, 0xe0,
-    0x0, 0x1, 0xff, 0x80, 0x0, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x1f,
-    0xf8, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0,
-    0xff, 0xc0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0,
-    0x0, 0x3f, 0xf0, 0x0, 0x0, 0xff, 0xc0, 0x0,
-    0x0, 0x1, 0xff, 0x80, 0x0, 0x7, 0xfe, 0x0,
-    0x0, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x3f, 0xf0,
-    0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x1, 0xff,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0xf,
-    0xf8, 0x0, 0x0, 0x0, 0x7, 0xf8, 0x0, 0x0,
-    0x7f, 0x80, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xf0,
-    0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x80, 0x0, 0x7, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x7c, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xe0, 0x0, 0x1, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x80, 0x0, 0x3e, 0x0, 0x0,
-    0x1f, 0x1, 0xff, 0xfc, 0x0, 0x1, 0xf0, 0x0,
-    0x0, 0xf8, 0xf, 0xff, 0xe0, 0x0, 0x1f, 0x80,
-    0x0, 0x7, 0xe0, 0x7f, 0xff, 0x0, 0x0, 0xfc,
-    0x0, 0x0, 0x3f, 0x3, 0xff, 0xf8, 0x0, 0xf,
-    0xe0, 0x0, 0x1, 0xfc, 0x1f, 0xff, 0xc0, 0x0,
-    0x7f, 0x0, 0x0, 0xf, 0xe0, 0xff, 0xfe, 0x0,
-    0x7, 0xf8, 0x0, 0x0, 0x7f, 0x87, 0xff, 0xf0,
-    0x0, 0x7f, 0xc0, 0x0, 0x3, 0xfe, 0x3f, 0xff,
-    0x80, 0x3, 0xfe, 0x0, 0x0, 0x1f, 0xf1, 0xff,
-    0xfc, 0x0, 0x3f, 0xf0, 0x0, 0x0, 0xff, 0xcf,
-    0xff, 0xe0, 0x1, 0xff, 0x80, 0x0, 0x7, 0xfe,
-    0x7f, 0xff, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x3f,
-    0xf3, 0xff, 0xf8, 0x0, 0x7f, 0xe0, 0x0, 0x1,
-    0xff, 0x9f, 0xff, 0xc0, 0x3, 0xff, 0x0, 0x0,
-    0xf, 0xfc, 0xff, 0xfe, 0x0, 0x1f, 0xf8, 0x0,
-    0x0, 0x7f, 0xe7, 0xff, 0xf0, 0x0, 0xff, 0xc0,
-    0x0, 0x3, 0xff, 0x3f, 0xff, 0x80, 0x7, 0xfe,
-    0x0, 0x0, 0x1f, 0xf9, 0xff, 0xfc, 0x0, 0x3f,
-    0xf0, 0x0, 0x0, 0xff, 0xcf, 0xff, 0xe0, 0x1,
-    0xff, 0x80, 0x0, 0x7, 0xfe, 0x7f, 0xff, 0x0,
-    0xf, 0xfc, 0x0, 0x0, 0x3f, 0xf3, 0xff, 0xf8,
-    0x0, 0x7f, 0xe0, 0x0, 0x1, 0xff, 0x9f, 0xff,
-    0xc0, 0x3, 0xff, 0x0, 0x0, 0xf, 0xfc, 0xff,
-    0xfe, 0x0, 0x1f, 0xf8, 0x0, 0x0, 0x7f, 0xe7,
-    0xff, 0xf0, 0x0, 0xff, 0x80, 0x0, 0x1, 0xff,
-    0x3f, 0xff, 0x80, 0x7, 0xfc, 0x0, 0x0, 0xf,
-    0xf9, 0xff, 0xfc, 0x0, 0x3f, 0xc0, 0x0, 0x0,
-    0x3f, 0xcf, 0xff, 0xe0, 0x1, 0xfe, 0x0, 0x0,
-    0x1, 0xfe, 0x7f, 0xff, 0x0, 0xf, 0xe0, 0x0,
-    0x0, 0x7, 0xf3, 0xff, 0xf8, 0x0, 0x7e, 0x0,
-    0x0, 0x0, 0x1f, 0x9f, 0xff, 0xc0, 0x3, 0xf0,
-    0x0, 0x0, 0x0, 0xfc, 0xff, 0xfe, 0x0, 0x1f,
-    0x0, 0x0, 0x0, 0x3, 0xe7, 0xff, 0xf0, 0x0,
-    0xf8, 0x0, 0x0, 0x0, 0x1f, 0x3f, 0xff, 0x80,
-    0x7, 0x80, 0x0, 0x0, 0x0, 0x79, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf8, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc7, 0xff, 0xc0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1f, 0xfe, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x7f, 0xf0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0x80, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc7, 0xfc, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x1f, 0xe0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x7e, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xe0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0,
-
-    /* U+0027 "'" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xcf, 0xff,
-    0x8f, 0xfe, 0x1f, 0xfc, 0x1f, 0xf0, 0x1f, 0xc0,
-    0x3f, 0x80, 0x3e, 0x0, 0x7c, 0x0, 0x70, 0x0,
-    0xe0, 0x0, 0x80,
-
-    /* U+0028 "(" */
-    0x3, 0xc1, 0xf0, 0x7c, 0x3f, 0xf, 0xc7, 0xf3,
-    0xfc, 0xff, 0x7f, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf,
-    0xef, 0xf3, 0xf8, 0xfe, 0x3f, 0xf, 0xc3, 0xe0,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf8, 0x3e, 0xf, 0xc3, 0xf0, 0xfe, 0x3f,
-    0x8f, 0xf3, 0xfe, 0xff, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0x7f,
-    0xcf, 0xf3, 0xfc, 0x7f, 0xf, 0xc3, 0xf0, 0x7c,
-    0x1f, 0x3, 0xc0,
-
-    /* U+0029 ")" */
-    0xf0, 0x3e, 0xf, 0x83, 0xf0, 0xfc, 0x3f, 0x8f,
-    0xf3, 0xfc, 0xff, 0xbf, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xdf,
-    0xf3, 0xfc, 0x7f, 0x1f, 0xc3, 0xf0, 0xfc, 0x1f,
-    0x7, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xc1, 0xf0, 0xfc, 0x3f, 0x1f, 0xc7,
-    0xf3, 0xfd, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xbf, 0xcf, 0xf3, 0xf8, 0xfc, 0x3f, 0xf, 0x83,
-    0xe0, 0xf0, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0xf0, 0xf, 0xff, 0xe0, 0xf, 0x0, 0x0,
-    0xf8, 0xf, 0xff, 0xe0, 0x1f, 0x0, 0x0, 0xf8,
-    0xf, 0xff, 0xe0, 0x1f, 0x0, 0x0, 0xfc, 0xf,
-    0xff, 0xe0, 0x3f, 0x0, 0x0, 0xfc, 0xf, 0xff,
-    0xe0, 0x3f, 0x0, 0x0, 0xfe, 0xf, 0xff, 0xe0,
-    0x7f, 0x0, 0x0, 0xff, 0xf, 0xff, 0xe0, 0xff,
-    0x0, 0x0, 0xff, 0xf, 0xff, 0xe0, 0xff, 0x0,
-    0x0, 0xff, 0x8f, 0xff, 0xe1, 0xff, 0x0, 0x0,
-    0xff, 0x8f, 0xff, 0xe1, 0xff, 0x0, 0x0, 0xff,
-    0xcf, 0xff, 0xe3, 0xff, 0x0, 0x0, 0xff, 0xcf,
-    0xff, 0xe3, 0xff, 0x0, 0x0, 0xff, 0xcf, 0xff,
-    0xe3, 0xff, 0x0, 0x0, 0xff, 0xcf, 0xff, 0xe3,
-    0xff, 0x0, 0x0, 0xff, 0xcf, 0xff, 0xe3, 0xff,
-    0x0, 0x0, 0xff, 0xcf, 0xff, 0xe3, 0xff, 0x0,
-    0x0, 0xff, 0xcf, 0xff, 0xe3, 0xff, 0x0, 0x0,
-    0xff, 0xcf, 0xff, 0xe3, 0xff, 0x0, 0x0, 0xff,
-    0xcf, 0xff, 0xe3, 0xff, 0x0, 0x0, 0xff, 0xcf,
-    0xff, 0xe3, 0xff, 0x0, 0x0, 0xff, 0xcf, 0xff,
-    0xe3, 0xff, 0x0, 0x0, 0xff, 0xcf, 0xff, 0xe3,
-    0xff, 0x0, 0x0, 0xff, 0xcf, 0xff, 0xe3, 0xff,
-    0x0, 0x0, 0xff, 0xcf, 0xff, 0xe3, 0xff, 0x0,
-    0x0, 0x7f, 0xcf, 0xff, 0xe3, 0xfe, 0x0, 0x0,
-    0x7f, 0xcf, 0xff, 0xe3, 0xfe, 0x0, 0x0, 0x3f,
-    0xcf, 0xff, 0xe3, 0xfc, 0x0, 0x0, 0x1f, 0xcf,
-    0xff, 0xe3, 0xf8, 0x0, 0x0, 0x1f, 0xc7, 0xff,
-    0xc3, 0xf8, 0x0, 0x0, 0xf, 0xc7, 0xff, 0xc3,
-    0xf0, 0x0, 0x0, 0xf, 0xc3, 0xff, 0x83, 0xf0,
-    0x0, 0x0, 0x7, 0xc1, 0xff, 0x3, 0xe0, 0x0,
-    0x0, 0x3, 0xc1, 0xff, 0x3, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x7c, 0x7f, 0xff, 0x80, 0x3, 0xff, 0xfe, 0x7c,
-    0xff, 0xff, 0xc0, 0x7, 0xff, 0xfe, 0x38, 0xff,
-    0xff, 0xe0, 0xf, 0xff, 0xff, 0x11, 0xff, 0xff,
-    0xf0, 0x1f, 0xff, 0xff, 0x11, 0xff, 0xff, 0xf8,
-    0x3f, 0xff, 0xff, 0x83, 0xff, 0xff, 0xfc, 0x7f,
-    0xff, 0xff, 0x83, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xff, 0xc7, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff,
-    0x83, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x83,
-    0xff, 0xff, 0xfc, 0x1f, 0xff, 0xff, 0x11, 0xff,
-    0xff, 0xf8, 0xf, 0xff, 0xff, 0x11, 0xff, 0xff,
-    0xf0, 0x7, 0xff, 0xfe, 0x38, 0xff, 0xff, 0xe0,
-    0x3, 0xff, 0xfe, 0x7c, 0xff, 0xff, 0xc0, 0x1,
-    0xff, 0xfc, 0x7c, 0x7f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x7, 0xc1, 0xff,
-    0x3, 0xe0, 0x0, 0x0, 0x7, 0xc1, 0xff, 0x3,
-    0xe0, 0x0, 0x0, 0xf, 0xc3, 0xff, 0x83, 0xf0,
-    0x0, 0x0, 0xf, 0xc7, 0xff, 0xc3, 0xf0, 0x0,
-    0x0, 0x1f, 0xc7, 0xff, 0xc3, 0xf8, 0x0, 0x0,
-    0x1f, 0xcf, 0xff, 0xe3, 0xf8, 0x0, 0x0, 0x3f,
-    0xcf, 0xff, 0xe3, 0xfc, 0x0, 0x0, 0x7f, 0xcf,
-    0xff, 0xe3, 0xfe, 0x0, 0x0, 0x7f, 0xcf, 0xff,
-    0xe3, 0xfe, 0x0, 0x0, 0xff, 0xcf, 0xff, 0xe3,
-    0xff, 0x0, 0x0, 0xff, 0xcf, 0xff, 0xe3, 0xff,
-    0x0, 0x0, 0xff, 0xcf, 0xff, 0xe3, 0xff, 0x0,
-    0x0, 0xff, 0xcf, 0xff, 0xe3, 0xff, 0x0, 0x0,
-    0xff, 0xcf, 0xff, 0xe3, 0xff, 0x0, 0x0, 0xff,
-    0xcf, 0xff, 0xe3, 0xff, 0x0, 0x0, 0xff, 0xcf,
-    0xff, 0xe3, 0xff, 0x0, 0x0, 0xff, 0xcf, 0xff,
-    0xe3, 0xff, 0x0, 0x0, 0xff, 0xcf, 0xff, 0xe3,
-    0xff, 0x0, 0x0, 0xff, 0xcf, 0xff, 0xe3, 0xff,
-    0x0, 0x0, 0xff, 0xcf, 0xff, 0xe3, 0xff, 0x0,
-    0x0, 0xff, 0xcf, 0xff, 0xe3, 0xff, 0x0, 0x0,
-    0xff, 0xcf, 0xff, 0xe3, 0xff, 0x0, 0x0, 0xff,
-    0xcf, 0xff, 0xe3, 0xff, 0x0, 0x0, 0xff, 0xcf,
-    0xff, 0xe3, 0xff, 0x0, 0x0, 0xff, 0x8f, 0xff,
-    0xe1, 0xff, 0x0, 0x0, 0xff, 0xf, 0xff, 0xe0,
-    0xff, 0x0, 0x0, 0xff, 0xf, 0xff, 0xe0, 0xff,
-    0x0, 0x0, 0xfe, 0xf, 0xff, 0xe0, 0x7f, 0x0,
-    0x0, 0xfe, 0xf, 0xff, 0xe0, 0x7f, 0x0, 0x0,
-    0xfc, 0xf, 0xff, 0xe0, 0x3f, 0x0, 0x0, 0xf8,
-    0xf, 0xff, 0xe0, 0x1f, 0x0, 0x0, 0xf8, 0xf,
-    0xff, 0xe0, 0x1f, 0x0, 0x0, 0xf0, 0xf, 0xff,
-    0xe0, 0xf, 0x0, 0x0, 0xf0, 0xf, 0xff, 0xe0,
-    0xf, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfe,
-    0x3e, 0x3f, 0xff, 0x80, 0x3, 0xff, 0xff, 0x3e,
-    0x7f, 0xff, 0xc0, 0x7, 0xff, 0xff, 0x1c, 0x7f,
-    0xff, 0xe0, 0xf, 0xff, 0xff, 0x88, 0xff, 0xff,
-    0xf0, 0x1f, 0xff, 0xff, 0x88, 0xff, 0xff, 0xf8,
-    0x3f, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xfc, 0x7f,
-    0xff, 0xff, 0xc1, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xff, 0xe3, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff,
-    0xc1, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xc1,
-    0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0x88, 0xff,
-    0xff, 0xfc, 0xf, 0xff, 0xff, 0x88, 0xff, 0xff,
-    0xf8, 0x7, 0xff, 0xff, 0x1c, 0x7f, 0xff, 0xf0,
-    0x3, 0xff, 0xff, 0x3e, 0x7f, 0xff, 0xe0, 0x1,
-    0xff, 0xfe, 0x3e, 0x3f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0,
-
-    /* U+002C "," */
-    0x7, 0xc1, 0xf0, 0xfc, 0x3f, 0x1f, 0xcf, 0xf3,
-    0xfd, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xbf,
-    0xcf, 0xf3, 0xf8, 0xfc, 0x3f, 0xf, 0x83, 0xe0,
-    0xf0, 0x0,
-
-    /* U+002D "-" */
-    0x1, 0xff, 0xfc, 0x0, 0x7f, 0xff, 0x80, 0x3,
-    0xff, 0xfe, 0x0, 0x7f, 0xff, 0xc0, 0x7, 0xff,
-    0xff, 0x0, 0xff, 0xff, 0xe0, 0xf, 0xff, 0xff,
-    0x0, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0x81,
-    0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0x81, 0xff,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xc3, 0xff, 0xff,
-    0xfe, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff,
-    0x7f, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xfe, 0x3f,
-    0xff, 0xff, 0x81, 0xff, 0xff, 0xfc, 0x1f, 0xff,
-    0xff, 0x81, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff,
-    0x0, 0xff, 0xff, 0xf0, 0x7, 0xff, 0xff, 0x0,
-    0xff, 0xff, 0xe0, 0x3, 0xff, 0xfe, 0x0, 0x7f,
-    0xff, 0xc0, 0x1, 0xff, 0xfe, 0x0, 0x7f, 0xff,
-    0x80,
-
-    /* U+002E "." */
-    0x7, 0xc0, 0x3f, 0xe0, 0xff, 0xe3, 0xff, 0xe7,
-    0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xf3, 0xff, 0xe3, 0xff,
-    0x83, 0xfe, 0x1, 0xf0, 0x0,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x0,
-    0x3, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0,
-    0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x3,
-    0xf8, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0,
-    0x0, 0x3, 0xf0, 0x0, 0x0, 0x0, 0x3, 0xf0,
-    0x0, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0, 0x0,
-    0x3, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xc0,
-    0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0xf, 0xc0, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x3f,
-    0xc0, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0x0,
-    0x0, 0x7f, 0xc0, 0x0, 0x0, 0x0, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xf0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x60, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3c, 0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x1f, 0xbf, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x1, 0xe7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x79, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x9f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x7, 0xe7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x3, 0xf9, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x9f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x1f, 0xe7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xf, 0xf9,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7,
-    0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x7f, 0xe7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x1f, 0xf9, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xff, 0x9f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f,
-    0xe7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x1f, 0xf9, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x7, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x9f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x7f, 0xe7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xf9, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xfe,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x9f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x7f, 0xc7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x1f, 0xf1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x7, 0xf8, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f,
-    0xc1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x7, 0xe0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x1, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x7c, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x3e, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0xf, 0x80, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x7, 0xe0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x83, 0xf8, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0xfe,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x7f, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x1f, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe3, 0xfe, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf9, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xe0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x9f,
-    0xf8, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe7, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf9, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x7f, 0xe0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x9f, 0xf8, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe7, 0xfe, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf9, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x7f, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x9f, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe7, 0xfe, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf9, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xe0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x9f, 0xf0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe7,
-    0xf8, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf9, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x9f, 0xc0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe7, 0xe0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf9, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x7c,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x9e, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe7, 0x80, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
-    0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1f, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe3, 0xfd, 0xf8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7e, 0x3c, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x8f, 0x6, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x80, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-
-    /* U+0031 "1" */
-    0x0, 0x30, 0x0, 0xf0, 0x3, 0xf0, 0xf, 0xf0,
-    0x3f, 0xe0, 0xff, 0xc3, 0xff, 0x8f, 0xff, 0x3f,
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff,
-    0x9f, 0xff, 0x1f, 0xfe, 0x1f, 0xfc, 0x1f, 0xf8,
-    0x1f, 0xf0, 0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfe, 0x7, 0xfc, 0x1f, 0xf8, 0x7f,
-    0xf1, 0xff, 0xe7, 0xff, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xff, 0xf9, 0xff, 0xf1, 0xff, 0xe1, 0xff, 0xc1,
-    0xff, 0x81, 0xff, 0x1, 0xfe, 0x1, 0xfc, 0x1,
-    0xf0, 0x1, 0xc0, 0x1, 0x0,
-
-    /* U+0032 "2" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x60, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3c, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x1f, 0x80, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xf0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0xfc, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff,
-    0xc0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xf0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xc0, 0xf,
-    0xff, 0xf1, 0xff, 0xf0, 0x0, 0x1f, 0xff, 0xf0,
-    0x3, 0xff, 0xfe, 0x3f, 0xfc, 0x0, 0xf, 0xff,
-    0xfe, 0x1, 0xff, 0xff, 0xc7, 0xff, 0x0, 0x7,
-    0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8, 0xff, 0xc0,
-    0x3, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x1f,
-    0xf0, 0x1, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff,
-    0xe3, 0xfc, 0x0, 0xff, 0xff, 0xff, 0x87, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xf, 0xff, 0xff,
-    0xf8, 0x7f, 0xff, 0xff, 0xc0, 0xf, 0xf1, 0xff,
-    0xff, 0xfc, 0xf, 0xff, 0xff, 0xe0, 0x3, 0xfe,
-    0x3f, 0xff, 0xff, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0xff, 0xc7, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8,
-    0x0, 0x3f, 0xf8, 0xff, 0xff, 0xe0, 0x1f, 0xff,
-    0xfc, 0x0, 0xf, 0xff, 0x1f, 0xff, 0xf0, 0x3,
-    0xff, 0xfe, 0x0, 0x3, 0xff, 0xe3, 0xff, 0xfc,
-    0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xff,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x3f, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0xf, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x1, 0xf8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x3c, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x6, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-
-    /* U+0033 "3" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3c, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0xf0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xc0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xfe, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xf0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff,
-    0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f,
-    0xfc, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xe3,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0x80, 0xf, 0xff, 0xe0, 0x3, 0xff, 0xfc,
-    0x7f, 0xfc, 0x0, 0xff, 0xff, 0x80, 0x1f, 0xff,
-    0xf1, 0xff, 0xe0, 0xf, 0xff, 0xfc, 0x1, 0xff,
-    0xff, 0xc7, 0xff, 0x0, 0xff, 0xff, 0xf0, 0xf,
-    0xff, 0xff, 0x1f, 0xf8, 0xf, 0xff, 0xff, 0xc0,
-    0xff, 0xff, 0xfc, 0x7f, 0xc0, 0xff, 0xff, 0xfe,
-    0xf, 0xff, 0xff, 0xf1, 0xfe, 0xf, 0xff, 0xff,
-    0xf8, 0x7f, 0xff, 0xff, 0xc0, 0x0, 0xff, 0xff,
-    0xff, 0xc7, 0xff, 0xff, 0xff, 0x0, 0x3, 0xff,
-    0xff, 0xfe, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0xf,
-    0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0x1f, 0xe0,
-    0x3f, 0xff, 0xff, 0x3, 0xff, 0xff, 0xf1, 0xff,
-    0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x1f,
-    0xf8, 0x3, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xf1,
-    0xff, 0xc0, 0xf, 0xff, 0xf8, 0x1, 0xff, 0xff,
-    0x1f, 0xfe, 0x0, 0x3f, 0xff, 0x80, 0xf, 0xff,
-    0xf1, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xf8, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc7, 0xff, 0xc0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1f, 0xfe, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x7f, 0xf0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0x80, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc7, 0xfc, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x1f, 0xe0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x7e, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xe0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0,
-
-    /* U+0034 "4" */
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xc7, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfb, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xfc, 0x0,
-    0xff, 0xff, 0x1f, 0xff, 0xff, 0xf1, 0xff, 0xff,
-    0x0, 0x3f, 0xff, 0xe3, 0xff, 0xff, 0xf8, 0xff,
-    0xff, 0xe0, 0x1f, 0xff, 0xfc, 0x7f, 0xff, 0xfc,
-    0x7f, 0xff, 0xf8, 0x7, 0xff, 0xff, 0x8f, 0xff,
-    0xfe, 0x3f, 0xff, 0xff, 0x3, 0xff, 0xff, 0xf1,
-    0xff, 0xff, 0x1f, 0xff, 0xff, 0xc0, 0xff, 0xff,
-    0xfe, 0x3f, 0xc0, 0xf, 0xff, 0xff, 0xf8, 0x7f,
-    0xff, 0xff, 0xc0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x87, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0xff, 0xff, 0xfe, 0x3f, 0xc0,
-    0x3, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x1f,
-    0xf0, 0x0, 0x7f, 0xff, 0xf8, 0x7, 0xff, 0xff,
-    0x8f, 0xfc, 0x0, 0xf, 0xff, 0xfe, 0x1, 0xff,
-    0xff, 0xc7, 0xff, 0x0, 0x1, 0xff, 0xff, 0x0,
-    0x3f, 0xff, 0xe3, 0xff, 0xc0, 0x0, 0x3f, 0xff,
-    0xc0, 0xf, 0xff, 0xf1, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x0,
-
-    /* U+0035 "5" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x3f, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0xf, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x3f, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0xf, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfe, 0x3f, 0xff, 0xc0, 0xf,
-    0xff, 0xf0, 0x0, 0xf, 0xff, 0x1f, 0xff, 0xf0,
-    0x3, 0xff, 0xfe, 0x0, 0x3, 0xff, 0x8f, 0xff,
-    0xfe, 0x1, 0xff, 0xff, 0xc0, 0x0, 0xff, 0xc7,
-    0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8, 0x0, 0x3f,
-    0xe3, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x0,
-    0xf, 0xf1, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x87, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xf, 0xff, 0xff,
-    0xf8, 0x7f, 0xff, 0xff, 0xc0, 0x0, 0x1, 0xff,
-    0xff, 0xfc, 0xf, 0xff, 0xff, 0xe3, 0xfc, 0x0,
-    0x3f, 0xff, 0xff, 0x3, 0xff, 0xff, 0xf1, 0xff,
-    0x0, 0x7, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8,
-    0xff, 0xc0, 0x0, 0xff, 0xff, 0xe0, 0x1f, 0xff,
-    0xfc, 0x7f, 0xf0, 0x0, 0x1f, 0xff, 0xf0, 0x3,
-    0xff, 0xfe, 0x3f, 0xfc, 0x0, 0x3, 0xff, 0xfc,
-    0x0, 0xff, 0xff, 0x1f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0xf0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3f, 0xfc, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1f, 0xf0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe3, 0xfc, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7e, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x8f, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x80, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x3f, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0xf, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x3f, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0xf, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfe, 0x3f, 0xff, 0xc0, 0xf,
-    0xff, 0xf0, 0x0, 0xf, 0xff, 0x1f, 0xff, 0xf0,
-    0x3, 0xff, 0xfe, 0x0, 0x3, 0xff, 0x8f, 0xff,
-    0xfe, 0x1, 0xff, 0xff, 0xc0, 0x0, 0xff, 0xc7,
-    0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8, 0x0, 0x3f,
-    0xe3, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x0,
-    0xf, 0xf1, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x87, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xf, 0xff, 0xff,
-    0xf8, 0x7f, 0xff, 0xff, 0xc0, 0xf, 0xf1, 0xff,
-    0xff, 0xfc, 0xf, 0xff, 0xff, 0xe3, 0xff, 0xfe,
-    0x3f, 0xff, 0xff, 0x3, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xc7, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8,
-    0xff, 0xff, 0xf8, 0xff, 0xff, 0xe0, 0x1f, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0x1f, 0xff, 0xf0, 0x3,
-    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xe3, 0xff, 0xfc,
-    0x0, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
-    0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1f, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe3, 0xfd, 0xf8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7e, 0x3c, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x8f, 0x6, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x80, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-
-    /* U+0037 "7" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x60, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3c, 0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x1f, 0xbf, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x60, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3c, 0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x1f, 0xbf, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xc0, 0xf,
-    0xff, 0xf1, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xf0,
-    0x3, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x8f, 0xff,
-    0xfe, 0x1, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x1f,
-    0xff, 0xf1, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff,
-    0xe3, 0xfc, 0x0, 0xff, 0xff, 0xff, 0x87, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xf, 0xff, 0xff,
-    0xf8, 0x7f, 0xff, 0xff, 0xc0, 0xf, 0xf1, 0xff,
-    0xff, 0xfc, 0xf, 0xff, 0xff, 0xe3, 0xff, 0xfe,
-    0x3f, 0xff, 0xff, 0x3, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xc7, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8,
-    0xff, 0xff, 0xf8, 0xff, 0xff, 0xe0, 0x1f, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0x1f, 0xff, 0xf0, 0x3,
-    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xe3, 0xff, 0xfc,
-    0x0, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
-    0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1f, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe3, 0xfd, 0xf8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7e, 0x3c, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x8f, 0x6, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x80, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x60, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3c, 0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x1f, 0xbf, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xc0, 0xf,
-    0xff, 0xf1, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xf0,
-    0x3, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x8f, 0xff,
-    0xfe, 0x1, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x1f,
-    0xff, 0xf1, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff,
-    0xe3, 0xfc, 0x0, 0xff, 0xff, 0xff, 0x87, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xf, 0xff, 0xff,
-    0xf8, 0x7f, 0xff, 0xff, 0xc0, 0x0, 0x1, 0xff,
-    0xff, 0xfc, 0xf, 0xff, 0xff, 0xe3, 0xfc, 0x0,
-    0x3f, 0xff, 0xff, 0x3, 0xff, 0xff, 0xf1, 0xff,
-    0x0, 0x7, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8,
-    0xff, 0xc0, 0x0, 0xff, 0xff, 0xe0, 0x1f, 0xff,
-    0xfc, 0x7f, 0xf0, 0x0, 0x1f, 0xff, 0xf0, 0x3,
-    0xff, 0xfe, 0x3f, 0xfc, 0x0, 0x3, 0xff, 0xfc,
-    0x0, 0xff, 0xff, 0x1f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0xf0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3f, 0xfc, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1f, 0xf0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe3, 0xfc, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7e, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x8f, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x80, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-
-    /* U+003A ":" */
-    0x7, 0xc0, 0x3f, 0xe0, 0xff, 0xe3, 0xff, 0xe7,
-    0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xf3, 0xff, 0xe3, 0xff,
-    0x83, 0xfe, 0x1, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x80, 0x7f, 0xc1,
-    0xff, 0xc7, 0xff, 0xcf, 0xff, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff,
-    0xe7, 0xff, 0xc7, 0xff, 0x7, 0xfc, 0x3, 0xe0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-
-    /* U+003D "=" */
-    0x0, 0x1f, 0xff, 0xc0, 0x7, 0xff, 0xf8, 0x0,
-    0x0, 0x3f, 0xff, 0xe0, 0x7, 0xff, 0xfc, 0x0,
-    0x0, 0x7f, 0xff, 0xf0, 0xf, 0xff, 0xfe, 0x0,
-    0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0,
-    0x1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x80,
-    0x3, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xc0,
-    0x7, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xe0,
-    0xf, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xf0,
-    0x7, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xe0,
-    0x3, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xc0,
-    0x1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x80,
-    0x0, 0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x0,
-    0x0, 0x7f, 0xff, 0xf0, 0xf, 0xff, 0xfe, 0x0,
-    0x0, 0x3f, 0xff, 0xe0, 0x7, 0xff, 0xfc, 0x0,
-    0x0, 0x1f, 0xff, 0xe0, 0x7, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+003E ">" */
-    0x0, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-
-    /* U+003F "?" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x6, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0xc1, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3c, 0x7e, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xdf, 0xe3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xfe, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f,
-    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x8f, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe3, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xc7, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfc, 0x7f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc7, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc,
-    0x7f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x23, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x7f, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xc7, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7c,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x8f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x6, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0xc1, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3c, 0x7e, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xdf, 0xe3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xfe, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f,
-    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x8f, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe3, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xc7, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfc, 0x7f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xc7, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc,
-    0x7f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xc7, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x23, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x4, 0x7f, 0xff, 0xfc,
-    0x7f, 0xff, 0xfc, 0x0, 0x0, 0x1, 0xc7, 0xff,
-    0xff, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x7c,
-    0xff, 0xff, 0xc7, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0xf, 0x8f, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x3, 0xf8, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x1f, 0xf0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x3, 0xfe, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xff,
-    0xe0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x3f, 0xfe, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x7, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80, 0x0,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0xff,
-    0xfe, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x7f, 0xff, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x7f, 0xff,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xff, 0xfe, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x7f, 0xff, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0xff, 0xfe, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7f, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc7, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7f, 0xff, 0xfc, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7,
-    0xfb, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7e, 0x3c, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc7, 0x83, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x60, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x60, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3c, 0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x1f, 0xbf, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xc0, 0xf,
-    0xff, 0xf1, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xf0,
-    0x3, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x8f, 0xff,
-    0xfe, 0x1, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x1f,
-    0xff, 0xf1, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff,
-    0xe3, 0xfc, 0x0, 0xff, 0xff, 0xff, 0x87, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xf, 0xff, 0xff,
-    0xf8, 0x7f, 0xff, 0xff, 0xc0, 0xf, 0xf1, 0xff,
-    0xff, 0xfc, 0xf, 0xff, 0xff, 0xe3, 0xff, 0xfe,
-    0x3f, 0xff, 0xff, 0x3, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xc7, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8,
-    0xff, 0xff, 0xf8, 0xff, 0xff, 0xe0, 0x1f, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0x1f, 0xff, 0xf0, 0x3,
-    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xe3, 0xff, 0xfc,
-    0x0, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x7c, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x8e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xc1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20,
-
-    /* U+0042 "B" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3c, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0xf0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xc0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xfe, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xf0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff,
-    0x80, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f,
-    0xfc, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x1,
-    0xff, 0xf0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0xf, 0xff, 0x80, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x3f, 0xf8, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x1f,
-    0xff, 0x80, 0x0, 0x0, 0x3, 0xe3, 0xff, 0xfc,
-    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x1f, 0x3f, 0xff,
-    0xf1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x71, 0xff,
-    0xff, 0xc7, 0xff, 0x0, 0x0, 0x0, 0x1, 0x1f,
-    0xff, 0xff, 0x1f, 0xf8, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xfc, 0x7f, 0xc0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf1, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x1f, 0xe0,
-    0x0, 0x0, 0x0, 0x23, 0xff, 0xff, 0xf1, 0xff,
-    0x0, 0x0, 0x0, 0x1, 0x1f, 0xff, 0xff, 0x1f,
-    0xf8, 0x0, 0x0, 0x0, 0x1c, 0x7f, 0xff, 0xf1,
-    0xff, 0xc0, 0x0, 0x0, 0x1, 0xf3, 0xff, 0xff,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0xf, 0x8f, 0xff,
-    0xf1, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x7, 0xf0,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f,
-    0xc0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x3,
-    0xfe, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x3f, 0xf8, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-    0x3, 0xff, 0xe0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x1f, 0xff, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xf8, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc7, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1f, 0xfe, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x7f, 0xf0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0x81, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc7, 0xfc, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x1f, 0xe1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x7e, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xe1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x63, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x7e, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xf8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xe3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf,
-    0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x7f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x3, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x3f, 0xfc, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x1, 0xff, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0xf, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x7f, 0xc7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3, 0xfc, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xf, 0xc7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3c, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xc7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8,
-
-    /* U+0044 "D" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3c, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0xf0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xc0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xfe, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xf0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff,
-    0x80, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f,
-    0xfc, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x3f,
-    0xfe, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x1,
-    0xff, 0xf0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x7, 0xff, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x1f, 0xf0, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x3, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0xf,
-    0xff, 0x80, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0xe, 0x0, 0x0,
-    0x0, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x20, 0x0,
-    0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x1, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0,
-    0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x3f, 0xe0,
-    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x3f,
-    0xf8, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x3,
-    0xff, 0xc0, 0x0, 0x0, 0x1, 0xf0, 0x0, 0x0,
-    0x3f, 0xfe, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0,
-    0x3, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0xf, 0xf8,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f,
-    0xc0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x7,
-    0xff, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x7f, 0xfc, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-    0x3, 0xff, 0xe0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x3f, 0xff, 0x80, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf8, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc7, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1f, 0xfe, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x7f, 0xf0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0x81, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc7, 0xfc, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x1f, 0xe1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x7e, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xe1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0,
-
-    /* U+0045 "E" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x63, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x7e, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xf8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xe3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf,
-    0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x7f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x3, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xfc, 0x7f, 0xff, 0x80, 0xf, 0xff,
-    0xe0, 0x3, 0xff, 0xc7, 0xff, 0xfc, 0x0, 0xff,
-    0xff, 0x80, 0x1f, 0xfc, 0x7f, 0xff, 0xf0, 0x7,
-    0xff, 0xfe, 0x0, 0xff, 0xc7, 0xff, 0xff, 0x80,
-    0x7f, 0xff, 0xf8, 0x7, 0xfc, 0x7f, 0xff, 0xfe,
-    0x7, 0xff, 0xff, 0xe0, 0x3f, 0xc7, 0xff, 0xff,
-    0xf8, 0x3f, 0xff, 0xff, 0x80, 0x0, 0x7f, 0xff,
-    0xff, 0xc3, 0xff, 0xff, 0xfe, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x1f,
-    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x83, 0xfc,
-    0x7f, 0xff, 0xff, 0x83, 0xff, 0xff, 0xf8, 0x1f,
-    0xf1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x80,
-    0xff, 0xc7, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8,
-    0x7, 0xff, 0x1f, 0xff, 0xfc, 0x1, 0xff, 0xff,
-    0x80, 0x3f, 0xfc, 0x7f, 0xff, 0xc0, 0xf, 0xff,
-    0xf8, 0x1, 0xff, 0xf1, 0xff, 0xfe, 0x0, 0x3f,
-    0xff, 0x80, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x3f, 0xfc, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x1, 0xff, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0xf, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x7f, 0xc7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3, 0xfc, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xf, 0xc7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3c, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xc7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8,
-
-    /* U+0046 "F" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x63, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x7e, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xf8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xe3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf,
-    0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x7f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x3, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xfc, 0x7f, 0xff, 0x80, 0xf, 0xff,
-    0xe0, 0x3, 0xff, 0xc7, 0xff, 0xfc, 0x0, 0xff,
-    0xff, 0x80, 0x1f, 0xfc, 0x7f, 0xff, 0xf0, 0x7,
-    0xff, 0xfe, 0x0, 0xff, 0xc7, 0xff, 0xff, 0x80,
-    0x7f, 0xff, 0xf8, 0x7, 0xfc, 0x7f, 0xff, 0xfe,
-    0x7, 0xff, 0xff, 0xe0, 0x3f, 0xc7, 0xff, 0xff,
-    0xf8, 0x3f, 0xff, 0xff, 0x80, 0x0, 0x7f, 0xff,
-    0xff, 0xc3, 0xff, 0xff, 0xfe, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x1f,
-    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x83, 0xfc,
-    0x7f, 0xff, 0xff, 0x83, 0xff, 0xff, 0xf8, 0x1f,
-    0xf1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x80,
-    0xff, 0xc7, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8,
-    0x7, 0xff, 0x1f, 0xff, 0xfc, 0x1, 0xff, 0xff,
-    0x80, 0x3f, 0xfc, 0x7f, 0xff, 0xc0, 0xf, 0xff,
-    0xf8, 0x1, 0xff, 0xf1, 0xff, 0xfe, 0x0, 0x3f,
-    0xff, 0x80, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x3f, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0xf, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x3f, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0xf, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xfe, 0x0, 0x3, 0xff, 0x80, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xc0, 0x0, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0, 0x3f,
-    0xe0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0xf, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xc0, 0xf, 0xf0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xe3, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
-    0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1f, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe3, 0xfd, 0xf8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7e, 0x3c, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x8f, 0x6, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x80, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-
-    /* U+0048 "H" */
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xc7, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfb, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xfc, 0x0,
-    0xff, 0xff, 0x1f, 0xff, 0xff, 0xf1, 0xff, 0xff,
-    0x0, 0x3f, 0xff, 0xe3, 0xff, 0xff, 0xf8, 0xff,
-    0xff, 0xe0, 0x1f, 0xff, 0xfc, 0x7f, 0xff, 0xfc,
-    0x7f, 0xff, 0xf8, 0x7, 0xff, 0xff, 0x8f, 0xff,
-    0xfe, 0x3f, 0xff, 0xff, 0x3, 0xff, 0xff, 0xf1,
-    0xff, 0xff, 0x1f, 0xff, 0xff, 0xc0, 0xff, 0xff,
-    0xfe, 0x3f, 0xc0, 0xf, 0xff, 0xff, 0xf8, 0x7f,
-    0xff, 0xff, 0xc0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x87, 0xff, 0xff, 0xfc, 0x0, 0xff, 0x1f,
-    0xff, 0xff, 0xc0, 0xff, 0xff, 0xfe, 0x3f, 0xff,
-    0xe3, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x1f,
-    0xff, 0xfc, 0x7f, 0xff, 0xf8, 0x7, 0xff, 0xff,
-    0x8f, 0xff, 0xff, 0x8f, 0xff, 0xfe, 0x1, 0xff,
-    0xff, 0xc7, 0xff, 0xff, 0xf1, 0xff, 0xff, 0x0,
-    0x3f, 0xff, 0xe3, 0xff, 0xff, 0xfe, 0x3f, 0xff,
-    0xc0, 0xf, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf7, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf8, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x0,
-
-    /* U+0049 "I" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8,
-
-    /* U+004A "J" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xdf, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc7, 0xe3, 0xc7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xf0, 0x63, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-
-    /* U+004B "K" */
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xf7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xfb, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x7, 0xf9, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x3, 0xf8, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x1, 0xfc, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xfc, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x7e, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x3e, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xf1, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xf1,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x7f, 0xf1, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x3f, 0xf1, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x1f, 0xf1, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0xf, 0xf1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xff,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x7f, 0xc7,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x3f, 0xf1, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x1f, 0xfc, 0x7f, 0xff,
-    0xf0, 0x0, 0x0, 0xf, 0xff, 0x1f, 0xff, 0xf0,
-    0x0, 0x0, 0x7, 0xff, 0xc7, 0xff, 0xf8, 0x0,
-    0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xf0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x7e, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x3f, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x1f, 0xc7, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0xf, 0xe3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x7, 0xf9, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x3,
-    0xfe, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+004C "L" */
-    0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xf, 0xff,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x7f,
-    0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3,
-    0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x1f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0xf, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x31, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-
-    /* U+004D "M" */
-    0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xc7, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf9,
-    0xe0, 0x0, 0x0, 0x0, 0x1e, 0x7f, 0xff, 0xff,
-    0xfe, 0x78, 0x0, 0x0, 0x0, 0x7, 0x9f, 0xff,
-    0xff, 0xff, 0x9f, 0x0, 0x0, 0x0, 0x3, 0xe7,
-    0xff, 0xff, 0xff, 0xe7, 0xc0, 0x0, 0x0, 0x0,
-    0xf9, 0xff, 0xff, 0xff, 0xf9, 0xf8, 0x0, 0x0,
-    0x0, 0x7e, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0x0,
-    0x0, 0x0, 0x3f, 0x9f, 0xff, 0xff, 0xff, 0x9f,
-    0xc0, 0x0, 0x0, 0xf, 0xe7, 0xff, 0xff, 0xff,
-    0xe7, 0xf8, 0x0, 0x0, 0x7, 0xf9, 0xff, 0xff,
-    0xff, 0xf9, 0xfe, 0x0, 0x0, 0x1, 0xfe, 0x7f,
-    0xff, 0xff, 0xfe, 0x7f, 0xc0, 0x0, 0x0, 0xff,
-    0x9f, 0xff, 0xff, 0xff, 0x9f, 0xf8, 0x0, 0x0,
-    0x7f, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xfe, 0x0,
-    0x0, 0x1f, 0xf9, 0xff, 0xff, 0xff, 0xf9, 0xff,
-    0x80, 0x0, 0x7, 0xfe, 0x7f, 0xff, 0xff, 0xfe,
-    0x7f, 0xe0, 0x0, 0x1, 0xff, 0x9f, 0xff, 0xff,
-    0xff, 0x9f, 0xf8, 0x0, 0x0, 0x7f, 0xe7, 0xff,
-    0xff, 0xff, 0xe7, 0xfe, 0x0, 0x0, 0x1f, 0xf9,
-    0xff, 0xff, 0xff, 0xf9, 0xff, 0x80, 0x0, 0x7,
-    0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xe0, 0x0,
-    0x1, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x9f, 0xf8,
-    0x0, 0x0, 0x7f, 0xe7, 0xff, 0xff, 0xff, 0xe7,
-    0xfe, 0x0, 0x0, 0x1f, 0xf9, 0xff, 0xff, 0xff,
-    0xf9, 0xff, 0x80, 0x0, 0x7, 0xfe, 0x7f, 0xff,
-    0xff, 0xfe, 0x7f, 0xe0, 0x0, 0x1, 0xff, 0x9f,
-    0xff, 0xff, 0xff, 0x9f, 0xf8, 0x0, 0x0, 0x7f,
-    0xe7, 0xff, 0xff, 0xff, 0xe7, 0xfe, 0x0, 0x0,
-    0x1f, 0xf9, 0xff, 0xff, 0xff, 0xf9, 0xff, 0x80,
-    0x0, 0x7, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x3f,
-    0xe0, 0x0, 0x1, 0xff, 0x1f, 0xff, 0xff, 0xff,
-    0x87, 0xf8, 0x0, 0x0, 0x7f, 0x87, 0xff, 0xff,
-    0xff, 0xe1, 0xfe, 0x0, 0x0, 0x1f, 0xe1, 0xff,
-    0xff, 0xff, 0xf8, 0x3f, 0x80, 0x0, 0x7, 0xf0,
-    0x7f, 0xff, 0xff, 0xfe, 0xf, 0xe0, 0x0, 0x1,
-    0xfc, 0x1f, 0xff, 0xff, 0xff, 0x81, 0xf8, 0x0,
-    0x0, 0x7e, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x7e,
-    0x0, 0x0, 0x1f, 0x81, 0xff, 0xff, 0xff, 0xf8,
-    0xf, 0x80, 0x0, 0x7, 0xc0, 0x7f, 0xff, 0xff,
-    0xfe, 0x1, 0xe0, 0x0, 0x1, 0xe0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xe0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x38, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x1f,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x7, 0xc0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x3, 0xf8, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x3f, 0xf8, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xf, 0xfe,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x7,
-    0xff, 0xc0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x1, 0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0xff, 0xfe, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0xff,
-    0xfe, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x3f, 0xff, 0x80, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0xff, 0xfe, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0xff, 0xfe, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x3f, 0xff, 0x80, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0xff, 0xfe,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x3f,
-    0xff, 0x80, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0xff, 0xfe, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0xff, 0xfe, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x3f, 0xff, 0x80, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf7, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf8, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x0,
-
-    /* U+004E "N" */
-    0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xc7, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf9,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x78, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x9f, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe7, 0xc0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf9, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x9f,
-    0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe7, 0xf8, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf9, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x7f, 0xc0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x9f, 0xf8, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe7, 0xfe, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf9, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x7f, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x9f, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe7, 0xfe, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf9, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xe0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x9f, 0xf8,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe7,
-    0xfe, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf9, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x9f, 0xf8, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe7, 0xfe, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf9, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x3f,
-    0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x87, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe1, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x3f, 0x80, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0xf, 0xe0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x81, 0xf8, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x7e,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0xf, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x1, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xf0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7c,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x1f, 0x81, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x7, 0xe0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x1, 0xfc, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x7f, 0x87, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xe1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xfc,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x7f, 0xe7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x1f, 0xf9, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x7, 0xfe, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x1, 0xff, 0x9f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xe7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f,
-    0xf9, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x7f, 0xe7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x1f, 0xf9, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x9f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x7f, 0xe7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x1f, 0xf9, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x3, 0xfe, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x9f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x1f, 0xe7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xf9,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x9f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x7, 0xe7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xf9, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7, 0x9f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf7, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf8, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x0,
-
-    /* U+004F "O" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x60, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3c, 0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x1f, 0xbf, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
-    0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1f, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe3, 0xfd, 0xf8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7e, 0x3c, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x8f, 0x6, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x80, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-
-    /* U+0050 "P" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x60, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3c, 0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x1f, 0xbf, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xc0, 0xf,
-    0xff, 0xf1, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xf0,
-    0x3, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x8f, 0xff,
-    0xfe, 0x1, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x1f,
-    0xff, 0xf1, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff,
-    0xe3, 0xfc, 0x0, 0xff, 0xff, 0xff, 0x87, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xf, 0xff, 0xff,
-    0xf8, 0x7f, 0xff, 0xff, 0xc0, 0xf, 0xf1, 0xff,
-    0xff, 0xfc, 0xf, 0xff, 0xff, 0xe0, 0x3, 0xfe,
-    0x3f, 0xff, 0xff, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0xff, 0xc7, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8,
-    0x0, 0x3f, 0xf8, 0xff, 0xff, 0xe0, 0x1f, 0xff,
-    0xfc, 0x0, 0xf, 0xff, 0x1f, 0xff, 0xf0, 0x3,
-    0xff, 0xfe, 0x0, 0x3, 0xff, 0xe3, 0xff, 0xfc,
-    0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x60, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3c, 0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x1f, 0xbf, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xc0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1,
-    0xf8, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x7f, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x1f, 0xc1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x7, 0xf8, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xc7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f,
-    0xf1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x7f, 0xe7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x1f, 0xf9, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x9f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x7f, 0xe7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x1f, 0xf9, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x7, 0xfe, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x9f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xe7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xf9,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7,
-    0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x3f, 0xe7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x7, 0xf9, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x9f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xe7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x1, 0xf9, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x9f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x1, 0xe7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x79, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
-    0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1f, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe3, 0xfd, 0xf8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7e, 0x3c, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x8f, 0x6, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x80, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-
-    /* U+0052 "R" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x60, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3c, 0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x1f, 0xbf, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xc0, 0x7,
-    0xff, 0xf1, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xf0,
-    0x3, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x8f, 0xff,
-    0xfe, 0x1, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x1f,
-    0xff, 0xf1, 0xff, 0xff, 0xfe, 0xf, 0xff, 0xff,
-    0xe3, 0xfc, 0x0, 0xff, 0xff, 0xff, 0x87, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf1,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xf, 0xff, 0xff,
-    0xf8, 0x7f, 0xff, 0xff, 0xc0, 0xf, 0xf1, 0xff,
-    0xff, 0xfe, 0xf, 0xff, 0xff, 0xe0, 0x3, 0xfe,
-    0x3f, 0xff, 0xff, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0xff, 0xc7, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8,
-    0x0, 0x3f, 0xf8, 0xff, 0xff, 0xe0, 0x1f, 0xff,
-    0xfc, 0x0, 0xf, 0xff, 0x1f, 0xff, 0xf0, 0x3,
-    0xff, 0xfe, 0x0, 0x3, 0xff, 0xe3, 0xff, 0xfc,
-    0x0, 0x7f, 0xff, 0x0, 0x0, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xc0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1,
-    0xf8, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x7e, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x1f, 0xc0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xc0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f,
-    0xf0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x80, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x1f, 0xf8, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x7f, 0xe0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x1f, 0xf8, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x80, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xf8,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7,
-    0xfe, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x80, 0x0, 0x3f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x3f, 0xe0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x80,
-    0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xe0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x1, 0xf8, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x3, 0xe0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x78, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0053 "S" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x3f, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0xf, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x3f, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0xf, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x9e,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe7, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf9, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x7e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x9f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xe7, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf9, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x7f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x9f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xe7, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf9, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xfe, 0x7f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x9f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe7,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf9, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x9f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xe7, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf9, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x7f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x9f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf9, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x7f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x9f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe3, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x83, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x1f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x7, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfe, 0x3f, 0xff, 0x80, 0x7,
-    0xff, 0xf0, 0x0, 0xf, 0xff, 0x1f, 0xff, 0xf0,
-    0x3, 0xff, 0xfe, 0x0, 0x3, 0xff, 0x8f, 0xff,
-    0xfe, 0x1, 0xff, 0xff, 0xc0, 0x0, 0xff, 0xc7,
-    0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8, 0x0, 0x3f,
-    0xe3, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x0,
-    0xf, 0xf1, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x87, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xf, 0xff, 0xff,
-    0xf8, 0x7f, 0xff, 0xff, 0xc0, 0x0, 0x1, 0xff,
-    0xff, 0xfc, 0xf, 0xff, 0xff, 0xe3, 0xfc, 0x0,
-    0x3f, 0xff, 0xff, 0x3, 0xff, 0xff, 0xf1, 0xff,
-    0x0, 0x7, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8,
-    0xff, 0xc0, 0x0, 0xff, 0xff, 0xe0, 0x1f, 0xff,
-    0xfc, 0x7f, 0xf0, 0x0, 0x1f, 0xff, 0xf0, 0x3,
-    0xff, 0xfe, 0x3f, 0xfc, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x7f, 0xff, 0x1f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xc0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf8, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7e, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xc1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xc7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x9f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xe7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf9, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x9f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xe7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf9, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfe, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x9f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf9,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfe, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x9f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xe7, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf9, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x7f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x9f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xe7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf9, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x9f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xe7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x79, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0xf0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3f, 0xfc, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1f, 0xf0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe3, 0xfc, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7e, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x8f, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x80, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-
-    /* U+0054 "T" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xc7, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xdf, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc7, 0xe3, 0xc7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xf0, 0x63, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-
-    /* U+0056 "V" */
-    0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xf7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xf3, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x7, 0xf9, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x3, 0xf8, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x1, 0xfc, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xfc, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x7e, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x3e, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1e,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x3, 0xe0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x1, 0xf0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x81, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0xfc, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0xfe,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0xff, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x7f, 0x80, 0x0,
-    0x0, 0x1, 0xff, 0xfc, 0x7f, 0xc0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x3f, 0xe0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x9f, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xcf, 0xfc, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe7,
-    0xfe, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf3, 0xff,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf9, 0xff, 0x80,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x7f, 0xe0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x3f, 0xf0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x9f, 0xf8, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xcf, 0xfc, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe7, 0xfe, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf3,
-    0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf9, 0xff,
-    0x80, 0x0, 0x0, 0x1, 0xff, 0xfc, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xff, 0xfe, 0x7f, 0xc0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x3f, 0xc0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x9f, 0xe0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xcf, 0xe0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe7, 0xe0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf3, 0xf0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf9,
-    0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0057 "W" */
-    0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xc7, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0xff, 0xfe, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0xff, 0xfe, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x3f, 0xff, 0x80, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0xff, 0xfe,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x3f,
-    0xff, 0x80, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0xff, 0xfe, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0xff, 0xfe, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x3f, 0xff, 0x80, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xff, 0xfe, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff,
-    0x80, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0xff, 0xfe, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x1, 0xff, 0xf0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x3f,
-    0xf8, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0xf, 0xfe, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x1, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0xf, 0xe0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xf8, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x7c,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xe, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x3, 0x80, 0x0, 0x0, 0x7f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0xf, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x1,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x3, 0xe0, 0x0, 0x1, 0xf0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0xf8, 0x0, 0x0, 0x7c,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x7e, 0x0, 0x0,
-    0x1f, 0x81, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0x80,
-    0x0, 0x7, 0xe0, 0x7f, 0xff, 0xff, 0xfe, 0xf,
-    0xe0, 0x0, 0x1, 0xfc, 0x1f, 0xff, 0xff, 0xff,
-    0x87, 0xf8, 0x0, 0x0, 0x7f, 0x87, 0xff, 0xff,
-    0xff, 0xe1, 0xfe, 0x0, 0x0, 0x1f, 0xe1, 0xff,
-    0xff, 0xff, 0xf8, 0xff, 0x80, 0x0, 0x7, 0xfc,
-    0x7f, 0xff, 0xff, 0xfe, 0x3f, 0xe0, 0x0, 0x1,
-    0xff, 0x1f, 0xff, 0xff, 0xff, 0x9f, 0xf8, 0x0,
-    0x0, 0x7f, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xfe,
-    0x0, 0x0, 0x1f, 0xf9, 0xff, 0xff, 0xff, 0xf9,
-    0xff, 0x80, 0x0, 0x7, 0xfe, 0x7f, 0xff, 0xff,
-    0xfe, 0x7f, 0xe0, 0x0, 0x1, 0xff, 0x9f, 0xff,
-    0xff, 0xff, 0x9f, 0xf8, 0x0, 0x0, 0x7f, 0xe7,
-    0xff, 0xff, 0xff, 0xe7, 0xfe, 0x0, 0x0, 0x1f,
-    0xf9, 0xff, 0xff, 0xff, 0xf9, 0xff, 0x80, 0x0,
-    0x7, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xe0,
-    0x0, 0x1, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x9f,
-    0xf8, 0x0, 0x0, 0x7f, 0xe7, 0xff, 0xff, 0xff,
-    0xe7, 0xfe, 0x0, 0x0, 0x1f, 0xf9, 0xff, 0xff,
-    0xff, 0xf9, 0xff, 0x80, 0x0, 0x7, 0xfe, 0x7f,
-    0xff, 0xff, 0xfe, 0x7f, 0xe0, 0x0, 0x1, 0xff,
-    0x9f, 0xff, 0xff, 0xff, 0x9f, 0xf8, 0x0, 0x0,
-    0x7f, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xfe, 0x0,
-    0x0, 0x1f, 0xf9, 0xff, 0xff, 0xff, 0xf9, 0xff,
-    0x0, 0x0, 0x3, 0xfe, 0x7f, 0xff, 0xff, 0xfe,
-    0x7f, 0xc0, 0x0, 0x0, 0xff, 0x9f, 0xff, 0xff,
-    0xff, 0x9f, 0xe0, 0x0, 0x0, 0x1f, 0xe7, 0xff,
-    0xff, 0xff, 0xe7, 0xf8, 0x0, 0x0, 0x3, 0xf9,
-    0xff, 0xff, 0xff, 0xf9, 0xfc, 0x0, 0x0, 0x0,
-    0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x7e, 0x0, 0x0,
-    0x0, 0x1f, 0x9f, 0xff, 0xff, 0xff, 0x9f, 0x80,
-    0x0, 0x0, 0x7, 0xe7, 0xff, 0xff, 0xff, 0xe7,
-    0xc0, 0x0, 0x0, 0x0, 0xf9, 0xff, 0xff, 0xff,
-    0xf9, 0xf0, 0x0, 0x0, 0x0, 0x3e, 0x7f, 0xff,
-    0xff, 0xfe, 0x78, 0x0, 0x0, 0x0, 0x7, 0x9f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf7, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf8, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x0,
-
-    /* U+0058 "X" */
-    0xf0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0x1f, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xfc,
-    0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0,
-    0x3f, 0xfe, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x80, 0x0, 0x1, 0xff, 0xff, 0x80, 0x0,
-    0x1, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xff,
-    0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x3,
-    0xff, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0,
-    0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff,
-    0xff, 0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0,
-    0x3, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xff,
-    0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x3,
-    0xff, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0,
-    0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff,
-    0x7f, 0xc0, 0x0, 0x3, 0xfe, 0x7f, 0xc0, 0x0,
-    0x3, 0xfe, 0x3f, 0xc0, 0x0, 0x3, 0xfc, 0x1f,
-    0xc0, 0x0, 0x3, 0xf8, 0x1f, 0xc0, 0x0, 0x3,
-    0xf8, 0xf, 0xc0, 0x0, 0x3, 0xf0, 0xf, 0xc0,
-    0x0, 0x3, 0xf0, 0x7, 0xc0, 0x0, 0x3, 0xe0,
-    0x7, 0xc0, 0x0, 0x3, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xc0, 0x0, 0x3,
-    0xe0, 0x7, 0xc0, 0x0, 0x3, 0xe0, 0xf, 0xc0,
-    0x0, 0x3, 0xf0, 0xf, 0xc0, 0x0, 0x3, 0xf0,
-    0x1f, 0xc0, 0x0, 0x3, 0xf8, 0x1f, 0xc0, 0x0,
-    0x3, 0xf8, 0x3f, 0xc0, 0x0, 0x3, 0xfc, 0x7f,
-    0xc0, 0x0, 0x3, 0xfe, 0x7f, 0xc0, 0x0, 0x3,
-    0xfe, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0,
-    0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff,
-    0xff, 0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0,
-    0x3, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xff,
-    0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x3,
-    0xff, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0,
-    0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff,
-    0xff, 0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0,
-    0x3, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xff,
-    0x80, 0x0, 0x1, 0xff, 0xff, 0x80, 0x0, 0x1,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x7f,
-    0xfc, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0,
-    0x0, 0x3f, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xf8,
-    0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0,
-    0xf,
-
-    /* U+0059 "Y" */
-    0xf0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0,
-    0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xf8,
-    0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0,
-    0x3f, 0xfe, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0,
-    0x1, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xff,
-    0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x3,
-    0xff, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0,
-    0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff,
-    0xff, 0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0,
-    0x3, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xff,
-    0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x3,
-    0xff, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0,
-    0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff,
-    0xff, 0xc0, 0x0, 0x3, 0xff, 0x7f, 0xc0, 0x0,
-    0x3, 0xfe, 0x3f, 0xc0, 0x0, 0x3, 0xfc, 0x3f,
-    0xc0, 0x0, 0x3, 0xfc, 0x1f, 0xc0, 0x0, 0x3,
-    0xf8, 0x1f, 0xc0, 0x0, 0x3, 0xf8, 0xf, 0xc0,
-    0x0, 0x3, 0xf0, 0xf, 0xc0, 0x0, 0x3, 0xf0,
-    0x7, 0xc0, 0x0, 0x3, 0xe0, 0x3, 0xc0, 0x0,
-    0x3, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x38, 0x0, 0x0, 0x0, 0x0, 0x7c,
-    0x0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x80, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0,
-    0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x7, 0xff,
-    0xc0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-
-    /* U+005A "Z" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-
-    /* U+005C "\\" */
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x3f,
-    0xc0, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0,
-    0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0, 0xf, 0xc0,
-    0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0x7, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0,
-    0x0, 0x3, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xf0,
-    0x0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x0,
-    0x3, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0,
-    0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x3,
-    0xfe, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x0, 0x0, 0x0, 0x1, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x0, 0x0, 0x0, 0x0, 0xf,
-
-    /* U+005E "^" */
-    0x18, 0x0, 0x0, 0x7, 0x80, 0x0, 0x1, 0xf8,
-    0x0, 0x0, 0x7f, 0x80, 0x0, 0xf, 0xf8, 0x0,
-    0x1, 0xff, 0x80, 0x0, 0x3f, 0xf8, 0x0, 0x7,
-    0xff, 0x80, 0x0, 0xff, 0xf8, 0x0, 0x1f, 0xff,
-    0x80, 0x3, 0xff, 0xf8, 0x0, 0x7f, 0xff, 0x3c,
-    0xf, 0xff, 0xe7, 0x81, 0xff, 0xfc, 0xf8, 0x3f,
-    0xff, 0x9f, 0x7, 0xff, 0xf3, 0xf0, 0xff, 0xfe,
-    0x7f, 0x1f, 0xff, 0xcf, 0xe3, 0xff, 0xf9, 0xfe,
-    0x7f, 0xff, 0x3f, 0xcf, 0xff, 0xe7, 0xfd, 0xff,
-    0xfc, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xcf, 0xff,
-    0xff, 0xf9, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff,
-    0xe7, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x9f,
-    0xff, 0xff, 0xf3, 0xff, 0xff, 0xfe, 0x7f, 0xff,
-    0xff, 0xcf, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0x87, 0xff, 0xff, 0xf0, 0x7f, 0xff,
-    0xfe, 0xf, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xf8,
-    0x1f, 0xff, 0xff, 0x1, 0xff, 0xff, 0xe0, 0x1f,
-    0xff, 0xfc, 0x0, 0x3f, 0xff, 0x0, 0x7, 0xff,
-    0xc0, 0x0, 0xff, 0xf0, 0x0, 0x1f, 0xfc, 0x0,
-    0x3, 0xfe, 0x0, 0x0, 0x7f, 0x80, 0x0, 0xf,
-    0xe0, 0x0, 0x0,
-
-    /* U+005F "_" */
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+0060 "`" */
-    0xf0, 0x3e, 0xf, 0x83, 0xf0, 0xfc, 0x3f, 0x8f,
-    0xe3, 0xfc, 0xff, 0xbf, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xdf,
-    0xf3, 0xfc, 0xff, 0x1f, 0xc3, 0xf0, 0xfc, 0x1f,
-    0x7, 0xc0,
-
-    /* U+0061 "a" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x60, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3c, 0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x1f, 0xbf, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xc0, 0xf,
-    0xff, 0xf1, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xf0,
-    0x3, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x8f, 0xff,
-    0xfe, 0x1, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x1f,
-    0xff, 0xf1, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff,
-    0xe3, 0xfc, 0x0, 0xff, 0xff, 0xff, 0x87, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xf, 0xff, 0xff,
-    0xf8, 0x7f, 0xff, 0xff, 0xc0, 0xf, 0xf1, 0xff,
-    0xff, 0xfc, 0xf, 0xff, 0xff, 0xe3, 0xff, 0xfe,
-    0x3f, 0xff, 0xff, 0x3, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xc7, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8,
-    0xff, 0xff, 0xf8, 0xff, 0xff, 0xe0, 0x1f, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0x1f, 0xff, 0xf0, 0x3,
-    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xe3, 0xff, 0xfc,
-    0x0, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x7c, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x8e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xc1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20,
-
-    /* U+0062 "b" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3c, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0xf0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xc0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xfe, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xf0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff,
-    0x80, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f,
-    0xfc, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x1,
-    0xff, 0xf0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0xf, 0xff, 0x80, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x3f, 0xf8, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x1f,
-    0xff, 0x80, 0x0, 0x0, 0x3, 0xe3, 0xff, 0xfc,
-    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x1f, 0x3f, 0xff,
-    0xf1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x71, 0xff,
-    0xff, 0xc7, 0xff, 0x0, 0x0, 0x0, 0x1, 0x1f,
-    0xff, 0xff, 0x1f, 0xf8, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xfc, 0x7f, 0xc0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf1, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x1f, 0xe0,
-    0x0, 0x0, 0x0, 0x23, 0xff, 0xff, 0xf1, 0xff,
-    0x0, 0x0, 0x0, 0x1, 0x1f, 0xff, 0xff, 0x1f,
-    0xf8, 0x0, 0x0, 0x0, 0x1c, 0x7f, 0xff, 0xf1,
-    0xff, 0xc0, 0x0, 0x0, 0x1, 0xf3, 0xff, 0xff,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0xf, 0x8f, 0xff,
-    0xf1, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x7, 0xf0,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f,
-    0xc0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x3,
-    0xfe, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x3f, 0xf8, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-    0x3, 0xff, 0xe0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x1f, 0xff, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xf8, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc7, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1f, 0xfe, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x7f, 0xf0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0x81, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc7, 0xfc, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x1f, 0xe1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x7e, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xe1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x63, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x7e, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xf8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xe3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf,
-    0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x7f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x3, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x3f, 0xfc, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x1, 0xff, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0xf, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x7f, 0xc7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3, 0xfc, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xf, 0xc7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3c, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xc7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8,
-
-    /* U+0064 "d" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3c, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0xf0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xc0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xfe, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xf0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff,
-    0x80, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f,
-    0xfc, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x3f,
-    0xfe, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x1,
-    0xff, 0xf0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x7, 0xff, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x1f, 0xf0, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x3, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0xf,
-    0xff, 0x80, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0xe, 0x0, 0x0,
-    0x0, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x20, 0x0,
-    0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x1, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0,
-    0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x3f, 0xe0,
-    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x3f,
-    0xf8, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x3,
-    0xff, 0xc0, 0x0, 0x0, 0x1, 0xf0, 0x0, 0x0,
-    0x3f, 0xfe, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0,
-    0x3, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0xf, 0xf8,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f,
-    0xc0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x7,
-    0xff, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x7f, 0xfc, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-    0x3, 0xff, 0xe0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x3f, 0xff, 0x80, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf8, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc7, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1f, 0xfe, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x7f, 0xf0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0x81, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc7, 0xfc, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x1f, 0xe1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x7e, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xe1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0,
-
-    /* U+0065 "e" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x63, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x7e, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xf8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xe3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf,
-    0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x7f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x3, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xfc, 0x7f, 0xff, 0x80, 0xf, 0xff,
-    0xe0, 0x3, 0xff, 0xc7, 0xff, 0xfc, 0x0, 0xff,
-    0xff, 0x80, 0x1f, 0xfc, 0x7f, 0xff, 0xf0, 0x7,
-    0xff, 0xfe, 0x0, 0xff, 0xc7, 0xff, 0xff, 0x80,
-    0x7f, 0xff, 0xf8, 0x7, 0xfc, 0x7f, 0xff, 0xfe,
-    0x7, 0xff, 0xff, 0xe0, 0x3f, 0xc7, 0xff, 0xff,
-    0xf8, 0x3f, 0xff, 0xff, 0x80, 0x0, 0x7f, 0xff,
-    0xff, 0xc3, 0xff, 0xff, 0xfe, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x1f,
-    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x83, 0xfc,
-    0x7f, 0xff, 0xff, 0x83, 0xff, 0xff, 0xf8, 0x1f,
-    0xf1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x80,
-    0xff, 0xc7, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8,
-    0x7, 0xff, 0x1f, 0xff, 0xfc, 0x1, 0xff, 0xff,
-    0x80, 0x3f, 0xfc, 0x7f, 0xff, 0xc0, 0xf, 0xff,
-    0xf8, 0x1, 0xff, 0xf1, 0xff, 0xfe, 0x0, 0x3f,
-    0xff, 0x80, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x3f, 0xfc, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x1, 0xff, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0xf, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x7f, 0xc7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3, 0xfc, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xf, 0xc7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3c, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xc7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8,
-
-    /* U+0066 "f" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x63, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x7e, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xf8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xe3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf,
-    0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x7f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x3, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xfc, 0x7f, 0xff, 0x80, 0xf, 0xff,
-    0xe0, 0x3, 0xff, 0xc7, 0xff, 0xfc, 0x0, 0xff,
-    0xff, 0x80, 0x1f, 0xfc, 0x7f, 0xff, 0xf0, 0x7,
-    0xff, 0xfe, 0x0, 0xff, 0xc7, 0xff, 0xff, 0x80,
-    0x7f, 0xff, 0xf8, 0x7, 0xfc, 0x7f, 0xff, 0xfe,
-    0x7, 0xff, 0xff, 0xe0, 0x3f, 0xc7, 0xff, 0xff,
-    0xf8, 0x3f, 0xff, 0xff, 0x80, 0x0, 0x7f, 0xff,
-    0xff, 0xc3, 0xff, 0xff, 0xfe, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x1f,
-    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x83, 0xfc,
-    0x7f, 0xff, 0xff, 0x83, 0xff, 0xff, 0xf8, 0x1f,
-    0xf1, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0x80,
-    0xff, 0xc7, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8,
-    0x7, 0xff, 0x1f, 0xff, 0xfc, 0x1, 0xff, 0xff,
-    0x80, 0x3f, 0xfc, 0x7f, 0xff, 0xc0, 0xf, 0xff,
-    0xf8, 0x1, 0xff, 0xf1, 0xff, 0xfe, 0x0, 0x3f,
-    0xff, 0x80, 0xf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x3f, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0xf, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x3f, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0xf, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xfe, 0x0, 0x3, 0xff, 0x80, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xc0, 0x0, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0, 0x3f,
-    0xe0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0xf, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xc0, 0xf, 0xf0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xe3, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
-    0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1f, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe3, 0xfd, 0xf8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7e, 0x3c, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x8f, 0x6, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x80, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-
-    /* U+0068 "h" */
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xc7, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfb, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xfc, 0x0,
-    0xff, 0xff, 0x1f, 0xff, 0xff, 0xf1, 0xff, 0xff,
-    0x0, 0x3f, 0xff, 0xe3, 0xff, 0xff, 0xf8, 0xff,
-    0xff, 0xe0, 0x1f, 0xff, 0xfc, 0x7f, 0xff, 0xfc,
-    0x7f, 0xff, 0xf8, 0x7, 0xff, 0xff, 0x8f, 0xff,
-    0xfe, 0x3f, 0xff, 0xff, 0x3, 0xff, 0xff, 0xf1,
-    0xff, 0xff, 0x1f, 0xff, 0xff, 0xc0, 0xff, 0xff,
-    0xfe, 0x3f, 0xc0, 0xf, 0xff, 0xff, 0xf8, 0x7f,
-    0xff, 0xff, 0xc0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x87, 0xff, 0xff, 0xfc, 0x0, 0xff, 0x1f,
-    0xff, 0xff, 0xc0, 0xff, 0xff, 0xfe, 0x3f, 0xff,
-    0xe3, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x1f,
-    0xff, 0xfc, 0x7f, 0xff, 0xf8, 0x7, 0xff, 0xff,
-    0x8f, 0xff, 0xff, 0x8f, 0xff, 0xfe, 0x1, 0xff,
-    0xff, 0xc7, 0xff, 0xff, 0xf1, 0xff, 0xff, 0x0,
-    0x3f, 0xff, 0xe3, 0xff, 0xff, 0xfe, 0x3f, 0xff,
-    0xc0, 0xf, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf7, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf8, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x0,
-
-    /* U+0069 "i" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xdf, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc7, 0xe3, 0xc7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xf0, 0x63, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-
-    /* U+006B "k" */
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xf7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xfb, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x7, 0xf9, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x3, 0xf8, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x1, 0xfc, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xfc, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x7e, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x3e, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xf1, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xf1,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x7f, 0xf1, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x3f, 0xf1, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x1f, 0xf1, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0xf, 0xf1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xff,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x7f, 0xc7,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x3f, 0xf1, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x1f, 0xfc, 0x7f, 0xff,
-    0xf0, 0x0, 0x0, 0xf, 0xff, 0x1f, 0xff, 0xf0,
-    0x0, 0x0, 0x7, 0xff, 0xc7, 0xff, 0xf8, 0x0,
-    0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xf0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x7e, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x3f, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x1f, 0xc7, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0xf, 0xe3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x7, 0xf9, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x3,
-    0xfe, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+006C "l" */
-    0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xf, 0xff,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x7f,
-    0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3,
-    0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x1f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0xf, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x31, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-
-    /* U+006D "m" */
-    0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xc7, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf9,
-    0xe0, 0x0, 0x0, 0x0, 0x1e, 0x7f, 0xff, 0xff,
-    0xfe, 0x78, 0x0, 0x0, 0x0, 0x7, 0x9f, 0xff,
-    0xff, 0xff, 0x9f, 0x0, 0x0, 0x0, 0x3, 0xe7,
-    0xff, 0xff, 0xff, 0xe7, 0xc0, 0x0, 0x0, 0x0,
-    0xf9, 0xff, 0xff, 0xff, 0xf9, 0xf8, 0x0, 0x0,
-    0x0, 0x7e, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0x0,
-    0x0, 0x0, 0x3f, 0x9f, 0xff, 0xff, 0xff, 0x9f,
-    0xc0, 0x0, 0x0, 0xf, 0xe7, 0xff, 0xff, 0xff,
-    0xe7, 0xf8, 0x0, 0x0, 0x7, 0xf9, 0xff, 0xff,
-    0xff, 0xf9, 0xfe, 0x0, 0x0, 0x1, 0xfe, 0x7f,
-    0xff, 0xff, 0xfe, 0x7f, 0xc0, 0x0, 0x0, 0xff,
-    0x9f, 0xff, 0xff, 0xff, 0x9f, 0xf8, 0x0, 0x0,
-    0x7f, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xfe, 0x0,
-    0x0, 0x1f, 0xf9, 0xff, 0xff, 0xff, 0xf9, 0xff,
-    0x80, 0x0, 0x7, 0xfe, 0x7f, 0xff, 0xff, 0xfe,
-    0x7f, 0xe0, 0x0, 0x1, 0xff, 0x9f, 0xff, 0xff,
-    0xff, 0x9f, 0xf8, 0x0, 0x0, 0x7f, 0xe7, 0xff,
-    0xff, 0xff, 0xe7, 0xfe, 0x0, 0x0, 0x1f, 0xf9,
-    0xff, 0xff, 0xff, 0xf9, 0xff, 0x80, 0x0, 0x7,
-    0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xe0, 0x0,
-    0x1, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x9f, 0xf8,
-    0x0, 0x0, 0x7f, 0xe7, 0xff, 0xff, 0xff, 0xe7,
-    0xfe, 0x0, 0x0, 0x1f, 0xf9, 0xff, 0xff, 0xff,
-    0xf9, 0xff, 0x80, 0x0, 0x7, 0xfe, 0x7f, 0xff,
-    0xff, 0xfe, 0x7f, 0xe0, 0x0, 0x1, 0xff, 0x9f,
-    0xff, 0xff, 0xff, 0x9f, 0xf8, 0x0, 0x0, 0x7f,
-    0xe7, 0xff, 0xff, 0xff, 0xe7, 0xfe, 0x0, 0x0,
-    0x1f, 0xf9, 0xff, 0xff, 0xff, 0xf9, 0xff, 0x80,
-    0x0, 0x7, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x3f,
-    0xe0, 0x0, 0x1, 0xff, 0x1f, 0xff, 0xff, 0xff,
-    0x87, 0xf8, 0x0, 0x0, 0x7f, 0x87, 0xff, 0xff,
-    0xff, 0xe1, 0xfe, 0x0, 0x0, 0x1f, 0xe1, 0xff,
-    0xff, 0xff, 0xf8, 0x3f, 0x80, 0x0, 0x7, 0xf0,
-    0x7f, 0xff, 0xff, 0xfe, 0xf, 0xe0, 0x0, 0x1,
-    0xfc, 0x1f, 0xff, 0xff, 0xff, 0x81, 0xf8, 0x0,
-    0x0, 0x7e, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x7e,
-    0x0, 0x0, 0x1f, 0x81, 0xff, 0xff, 0xff, 0xf8,
-    0xf, 0x80, 0x0, 0x7, 0xc0, 0x7f, 0xff, 0xff,
-    0xfe, 0x1, 0xe0, 0x0, 0x1, 0xe0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xe0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x38, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x1f,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x7, 0xc0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x3, 0xf8, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x3f, 0xf8, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xf, 0xfe,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x7,
-    0xff, 0xc0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x1, 0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0xff, 0xfe, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0xff,
-    0xfe, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x3f, 0xff, 0x80, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0xff, 0xfe, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0xff, 0xfe, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x3f, 0xff, 0x80, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0xff, 0xfe,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x3f,
-    0xff, 0x80, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0xff, 0xfe, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0xff, 0xfe, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x3f, 0xff, 0x80, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf7, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf8, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x0,
-
-    /* U+006E "n" */
-    0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xc7, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf9,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x78, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x9f, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe7, 0xc0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf9, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x9f,
-    0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe7, 0xf8, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf9, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x7f, 0xc0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x9f, 0xf8, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe7, 0xfe, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf9, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x7f, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x9f, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe7, 0xfe, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf9, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xe0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x9f, 0xf8,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe7,
-    0xfe, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf9, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x9f, 0xf8, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe7, 0xfe, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf9, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x3f,
-    0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x87, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe1, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x3f, 0x80, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0xf, 0xe0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x81, 0xf8, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x7e,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0xf, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x1, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xf0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7c,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x1f, 0x81, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x7, 0xe0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x1, 0xfc, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x7f, 0x87, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xe1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xfc,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x7f, 0xe7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x1f, 0xf9, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x7, 0xfe, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x1, 0xff, 0x9f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xe7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f,
-    0xf9, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x7f, 0xe7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x1f, 0xf9, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x9f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x7f, 0xe7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x1f, 0xf9, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x3, 0xfe, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x9f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x1f, 0xe7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xf9,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x9f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x7, 0xe7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xf9, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7, 0x9f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf7, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf8, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x0,
-
-    /* U+006F "o" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x60, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3c, 0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x1f, 0xbf, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
-    0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1f, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe3, 0xfd, 0xf8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7e, 0x3c, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x8f, 0x6, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x80, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-
-    /* U+0070 "p" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x60, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3c, 0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x1f, 0xbf, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xc0, 0xf,
-    0xff, 0xf1, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xf0,
-    0x3, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x8f, 0xff,
-    0xfe, 0x1, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x1f,
-    0xff, 0xf1, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff,
-    0xe3, 0xfc, 0x0, 0xff, 0xff, 0xff, 0x87, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xf, 0xff, 0xff,
-    0xf8, 0x7f, 0xff, 0xff, 0xc0, 0xf, 0xf1, 0xff,
-    0xff, 0xfc, 0xf, 0xff, 0xff, 0xe0, 0x3, 0xfe,
-    0x3f, 0xff, 0xff, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0xff, 0xc7, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8,
-    0x0, 0x3f, 0xf8, 0xff, 0xff, 0xe0, 0x1f, 0xff,
-    0xfc, 0x0, 0xf, 0xff, 0x1f, 0xff, 0xf0, 0x3,
-    0xff, 0xfe, 0x0, 0x3, 0xff, 0xe3, 0xff, 0xfc,
-    0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x60, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3c, 0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x1f, 0xbf, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xc0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1,
-    0xf8, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x7f, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x1f, 0xc1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x7, 0xf8, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xc7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f,
-    0xf1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x7f, 0xe7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x1f, 0xf9, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x9f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x7f, 0xe7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x1f, 0xf9, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x7, 0xfe, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x9f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xe7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xf9,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7,
-    0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x3f, 0xe7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x7, 0xf9, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x9f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xe7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x1, 0xf9, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x9f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x1, 0xe7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x79, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
-    0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1f, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe3, 0xfd, 0xf8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7e, 0x3c, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x8f, 0x6, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x80, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-
-    /* U+0072 "r" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x60, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3c, 0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x1f, 0xbf, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xc0, 0x7,
-    0xff, 0xf1, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xf0,
-    0x3, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x8f, 0xff,
-    0xfe, 0x1, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x1f,
-    0xff, 0xf1, 0xff, 0xff, 0xfe, 0xf, 0xff, 0xff,
-    0xe3, 0xfc, 0x0, 0xff, 0xff, 0xff, 0x87, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf1,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xf, 0xff, 0xff,
-    0xf8, 0x7f, 0xff, 0xff, 0xc0, 0xf, 0xf1, 0xff,
-    0xff, 0xfe, 0xf, 0xff, 0xff, 0xe0, 0x3, 0xfe,
-    0x3f, 0xff, 0xff, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0xff, 0xc7, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8,
-    0x0, 0x3f, 0xf8, 0xff, 0xff, 0xe0, 0x1f, 0xff,
-    0xfc, 0x0, 0xf, 0xff, 0x1f, 0xff, 0xf0, 0x3,
-    0xff, 0xfe, 0x0, 0x3, 0xff, 0xe3, 0xff, 0xfc,
-    0x0, 0x7f, 0xff, 0x0, 0x0, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xc0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1,
-    0xf8, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x7e, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x1f, 0xc0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xc0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f,
-    0xf0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x80, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x1f, 0xf8, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x7f, 0xe0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x1f, 0xf8, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x80, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xf8,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x7,
-    0xfe, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x80, 0x0, 0x3f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x3f, 0xe0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x80,
-    0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xe0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x1, 0xf8, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x3, 0xe0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x78, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x3f, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0xf, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x3f, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0xf, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x9e,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe7, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf9, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x7e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x9f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xe7, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf9, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x7f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x9f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xe7, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf9, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xfe, 0x7f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x9f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe7,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf9, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x9f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xe7, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf9, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x7f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x9f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf9, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x7f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x9f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe3, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x83, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x1f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x7, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfe, 0x3f, 0xff, 0x80, 0x7,
-    0xff, 0xf0, 0x0, 0xf, 0xff, 0x1f, 0xff, 0xf0,
-    0x3, 0xff, 0xfe, 0x0, 0x3, 0xff, 0x8f, 0xff,
-    0xfe, 0x1, 0xff, 0xff, 0xc0, 0x0, 0xff, 0xc7,
-    0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8, 0x0, 0x3f,
-    0xe3, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x0,
-    0xf, 0xf1, 0xff, 0xff, 0xfc, 0xf, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x87, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xf, 0xff, 0xff,
-    0xf8, 0x7f, 0xff, 0xff, 0xc0, 0x0, 0x1, 0xff,
-    0xff, 0xfc, 0xf, 0xff, 0xff, 0xe3, 0xfc, 0x0,
-    0x3f, 0xff, 0xff, 0x3, 0xff, 0xff, 0xf1, 0xff,
-    0x0, 0x7, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8,
-    0xff, 0xc0, 0x0, 0xff, 0xff, 0xe0, 0x1f, 0xff,
-    0xfc, 0x7f, 0xf0, 0x0, 0x1f, 0xff, 0xf0, 0x3,
-    0xff, 0xfe, 0x3f, 0xfc, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x7f, 0xff, 0x1f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xc0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf8, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7e, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xc1, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xc7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x9f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xe7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf9, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x9f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xe7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf9, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfe, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x9f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf9,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfe, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x9f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xe7, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf9, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x7f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x9f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xe7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf9, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0x9f, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xe7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x79, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xc0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0xf0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3f, 0xfc, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1f, 0xf0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe3, 0xfc, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7e, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x8f, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x80, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-
-    /* U+0074 "t" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x80, 0x0, 0x0, 0x0,
-
-    /* U+0075 "u" */
-    0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xc7, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xdf, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc7, 0xe3, 0xc7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xf0, 0x63, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-
-    /* U+0076 "v" */
-    0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xf7,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xf3, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x7, 0xf9, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x3, 0xf8, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x1, 0xfc, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xfc, 0x3f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x7e, 0x1f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x3e, 0xf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x1e,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfe, 0x3, 0xe0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x1, 0xf0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x81, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0xfc, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0xfe,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0xff, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf8, 0x7f, 0x80, 0x0,
-    0x0, 0x1, 0xff, 0xfc, 0x7f, 0xc0, 0x0, 0x0,
-    0x0, 0xff, 0xfe, 0x3f, 0xe0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x9f, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xcf, 0xfc, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe7,
-    0xfe, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf3, 0xff,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf9, 0xff, 0x80,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x7f, 0xe0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x3f, 0xf0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x9f, 0xf8, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xcf, 0xfc, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xe7, 0xfe, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf3,
-    0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf9, 0xff,
-    0x80, 0x0, 0x0, 0x1, 0xff, 0xfc, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xff, 0xfe, 0x7f, 0xc0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x3f, 0xc0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x9f, 0xe0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xcf, 0xe0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xe7, 0xe0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf3, 0xf0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf9,
-    0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfc, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0077 "w" */
-    0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xc7, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0xff, 0xfe, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80,
-    0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x3,
-    0xff, 0xf8, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0xff, 0xfe, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x3f, 0xff, 0x80, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xf8, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0xff, 0xfe,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x3f,
-    0xff, 0x80, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0xff, 0xfe, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x3, 0xff,
-    0xf8, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0xff, 0xfe, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x3f, 0xff, 0x80, 0x1, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xff, 0xfe, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x3f, 0xff,
-    0x80, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0,
-    0x3, 0xff, 0xf8, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0xff, 0xfe, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x3f, 0xff, 0x80, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x0, 0x1, 0xff, 0xf0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x3f,
-    0xf8, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0xf, 0xfe, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x1, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0xf, 0xe0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xf8, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x7c,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xe, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x3, 0x80, 0x0, 0x0, 0x7f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0xf, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x1,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfe, 0x3, 0xe0, 0x0, 0x1, 0xf0, 0x1f,
-    0xff, 0xff, 0xff, 0x80, 0xf8, 0x0, 0x0, 0x7c,
-    0x7, 0xff, 0xff, 0xff, 0xe0, 0x7e, 0x0, 0x0,
-    0x1f, 0x81, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0x80,
-    0x0, 0x7, 0xe0, 0x7f, 0xff, 0xff, 0xfe, 0xf,
-    0xe0, 0x0, 0x1, 0xfc, 0x1f, 0xff, 0xff, 0xff,
-    0x87, 0xf8, 0x0, 0x0, 0x7f, 0x87, 0xff, 0xff,
-    0xff, 0xe1, 0xfe, 0x0, 0x0, 0x1f, 0xe1, 0xff,
-    0xff, 0xff, 0xf8, 0xff, 0x80, 0x0, 0x7, 0xfc,
-    0x7f, 0xff, 0xff, 0xfe, 0x3f, 0xe0, 0x0, 0x1,
-    0xff, 0x1f, 0xff, 0xff, 0xff, 0x9f, 0xf8, 0x0,
-    0x0, 0x7f, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xfe,
-    0x0, 0x0, 0x1f, 0xf9, 0xff, 0xff, 0xff, 0xf9,
-    0xff, 0x80, 0x0, 0x7, 0xfe, 0x7f, 0xff, 0xff,
-    0xfe, 0x7f, 0xe0, 0x0, 0x1, 0xff, 0x9f, 0xff,
-    0xff, 0xff, 0x9f, 0xf8, 0x0, 0x0, 0x7f, 0xe7,
-    0xff, 0xff, 0xff, 0xe7, 0xfe, 0x0, 0x0, 0x1f,
-    0xf9, 0xff, 0xff, 0xff, 0xf9, 0xff, 0x80, 0x0,
-    0x7, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xe0,
-    0x0, 0x1, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x9f,
-    0xf8, 0x0, 0x0, 0x7f, 0xe7, 0xff, 0xff, 0xff,
-    0xe7, 0xfe, 0x0, 0x0, 0x1f, 0xf9, 0xff, 0xff,
-    0xff, 0xf9, 0xff, 0x80, 0x0, 0x7, 0xfe, 0x7f,
-    0xff, 0xff, 0xfe, 0x7f, 0xe0, 0x0, 0x1, 0xff,
-    0x9f, 0xff, 0xff, 0xff, 0x9f, 0xf8, 0x0, 0x0,
-    0x7f, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xfe, 0x0,
-    0x0, 0x1f, 0xf9, 0xff, 0xff, 0xff, 0xf9, 0xff,
-    0x0, 0x0, 0x3, 0xfe, 0x7f, 0xff, 0xff, 0xfe,
-    0x7f, 0xc0, 0x0, 0x0, 0xff, 0x9f, 0xff, 0xff,
-    0xff, 0x9f, 0xe0, 0x0, 0x0, 0x1f, 0xe7, 0xff,
-    0xff, 0xff, 0xe7, 0xf8, 0x0, 0x0, 0x3, 0xf9,
-    0xff, 0xff, 0xff, 0xf9, 0xfc, 0x0, 0x0, 0x0,
-    0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x7e, 0x0, 0x0,
-    0x0, 0x1f, 0x9f, 0xff, 0xff, 0xff, 0x9f, 0x80,
-    0x0, 0x0, 0x7, 0xe7, 0xff, 0xff, 0xff, 0xe7,
-    0xc0, 0x0, 0x0, 0x0, 0xf9, 0xff, 0xff, 0xff,
-    0xf9, 0xf0, 0x0, 0x0, 0x0, 0x3e, 0x7f, 0xff,
-    0xff, 0xfe, 0x78, 0x0, 0x0, 0x0, 0x7, 0x9f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf7, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf8, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x0,
-
-    /* U+0078 "x" */
-    0xf0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0,
-    0x0, 0x1f, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xfc,
-    0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0,
-    0x3f, 0xfe, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x80, 0x0, 0x1, 0xff, 0xff, 0x80, 0x0,
-    0x1, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xff,
-    0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x3,
-    0xff, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0,
-    0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff,
-    0xff, 0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0,
-    0x3, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xff,
-    0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x3,
-    0xff, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0,
-    0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff,
-    0x7f, 0xc0, 0x0, 0x3, 0xfe, 0x7f, 0xc0, 0x0,
-    0x3, 0xfe, 0x3f, 0xc0, 0x0, 0x3, 0xfc, 0x1f,
-    0xc0, 0x0, 0x3, 0xf8, 0x1f, 0xc0, 0x0, 0x3,
-    0xf8, 0xf, 0xc0, 0x0, 0x3, 0xf0, 0xf, 0xc0,
-    0x0, 0x3, 0xf0, 0x7, 0xc0, 0x0, 0x3, 0xe0,
-    0x7, 0xc0, 0x0, 0x3, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xc0, 0x0, 0x3,
-    0xe0, 0x7, 0xc0, 0x0, 0x3, 0xe0, 0xf, 0xc0,
-    0x0, 0x3, 0xf0, 0xf, 0xc0, 0x0, 0x3, 0xf0,
-    0x1f, 0xc0, 0x0, 0x3, 0xf8, 0x1f, 0xc0, 0x0,
-    0x3, 0xf8, 0x3f, 0xc0, 0x0, 0x3, 0xfc, 0x7f,
-    0xc0, 0x0, 0x3, 0xfe, 0x7f, 0xc0, 0x0, 0x3,
-    0xfe, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0,
-    0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff,
-    0xff, 0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0,
-    0x3, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xff,
-    0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x3,
-    0xff, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0,
-    0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff,
-    0xff, 0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0,
-    0x3, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xff,
-    0x80, 0x0, 0x1, 0xff, 0xff, 0x80, 0x0, 0x1,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x7f,
-    0xfc, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0,
-    0x0, 0x3f, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xf8,
-    0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0x0,
-    0xf,
-
-    /* U+0079 "y" */
-    0xf0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0,
-    0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xf8,
-    0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0,
-    0x3f, 0xfe, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0,
-    0x1, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xff,
-    0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x3,
-    0xff, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0,
-    0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff,
-    0xff, 0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0,
-    0x3, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xff,
-    0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x3,
-    0xff, 0xff, 0xc0, 0x0, 0x3, 0xff, 0xff, 0xc0,
-    0x0, 0x3, 0xff, 0xff, 0xc0, 0x0, 0x3, 0xff,
-    0xff, 0xc0, 0x0, 0x3, 0xff, 0x7f, 0xc0, 0x0,
-    0x3, 0xfe, 0x3f, 0xc0, 0x0, 0x3, 0xfc, 0x3f,
-    0xc0, 0x0, 0x3, 0xfc, 0x1f, 0xc0, 0x0, 0x3,
-    0xf8, 0x1f, 0xc0, 0x0, 0x3, 0xf8, 0xf, 0xc0,
-    0x0, 0x3, 0xf0, 0xf, 0xc0, 0x0, 0x3, 0xf0,
-    0x7, 0xc0, 0x0, 0x3, 0xe0, 0x3, 0xc0, 0x0,
-    0x3, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x38, 0x0, 0x0, 0x0, 0x0, 0x7c,
-    0x0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x80, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0,
-    0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x7, 0xff,
-    0xc0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0xf,
-    0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-    0x0, 0xf, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xff,
-    0xe0, 0x0, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-    0xf, 0xff, 0xe0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0x0, 0x0, 0xf, 0xff, 0xe0, 0x0,
-
-    /* U+007A "z" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-
-    /* U+007C "|" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xcf, 0xff,
-    0x8f, 0xfe, 0xf, 0xf8, 0x1f, 0xf0, 0x1f, 0xc0,
-    0x3f, 0x80, 0x3e, 0x0, 0x7c, 0x0, 0x70, 0x0,
-    0x40, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x40,
-    0x1, 0xc0, 0x7, 0xc0, 0xf, 0x80, 0x3f, 0x80,
-    0x7f, 0x1, 0xff, 0x3, 0xfe, 0xf, 0xfe, 0x3f,
-    0xfe, 0x7f, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-
-    /* U+007E "~" */
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x60, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3c, 0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x1f, 0xbf, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x9e,
-    0x0, 0xff, 0xfe, 0x1, 0xe7, 0xff, 0xff, 0xff,
-    0xe7, 0x80, 0x3f, 0xff, 0x80, 0x79, 0xff, 0xff,
-    0xff, 0xf9, 0xf0, 0xf, 0xff, 0xe0, 0x3e, 0x7f,
-    0xff, 0xff, 0xfe, 0x7e, 0x3, 0xff, 0xf8, 0x1f,
-    0x9f, 0xff, 0xff, 0xff, 0x9f, 0x80, 0xff, 0xfe,
-    0x7, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xf0, 0x3f,
-    0xff, 0x83, 0xf9, 0xff, 0xff, 0xff, 0xf9, 0xfc,
-    0xf, 0xff, 0xe0, 0xfe, 0x7f, 0xff, 0xff, 0xfe,
-    0x7f, 0x83, 0xff, 0xf8, 0x7f, 0x9f, 0xff, 0xff,
-    0xff, 0x9f, 0xe0, 0xff, 0xfe, 0x1f, 0xe7, 0xff,
-    0xff, 0xff, 0xe7, 0xfc, 0x3f, 0xff, 0x8f, 0xf9,
-    0xff, 0xff, 0xff, 0xf9, 0xff, 0x8f, 0xff, 0xe7,
-    0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xe3, 0xff,
-    0xf9, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x9f, 0xf8,
-    0xff, 0xfe, 0x7f, 0xe7, 0xff, 0xff, 0xff, 0xe7,
-    0xfe, 0x3f, 0xff, 0x9f, 0xf9, 0xff, 0xff, 0xff,
-    0xf9, 0xff, 0x8f, 0xff, 0xe7, 0xfe, 0x7f, 0xff,
-    0xff, 0xfe, 0x7f, 0xe3, 0xff, 0xf9, 0xff, 0x9f,
-    0xff, 0xff, 0xff, 0x9f, 0xf8, 0xff, 0xfe, 0x7f,
-    0xe7, 0xff, 0xff, 0xff, 0xe7, 0xfe, 0x3f, 0xff,
-    0x9f, 0xf9, 0xff, 0xff, 0xff, 0xf9, 0xff, 0x8f,
-    0xff, 0xe7, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x7f,
-    0xe3, 0xff, 0xf9, 0xff, 0x9f, 0xff, 0xff, 0xff,
-    0x9f, 0xf8, 0xff, 0xfe, 0x7f, 0xe7, 0xff, 0xff,
-    0xff, 0xe7, 0xfe, 0x3f, 0xff, 0x9f, 0xf9, 0xff,
-    0xff, 0xff, 0xf9, 0xff, 0x8f, 0xff, 0xe7, 0xfe,
-    0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xe3, 0xff, 0xf9,
-    0xff, 0x9f, 0xff, 0xff, 0xff, 0x9f, 0xf8, 0xff,
-    0xfe, 0x7f, 0xe7, 0xff, 0xff, 0xff, 0xe3, 0xfe,
-    0x3f, 0xff, 0x9f, 0xf1, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0x8f, 0xff, 0xe7, 0xfc, 0x7f, 0xff, 0xff,
-    0xfe, 0x1f, 0xe3, 0xff, 0xf9, 0xfe, 0x1f, 0xff,
-    0xff, 0xff, 0x83, 0xf8, 0xff, 0xfe, 0x7f, 0x7,
-    0xff, 0xff, 0xff, 0xe0, 0xfe, 0x1f, 0xff, 0x1f,
-    0xc1, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0x87, 0xff,
-    0xc7, 0xe0, 0x7f, 0xff, 0xff, 0xfe, 0x7, 0xe0,
-    0xff, 0xe1, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0xf8, 0x1f, 0xf0, 0x7c, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x3e, 0x7, 0xfc, 0x1f, 0x1, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0xf, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xc7, 0xc7,
-    0xff, 0xf1, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xf9,
-    0xf3, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x8f, 0xff,
-    0xfe, 0x38, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0xc4, 0x7f, 0xff, 0xf8, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xf1, 0x1f, 0xff, 0xff, 0x1f,
-    0xff, 0xf1, 0xff, 0xff, 0xfe, 0xf, 0xff, 0xff,
-    0xe3, 0xfc, 0x0, 0xff, 0xff, 0xff, 0x83, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf1,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xf, 0xff, 0xff,
-    0xf8, 0x3f, 0xff, 0xff, 0xc0, 0xf, 0xf1, 0xff,
-    0xff, 0xfe, 0xf, 0xff, 0xff, 0xe3, 0xff, 0xfe,
-    0x3f, 0xff, 0xff, 0x11, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xc7, 0xff, 0xff, 0xc4, 0x7f, 0xff, 0xf8,
-    0xff, 0xff, 0xf8, 0xff, 0xff, 0xe3, 0x8f, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0x1f, 0xff, 0xf9, 0xf3,
-    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xe3, 0xff, 0xfc,
-    0x7c, 0x7f, 0xff, 0x1f, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x3f, 0x80, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0xf, 0xe0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x3e, 0x7, 0xfc, 0x1f, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0xf, 0x81, 0xff, 0x7, 0xc0,
-    0x7f, 0xff, 0xff, 0xfe, 0x7, 0xe0, 0xff, 0xe1,
-    0xf8, 0x1f, 0xff, 0xff, 0xff, 0x81, 0xf8, 0x7f,
-    0xfc, 0x7e, 0x7, 0xff, 0xff, 0xff, 0xe0, 0xfe,
-    0x1f, 0xff, 0x1f, 0xc1, 0xff, 0xff, 0xff, 0xf8,
-    0x3f, 0x8f, 0xff, 0xe7, 0xf0, 0x7f, 0xff, 0xff,
-    0xfe, 0x1f, 0xe3, 0xff, 0xf9, 0xfe, 0x1f, 0xff,
-    0xff, 0xff, 0x8f, 0xf8, 0xff, 0xfe, 0x7f, 0xc7,
-    0xff, 0xff, 0xff, 0xe3, 0xfe, 0x3f, 0xff, 0x9f,
-    0xf1, 0xff, 0xff, 0xff, 0xf9, 0xff, 0x8f, 0xff,
-    0xe7, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xe3,
-    0xff, 0xf9, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x9f,
-    0xf8, 0xff, 0xfe, 0x7f, 0xe7, 0xff, 0xff, 0xff,
-    0xe7, 0xfe, 0x3f, 0xff, 0x9f, 0xf9, 0xff, 0xff,
-    0xff, 0xf9, 0xff, 0x8f, 0xff, 0xe7, 0xfe, 0x7f,
-    0xff, 0xff, 0xfe, 0x7f, 0xe3, 0xff, 0xf9, 0xff,
-    0x9f, 0xff, 0xff, 0xff, 0x9f, 0xf8, 0xff, 0xfe,
-    0x7f, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xfe, 0x3f,
-    0xff, 0x9f, 0xf9, 0xff, 0xff, 0xff, 0xf9, 0xff,
-    0x8f, 0xff, 0xe7, 0xfe, 0x7f, 0xff, 0xff, 0xfe,
-    0x7f, 0xe3, 0xff, 0xf9, 0xff, 0x9f, 0xff, 0xff,
-    0xff, 0x9f, 0xf8, 0xff, 0xfe, 0x7f, 0xe7, 0xff,
-    0xff, 0xff, 0xe7, 0xfe, 0x3f, 0xff, 0x9f, 0xf9,
-    0xff, 0xff, 0xff, 0xf9, 0xff, 0x8f, 0xff, 0xe7,
-    0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xe3, 0xff,
-    0xf9, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x9f, 0xf0,
-    0xff, 0xfe, 0x3f, 0xe7, 0xff, 0xff, 0xff, 0xe7,
-    0xfc, 0x3f, 0xff, 0x8f, 0xf9, 0xff, 0xff, 0xff,
-    0xf9, 0xfe, 0xf, 0xff, 0xe1, 0xfe, 0x7f, 0xff,
-    0xff, 0xfe, 0x7f, 0x3, 0xff, 0xf8, 0x3f, 0x9f,
-    0xff, 0xff, 0xff, 0x9f, 0xc0, 0xff, 0xfe, 0xf,
-    0xe7, 0xff, 0xff, 0xff, 0xe7, 0xe0, 0x3f, 0xff,
-    0x81, 0xf9, 0xff, 0xff, 0xff, 0xf9, 0xf8, 0xf,
-    0xff, 0xe0, 0x7e, 0x7f, 0xff, 0xff, 0xfe, 0x7c,
-    0x3, 0xff, 0xf8, 0xf, 0x9f, 0xff, 0xff, 0xff,
-    0x9e, 0x0, 0xff, 0xfe, 0x1, 0xe7, 0xff, 0xff,
-    0xff, 0xe7, 0x80, 0x3f, 0xff, 0x80, 0x79, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
-    0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1f, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe3, 0xfd, 0xf8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7e, 0x3c, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x8f, 0x6, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x80, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 384, .box_w = 1, .box_h = 1, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1, .adv_w = 1567, .box_w = 1, .box_h = 1, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2, .adv_w = 1567, .box_w = 45, .box_h = 53, .ofs_x = 12, .ofs_y = 61},
-    {.bitmap_index = 301, .adv_w = 1567, .box_w = 75, .box_h = 120, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 1426, .adv_w = 1567, .box_w = 74, .box_h = 109, .ofs_x = 12, .ofs_y = 6},
-    {.bitmap_index = 2435, .adv_w = 1567, .box_w = 69, .box_h = 120, .ofs_x = 17, .ofs_y = 0},
-    {.bitmap_index = 3470, .adv_w = 1567, .box_w = 15, .box_h = 40, .ofs_x = 42, .ofs_y = 63},
-    {.bitmap_index = 3545, .adv_w = 1567, .box_w = 10, .box_h = 85, .ofs_x = 59, .ofs_y = 17},
-    {.bitmap_index = 3652, .adv_w = 1567, .box_w = 10, .box_h = 85, .ofs_x = 29, .ofs_y = 17},
-    {.bitmap_index = 3759, .adv_w = 1567, .box_w = 56, .box_h = 86, .ofs_x = 21, .ofs_y = 17},
-    {.bitmap_index = 4361, .adv_w = 1567, .box_w = 56, .box_h = 86, .ofs_x = 21, .ofs_y = 17},
-    {.bitmap_index = 4963, .adv_w = 1567, .box_w = 10, .box_h = 33, .ofs_x = 29, .ofs_y = 17},
-    {.bitmap_index = 5005, .adv_w = 1567, .box_w = 56, .box_h = 15, .ofs_x = 21, .ofs_y = 53},
-    {.bitmap_index = 5110, .adv_w = 0, .box_w = 15, .box_h = 15, .ofs_x = -7, .ofs_y = 0},
-    {.bitmap_index = 5139, .adv_w = 1567, .box_w = 40, .box_h = 86, .ofs_x = 29, .ofs_y = 17},
-    {.bitmap_index = 5569, .adv_w = 1567, .box_w = 74, .box_h = 120, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 6679, .adv_w = 1567, .box_w = 15, .box_h = 109, .ofs_x = 71, .ofs_y = 5},
-    {.bitmap_index = 6884, .adv_w = 1567, .box_w = 74, .box_h = 120, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 7994, .adv_w = 1567, .box_w = 69, .box_h = 120, .ofs_x = 17, .ofs_y = 0},
-    {.bitmap_index = 9029, .adv_w = 1567, .box_w = 74, .box_h = 109, .ofs_x = 12, .ofs_y = 6},
-    {.bitmap_index = 10038, .adv_w = 1567, .box_w = 74, .box_h = 120, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 11148, .adv_w = 1567, .box_w = 74, .box_h = 120, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 12258, .adv_w = 1567, .box_w = 74, .box_h = 115, .ofs_x = 12, .ofs_y = 5},
-    {.bitmap_index = 13322, .adv_w = 1567, .box_w = 74, .box_h = 120, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 14432, .adv_w = 1567, .box_w = 74, .box_h = 120, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 15542, .adv_w = 384, .box_w = 15, .box_h = 64, .ofs_x = 5, .ofs_y = 26},
-    {.bitmap_index = 15662, .adv_w = 1567, .box_w = 64, .box_h = 103, .ofs_x = 17, .ofs_y = 0},
-    {.bitmap_index = 16486, .adv_w = 1567, .box_w = 64, .box_h = 67, .ofs_x = 17, .ofs_y = 0},
-    {.bitmap_index = 17022, .adv_w = 1567, .box_w = 64, .box_h = 103, .ofs_x = 17, .ofs_y = 0},
-    {.bitmap_index = 17846, .adv_w = 1567, .box_w = 75, .box_h = 103, .ofs_x = 12, .ofs_y = 17},
-    {.bitmap_index = 18812, .adv_w = 1567, .box_w = 75, .box_h = 120, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 19937, .adv_w = 1567, .box_w = 74, .box_h = 115, .ofs_x = 12, .ofs_y = 5},
-    {.bitmap_index = 21001, .adv_w = 1567, .box_w = 69, .box_h = 120, .ofs_x = 18, .ofs_y = 0},
-    {.bitmap_index = 22036, .adv_w = 1567, .box_w = 69, .box_h = 120, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 23071, .adv_w = 1567, .box_w = 69, .box_h = 120, .ofs_x = 18, .ofs_y = 0},
-    {.bitmap_index = 24106, .adv_w = 1567, .box_w = 69, .box_h = 120, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 25141, .adv_w = 1567, .box_w = 69, .box_h = 115, .ofs_x = 12, .ofs_y = 5},
-    {.bitmap_index = 26133, .adv_w = 1567, .box_w = 74, .box_h = 120, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 27243, .adv_w = 1567, .box_w = 74, .box_h = 109, .ofs_x = 12, .ofs_y = 6},
-    {.bitmap_index = 28252, .adv_w = 1567, .box_w = 63, .box_h = 120, .ofs_x = 18, .ofs_y = 0},
-    {.bitmap_index = 29197, .adv_w = 1567, .box_w = 74, .box_h = 114, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 30252, .adv_w = 1567, .box_w = 57, .box_h = 109, .ofs_x = 12, .ofs_y = 5},
-    {.bitmap_index = 31029, .adv_w = 1567, .box_w = 69, .box_h = 114, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 32013, .adv_w = 1567, .box_w = 74, .box_h = 109, .ofs_x = 12, .ofs_y = 5},
-    {.bitmap_index = 33022, .adv_w = 1567, .box_w = 74, .box_h = 109, .ofs_x = 12, .ofs_y = 5},
-    {.bitmap_index = 34031, .adv_w = 1567, .box_w = 74, .box_h = 120, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 35141, .adv_w = 1567, .box_w = 74, .box_h = 115, .ofs_x = 12, .ofs_y = 5},
-    {.bitmap_index = 36205, .adv_w = 1567, .box_w = 74, .box_h = 120, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 37315, .adv_w = 1567, .box_w = 74, .box_h = 115, .ofs_x = 12, .ofs_y = 5},
-    {.bitmap_index = 38379, .adv_w = 1567, .box_w = 74, .box_h = 120, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 39489, .adv_w = 1567, .box_w = 63, .box_h = 103, .ofs_x = 18, .ofs_y = 17},
-    {.bitmap_index = 40301, .adv_w = 1567, .box_w = 74, .box_h = 114, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 41356, .adv_w = 1567, .box_w = 57, .box_h = 109, .ofs_x = 12, .ofs_y = 5},
-    {.bitmap_index = 42133, .adv_w = 1567, .box_w = 74, .box_h = 109, .ofs_x = 12, .ofs_y = 5},
-    {.bitmap_index = 43142, .adv_w = 1567, .box_w = 40, .box_h = 85, .ofs_x = 29, .ofs_y = 17},
-    {.bitmap_index = 43567, .adv_w = 1567, .box_w = 40, .box_h = 86, .ofs_x = 29, .ofs_y = 17},
-    {.bitmap_index = 43997, .adv_w = 1567, .box_w = 64, .box_h = 120, .ofs_x = 17, .ofs_y = 0},
-    {.bitmap_index = 44957, .adv_w = 1567, .box_w = 40, .box_h = 86, .ofs_x = 29, .ofs_y = 17},
-    {.bitmap_index = 45387, .adv_w = 1567, .box_w = 27, .box_h = 53, .ofs_x = 12, .ofs_y = 61},
-    {.bitmap_index = 45566, .adv_w = 1567, .box_w = 64, .box_h = 15, .ofs_x = 17, .ofs_y = 0},
-    {.bitmap_index = 45686, .adv_w = 1567, .box_w = 10, .box_h = 33, .ofs_x = 29, .ofs_y = 70},
-    {.bitmap_index = 45728, .adv_w = 1567, .box_w = 74, .box_h = 115, .ofs_x = 12, .ofs_y = 5},
-    {.bitmap_index = 46792, .adv_w = 1567, .box_w = 69, .box_h = 120, .ofs_x = 18, .ofs_y = 0},
-    {.bitmap_index = 47827, .adv_w = 1567, .box_w = 69, .box_h = 120, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 48862, .adv_w = 1567, .box_w = 69, .box_h = 120, .ofs_x = 18, .ofs_y = 0},
-    {.bitmap_index = 49897, .adv_w = 1567, .box_w = 69, .box_h = 120, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 50932, .adv_w = 1567, .box_w = 69, .box_h = 115, .ofs_x = 12, .ofs_y = 5},
-    {.bitmap_index = 51924, .adv_w = 1567, .box_w = 74, .box_h = 120, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 53034, .adv_w = 1567, .box_w = 74, .box_h = 109, .ofs_x = 12, .ofs_y = 6},
-    {.bitmap_index = 54043, .adv_w = 1567, .box_w = 63, .box_h = 120, .ofs_x = 18, .ofs_y = 0},
-    {.bitmap_index = 54988, .adv_w = 1567, .box_w = 74, .box_h = 114, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 56043, .adv_w = 1567, .box_w = 57, .box_h = 109, .ofs_x = 12, .ofs_y = 5},
-    {.bitmap_index = 56820, .adv_w = 1567, .box_w = 69, .box_h = 114, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 57804, .adv_w = 1567, .box_w = 74, .box_h = 109, .ofs_x = 12, .ofs_y = 5},
-    {.bitmap_index = 58813, .adv_w = 1567, .box_w = 74, .box_h = 109, .ofs_x = 12, .ofs_y = 5},
-    {.bitmap_index = 59822, .adv_w = 1567, .box_w = 74, .box_h = 120, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 60932, .adv_w = 1567, .box_w = 74, .box_h = 115, .ofs_x = 12, .ofs_y = 5},
-    {.bitmap_index = 61996, .adv_w = 1567, .box_w = 74, .box_h = 120, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 63106, .adv_w = 1567, .box_w = 74, .box_h = 115, .ofs_x = 12, .ofs_y = 5},
-    {.bitmap_index = 64170, .adv_w = 1567, .box_w = 74, .box_h = 120, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 65280, .adv_w = 1567, .box_w = 63, .box_h = 103, .ofs_x = 18, .ofs_y = 17},
-    {.bitmap_index = 66092, .adv_w = 1567, .box_w = 74, .box_h = 114, .ofs_x = 12, .ofs_y = 0},
-    {.bitmap_index = 67147, .adv_w = 1567, .box_w = 57, .box_h = 109, .ofs_x = 12, .ofs_y = 5},
-    {.bitmap_index = 67924, .adv_w = 1567, .box_w = 74, .box_h = 109, .ofs_x = 12, .ofs_y = 5},
-    {.bitmap_index = 68933, .adv_w = 1567, .box_w = 40, .box_h = 85, .ofs_x = 29, .ofs_y = 17},
-    {.bitmap_index = 69358, .adv_w = 1567, .box_w = 40, .box_h = 86, .ofs_x = 29, .ofs_y = 17},
-    {.bitmap_index = 69788, .adv_w = 1567, .box_w = 64, .box_h = 120, .ofs_x = 17, .ofs_y = 0},
-    {.bitmap_index = 70748, .adv_w = 1567, .box_w = 15, .box_h = 85, .ofs_x = 42, .ofs_y = 17},
-    {.bitmap_index = 70908, .adv_w = 1567, .box_w = 74, .box_h = 120, .ofs_x = 12, .ofs_y = 0}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint8_t glyph_id_ofs_list_3[] = {
-    0, 0, 1, 2, 3, 4, 5, 6,
-    7, 8, 9, 10, 11, 12, 13, 14,
-    15, 16, 17, 18, 19, 20, 21, 22,
-    23, 24, 25, 26, 27, 28, 29, 0,
-    30, 0, 31
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 3, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 36, .range_length = 23, .glyph_id_start = 4,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 60, .range_length = 31, .glyph_id_start = 27,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 92, .range_length = 35, .glyph_id_start = 58,
-        .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_3, .list_length = 35, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL
-    }
-};
-
-
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = NULL,
-    .kern_scale = 0,
-    .cmap_num = 4,
-    .bpp = 1,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-    .cache = &cache
-#endif
-
-};
-
-extern const lv_font_t lv_font_montserrat_48;
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t dseg14_120 = {
-#else
-lv_font_t dseg14_120 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 120,          /*The maximum line height required by the font*/
-    .base_line = 0,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -15,
-    .underline_thickness = 6,
-#endif
-    .static_bitmap = 0,
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-    .fallback = &lv_font_montserrat_48,
-#endif
-    .user_data = NULL,
-};
-
-
-
-#endif /*#if DSEG14_120*/
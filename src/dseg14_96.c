@@ -1,6218 +0,0 @@
-/*******************************************************************************
- * Size: 96 px
- * Bpp: 1
- * Opts: --bpp 1 --size 96 --no-compress --stride 1 --align 1 --font DSEG14Classic-Bold.ttf --symbols 1234567890-. --range 32-127 --format lvgl -o dseg14_96.c
- ******************************************************************************/
-
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-
-#ifndef DSEG14_96
-#define DSEG14_96 1
-#endif
-
-#if DSEG14_96
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-    0x0,
-
-    /* U+0021 "!" */
-    0x0,
-
-    /* U+0022 "\"" */
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
-    0x0, 0x78, 0x0, 0x0, 0x0, 0xf, 0xc0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0xf,
-    0xfc, 0x0, 0x0, 0x0, 0xff, 0xe0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0xff, 0xff, 0xff, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0xff, 0xff, 0xff, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0xf, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xff,
-    0xff, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0xff, 0xff, 0xff, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x7,
-    0xfe, 0xff, 0xf0, 0x0, 0x3f, 0xcf, 0xff, 0x0,
-    0x3, 0xfc, 0xff, 0xf0, 0x0, 0x1f, 0x8f, 0xfe,
-    0x0, 0x1, 0xf8, 0xff, 0xc0, 0x0, 0xf, 0xf,
-    0xf8, 0x0, 0x0, 0x60, 0xff, 0x0, 0x0, 0x6,
-    0xf, 0xe0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x78, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xf, 0xc7, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0xf, 0xf1, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0xff, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0xf, 0xfc, 0x7f, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0xf,
-    0xff, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0xf, 0xff, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xf0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0xf,
-    0xff, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0x0,
-    0x7, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x3,
-    0xfc, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x1f,
-    0x80, 0x0, 0x0, 0xf, 0xfe, 0x0, 0x1, 0xf8,
-    0x0, 0x0, 0x0, 0xff, 0xc7, 0xff, 0xcf, 0x3f,
-    0xfe, 0x0, 0xf, 0xf8, 0xff, 0xfc, 0x63, 0xff,
-    0xf0, 0x0, 0xff, 0x1f, 0xff, 0xe6, 0x7f, 0xff,
-    0x80, 0xf, 0xe3, 0xff, 0xfe, 0x7, 0xff, 0xfc,
-    0x0, 0xfc, 0x7f, 0xff, 0xf0, 0xff, 0xff, 0xe0,
-    0x0, 0xf, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x0,
-    0x0, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xf0, 0x0,
-    0x7, 0xff, 0xff, 0xf, 0xff, 0xfe, 0x3f, 0x0,
-    0x3f, 0xff, 0xe0, 0x7f, 0xff, 0xc7, 0xf0, 0x1,
-    0xff, 0xfe, 0x67, 0xff, 0xf8, 0xff, 0x0, 0xf,
-    0xff, 0xc6, 0x3f, 0xff, 0x1f, 0xf0, 0x0, 0x7f,
-    0xfc, 0xf3, 0xff, 0xe3, 0xff, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x7f, 0xf0, 0x0, 0x0, 0x1,
-    0xf8, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x3f,
-    0xc0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x7f, 0xe0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0xf, 0xff, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xf0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0xf,
-    0xff, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0xf, 0xff, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xfe, 0x3f, 0xf0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xff, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xf0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7f, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xe3, 0xf0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x1e, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-
-    /* U+0025 "%" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xce, 0x0, 0x0, 0x0, 0x70,
-    0x0, 0x7f, 0xf9, 0xe0, 0x0, 0x0, 0x1e, 0x0,
-    0xf, 0xff, 0x3c, 0x0, 0x0, 0x3, 0xc0, 0x1,
-    0xff, 0xe7, 0xc0, 0x0, 0x0, 0xf8, 0x0, 0x3f,
-    0xfc, 0xfc, 0x0, 0x0, 0x3f, 0x0, 0x7, 0xff,
-    0x9f, 0x80, 0x0, 0x7, 0xe0, 0x0, 0xff, 0xf3,
-    0xf8, 0x0, 0x1, 0xfc, 0x0, 0x1f, 0xfe, 0x7f,
-    0x0, 0x0, 0x3f, 0x80, 0x3, 0xff, 0xcf, 0xf0,
-    0x0, 0xf, 0xf0, 0x0, 0x7f, 0xf9, 0xfe, 0x0,
-    0x1, 0xfe, 0x0, 0xf, 0xff, 0x3f, 0xc0, 0x0,
-    0x3f, 0xc0, 0x1, 0xff, 0xe7, 0xf8, 0x0, 0x7,
-    0xf8, 0x0, 0x3f, 0xfc, 0xff, 0x0, 0x0, 0xff,
-    0x0, 0x7, 0xff, 0x9f, 0xe0, 0x0, 0x1f, 0xe0,
-    0x0, 0xff, 0xf3, 0xfc, 0x0, 0x3, 0xfc, 0x0,
-    0x1f, 0xfe, 0x7f, 0x80, 0x0, 0x7f, 0x80, 0x3,
-    0xff, 0xcf, 0xf0, 0x0, 0xf, 0xf0, 0x0, 0x7f,
-    0xf9, 0xfe, 0x0, 0x1, 0xfe, 0x0, 0xf, 0xff,
-    0x3f, 0xc0, 0x0, 0x3f, 0xc0, 0x1, 0xff, 0xe3,
-    0xf8, 0x0, 0x7, 0xf0, 0x0, 0x3f, 0xfc, 0x7f,
-    0x0, 0x0, 0xfe, 0x0, 0x7, 0xff, 0x87, 0xe0,
-    0x0, 0x1f, 0x80, 0x0, 0xff, 0xf0, 0xfc, 0x0,
-    0x3, 0xf0, 0x0, 0x1f, 0xfe, 0xf, 0x80, 0x0,
-    0x7c, 0x0, 0x3, 0xff, 0xc0, 0xf0, 0x0, 0xf,
-    0x0, 0x0, 0x7f, 0xf8, 0x1e, 0x0, 0x1, 0xe0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf1, 0xff, 0xf0, 0xf, 0xff, 0x80, 0x7,
-    0xfc, 0x7f, 0xfe, 0x1, 0xff, 0xf8, 0x0, 0xff,
-    0x1f, 0xff, 0xe0, 0x7f, 0xff, 0x0, 0x1f, 0xc7,
-    0xff, 0xfc, 0xf, 0xff, 0xf0, 0x3, 0xf1, 0xff,
-    0xff, 0xc3, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff,
-    0xfc, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff,
-    0x9f, 0xff, 0xfe, 0x0, 0x0, 0xff, 0xff, 0xe1,
-    0xff, 0xff, 0x8f, 0xc0, 0xf, 0xff, 0xf8, 0x1f,
-    0xff, 0xe3, 0xf8, 0x0, 0xff, 0xff, 0x3, 0xff,
-    0xfc, 0xff, 0x0, 0xf, 0xff, 0xc0, 0x3f, 0xff,
-    0x3f, 0xe0, 0x0, 0xff, 0xf8, 0x7, 0xff, 0xcf,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x3, 0xc0, 0x0, 0x3c, 0x1f, 0xfe, 0x0,
-    0x0, 0xf8, 0x0, 0x7, 0x83, 0xff, 0xc0, 0x0,
-    0x1f, 0x0, 0x0, 0xf8, 0x7f, 0xf8, 0x0, 0x7,
-    0xe0, 0x0, 0x1f, 0x8f, 0xff, 0x0, 0x0, 0xfc,
-    0x0, 0x3, 0xf1, 0xff, 0xe0, 0x0, 0x3f, 0x80,
-    0x0, 0x7f, 0x3f, 0xfc, 0x0, 0x7, 0xf0, 0x0,
-    0xf, 0xe7, 0xff, 0x80, 0x1, 0xfe, 0x0, 0x1,
-    0xfe, 0xff, 0xf0, 0x0, 0x3f, 0xc0, 0x0, 0x3f,
-    0xdf, 0xfe, 0x0, 0x7, 0xf8, 0x0, 0x7, 0xfb,
-    0xff, 0xc0, 0x0, 0xff, 0x0, 0x0, 0xff, 0x7f,
-    0xf8, 0x0, 0x1f, 0xe0, 0x0, 0x1f, 0xef, 0xff,
-    0x0, 0x3, 0xfc, 0x0, 0x3, 0xfd, 0xff, 0xe0,
-    0x0, 0x7f, 0x80, 0x0, 0x7f, 0xbf, 0xfc, 0x0,
-    0xf, 0xf0, 0x0, 0xf, 0xf7, 0xff, 0x80, 0x1,
-    0xfe, 0x0, 0x1, 0xfe, 0xff, 0xf0, 0x0, 0x3f,
-    0xc0, 0x0, 0x3f, 0xdf, 0xfe, 0x0, 0x7, 0xf8,
-    0x0, 0x7, 0xfb, 0xff, 0xc0, 0x0, 0xfe, 0x0,
-    0x0, 0x7f, 0x7f, 0xf8, 0x0, 0x1f, 0xc0, 0x0,
-    0xf, 0xef, 0xff, 0x0, 0x3, 0xf0, 0x0, 0x0,
-    0xfd, 0xff, 0xe0, 0x0, 0x7e, 0x0, 0x0, 0x1f,
-    0xbf, 0xfc, 0x0, 0xf, 0x80, 0x0, 0x1, 0xf7,
-    0xff, 0x80, 0x1, 0xe0, 0x0, 0x0, 0x1e, 0xff,
-    0xf0, 0x0, 0x3c, 0x0, 0x0, 0x3, 0xdf, 0xfe,
-    0x0, 0x7, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0026 "&" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x1, 0xc0,
-    0x0, 0x0, 0x3c, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0,
-    0x3e, 0x0, 0x0, 0x7, 0xc0, 0x0, 0x0, 0x3f,
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x3f, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x1f, 0xc0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x1f,
-    0xc0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x3f, 0xc0,
-    0x0, 0x0, 0x3f, 0xc0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x3f, 0xc0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x3f,
-    0xc0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0x3f, 0xc0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x3f,
-    0xc0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x3f, 0xc0,
-    0x0, 0x0, 0x3f, 0xc0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x3f, 0xc0, 0x0, 0x0,
-    0x1f, 0xc0, 0x0, 0x3f, 0x80, 0x0, 0x0, 0x1f,
-    0xc0, 0x0, 0x3f, 0x80, 0x0, 0x0, 0xf, 0xc0,
-    0x0, 0x3f, 0x0, 0x0, 0x0, 0xf, 0xc0, 0x0,
-    0x3f, 0x0, 0x0, 0x0, 0x7, 0xc0, 0x0, 0x3e,
-    0x0, 0x0, 0x0, 0x7, 0xc0, 0x0, 0x3e, 0x0,
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x3c, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0x3, 0xc0, 0x0, 0x3c, 0xf, 0xff, 0x0,
-    0x7, 0xc0, 0x0, 0x3e, 0xf, 0xff, 0x0, 0x7,
-    0xc0, 0x0, 0x3e, 0xf, 0xff, 0x0, 0xf, 0xc0,
-    0x0, 0x3f, 0xf, 0xff, 0x0, 0xf, 0xc0, 0x0,
-    0x3f, 0xf, 0xff, 0x0, 0x1f, 0xc0, 0x0, 0x3f,
-    0x8f, 0xff, 0x0, 0x1f, 0xc0, 0x0, 0x3f, 0x8f,
-    0xff, 0x0, 0x3f, 0xc0, 0x0, 0x3f, 0xcf, 0xff,
-    0x0, 0x3f, 0xc0, 0x0, 0x3f, 0xcf, 0xff, 0x0,
-    0x3f, 0xc0, 0x0, 0x3f, 0xcf, 0xff, 0x0, 0x3f,
-    0xc0, 0x0, 0x3f, 0xcf, 0xff, 0x0, 0x3f, 0xc0,
-    0x0, 0x3f, 0xcf, 0xff, 0x0, 0x3f, 0xc0, 0x0,
-    0x3f, 0xcf, 0xff, 0x0, 0x3f, 0xc0, 0x0, 0x3f,
-    0xcf, 0xff, 0x0, 0x3f, 0xc0, 0x0, 0x3f, 0xcf,
-    0xff, 0x0, 0x3f, 0xc0, 0x0, 0x3f, 0xcf, 0xff,
-    0x0, 0x3f, 0xc0, 0x0, 0x3f, 0xcf, 0xff, 0x0,
-    0x3f, 0xc0, 0x0, 0x3f, 0xcf, 0xff, 0x0, 0x3f,
-    0x80, 0x0, 0x1f, 0xcf, 0xff, 0x0, 0x3f, 0x80,
-    0x0, 0x1f, 0xcf, 0xff, 0x0, 0x3f, 0x0, 0x0,
-    0xf, 0xcf, 0xff, 0x0, 0x3f, 0x0, 0x0, 0xf,
-    0xcf, 0xff, 0x0, 0x3e, 0x0, 0x0, 0x7, 0xcf,
-    0xff, 0x0, 0x3c, 0x0, 0x0, 0x3, 0xcf, 0xff,
-    0x0, 0x3c, 0x0, 0x0, 0x3, 0xcf, 0xff, 0x0,
-    0x38, 0x0, 0x0, 0x1, 0xcf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xe3, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xff, 0x1, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0x3, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x1e, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x8c, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-
-    /* U+0027 "'" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0xfe, 0x3f, 0xc3, 0xfc, 0x1f,
-    0x81, 0xf8, 0xf, 0x0, 0xf0, 0x6, 0x0, 0x40,
-
-    /* U+0028 "(" */
-    0x7, 0xf, 0xf, 0x1f, 0x3f, 0x3f, 0x7f, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xfc, 0xf8,
-    0xf8, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf0, 0xf8, 0xf8, 0xfc, 0xfc, 0xfe,
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0x3f, 0x3f,
-    0x1f, 0xf, 0xf, 0x7,
-
-    /* U+0029 ")" */
-    0xe0, 0xf0, 0xf0, 0xf8, 0xfc, 0xfc, 0xfe, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x7f, 0x7f, 0x3f, 0x3f, 0x1f,
-    0x1f, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x1f, 0x1f, 0x3f, 0x3f, 0x7f,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xfc,
-    0xf8, 0xf0, 0xf0, 0xe0,
-
-    /* U+002A "*" */
-    0x1, 0xc0, 0x7f, 0xf8, 0xe, 0x0, 0xf, 0x3,
-    0xff, 0xc0, 0xf0, 0x0, 0x78, 0x1f, 0xfe, 0x7,
-    0x80, 0x3, 0xe0, 0xff, 0xf0, 0x7c, 0x0, 0x1f,
-    0x87, 0xff, 0x87, 0xe0, 0x0, 0xfc, 0x3f, 0xfc,
-    0x3f, 0x0, 0x7, 0xf1, 0xff, 0xe3, 0xf8, 0x0,
-    0x3f, 0x8f, 0xff, 0x1f, 0xc0, 0x1, 0xfe, 0x7f,
-    0xf9, 0xfe, 0x0, 0xf, 0xf3, 0xff, 0xcf, 0xf0,
-    0x0, 0x7f, 0x9f, 0xfe, 0x7f, 0x80, 0x3, 0xfc,
-    0xff, 0xf3, 0xfc, 0x0, 0x1f, 0xe7, 0xff, 0x9f,
-    0xe0, 0x0, 0xff, 0x3f, 0xfc, 0xff, 0x0, 0x7,
-    0xf9, 0xff, 0xe7, 0xf8, 0x0, 0x3f, 0xcf, 0xff,
-    0x3f, 0xc0, 0x1, 0xfe, 0x7f, 0xf9, 0xfe, 0x0,
-    0xf, 0xf3, 0xff, 0xcf, 0xf0, 0x0, 0x7f, 0x9f,
-    0xfe, 0x7f, 0x80, 0x1, 0xfc, 0xff, 0xf3, 0xf8,
-    0x0, 0xf, 0xe7, 0xff, 0x9f, 0xc0, 0x0, 0x3f,
-    0x3f, 0xfc, 0xfc, 0x0, 0x1, 0xf8, 0xff, 0xe7,
-    0xe0, 0x0, 0x7, 0xc7, 0xfe, 0x3e, 0x0, 0x0,
-    0x1e, 0x1f, 0xe1, 0xe0, 0x0, 0x0, 0xf0, 0xff,
-    0xf, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x3f, 0xfe,
-    0x79, 0xff, 0xf0, 0x3, 0xff, 0xf1, 0x8f, 0xff,
-    0xc0, 0x3f, 0xff, 0xcc, 0xff, 0xff, 0x3, 0xff,
-    0xfe, 0x7, 0xff, 0xfc, 0x3f, 0xff, 0xf8, 0x7f,
-    0xff, 0xf3, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xdf,
-    0xff, 0xff, 0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xf0,
-    0xff, 0xff, 0xe1, 0xff, 0xff, 0x3, 0xff, 0xfe,
-    0x7, 0xff, 0xf9, 0x9f, 0xff, 0xe0, 0x1f, 0xff,
-    0x8c, 0x7f, 0xfe, 0x0, 0x7f, 0xfc, 0xf3, 0xff,
-    0xe0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x7e, 0x0, 0x0, 0x0, 0x7, 0x87, 0xf8,
-    0x78, 0x0, 0x0, 0x7c, 0x3f, 0xc3, 0xc0, 0x0,
-    0x3, 0xe3, 0xff, 0x1f, 0x0, 0x0, 0x3f, 0x3f,
-    0xfc, 0xfc, 0x0, 0x1, 0xf9, 0xff, 0xe7, 0xe0,
-    0x0, 0x1f, 0xcf, 0xff, 0x3f, 0x80, 0x0, 0xfe,
-    0x7f, 0xf9, 0xfc, 0x0, 0xf, 0xf3, 0xff, 0xcf,
-    0xf0, 0x0, 0x7f, 0x9f, 0xfe, 0x7f, 0x80, 0x3,
-    0xfc, 0xff, 0xf3, 0xfc, 0x0, 0x1f, 0xe7, 0xff,
-    0x9f, 0xe0, 0x0, 0xff, 0x3f, 0xfc, 0xff, 0x0,
-    0x7, 0xf9, 0xff, 0xe7, 0xf8, 0x0, 0x3f, 0xcf,
-    0xff, 0x3f, 0xc0, 0x1, 0xfe, 0x7f, 0xf9, 0xfe,
-    0x0, 0xf, 0xf3, 0xff, 0xcf, 0xf0, 0x0, 0x7f,
-    0x9f, 0xfe, 0x7f, 0x80, 0x3, 0xfc, 0xff, 0xf3,
-    0xfc, 0x0, 0x1f, 0xc7, 0xff, 0x8f, 0xe0, 0x0,
-    0xfe, 0x3f, 0xfc, 0x7f, 0x0, 0x7, 0xe1, 0xff,
-    0xe1, 0xf8, 0x0, 0x3f, 0xf, 0xff, 0xf, 0xc0,
-    0x1, 0xf0, 0x7f, 0xf8, 0x3e, 0x0, 0xf, 0x3,
-    0xff, 0xc0, 0xf0, 0x0, 0x78, 0x1f, 0xfe, 0x7,
-    0x80, 0x3, 0x80, 0xff, 0xf0, 0x1c, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x1, 0xf8,
-    0x0, 0x0, 0x7, 0xff, 0xcf, 0x3f, 0xfe, 0x0,
-    0xff, 0xfc, 0x63, 0xff, 0xf0, 0x1f, 0xff, 0xe6,
-    0x7f, 0xff, 0x83, 0xff, 0xfe, 0x7, 0xff, 0xfc,
-    0x7f, 0xff, 0xf0, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff,
-    0xf7, 0xff, 0xff, 0xf, 0xff, 0xfe, 0x3f, 0xff,
-    0xe0, 0x7f, 0xff, 0xc1, 0xff, 0xfe, 0x67, 0xff,
-    0xf8, 0xf, 0xff, 0xc6, 0x3f, 0xff, 0x0, 0x7f,
-    0xfc, 0xf3, 0xff, 0xe0, 0x0, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-
-    /* U+002C "," */
-    0xf, 0xf, 0x1f, 0x1f, 0x3f, 0x3f, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xfc, 0xf8,
-    0xf0, 0xf0, 0xe0,
-
-    /* U+002D "-" */
-    0x7, 0xff, 0xc0, 0x3f, 0xfe, 0x0, 0xff, 0xfc,
-    0x3, 0xff, 0xf0, 0x1f, 0xff, 0xe0, 0x7f, 0xff,
-    0x83, 0xff, 0xff, 0x7, 0xff, 0xfc, 0x7f, 0xff,
-    0xf0, 0xff, 0xff, 0xef, 0xff, 0xff, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xf7, 0xff,
-    0xff, 0xf, 0xff, 0xfe, 0x3f, 0xff, 0xf0, 0x7f,
-    0xff, 0xc1, 0xff, 0xfe, 0x7, 0xff, 0xf8, 0xf,
-    0xff, 0xc0, 0x3f, 0xff, 0x0, 0x7f, 0xfc, 0x3,
-    0xff, 0xe0,
-
-    /* U+002E "." */
-    0xf, 0x3, 0xfc, 0x7f, 0xe7, 0xfe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7f, 0xe7, 0xfe, 0x3f,
-    0xc0, 0xf0,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0xf,
-    0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0x1f,
-    0x0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0, 0x3f,
-    0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x7f,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0xfe,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0xfc,
-    0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0xf0,
-    0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0,
-    0x1f, 0x0, 0x0, 0x0, 0x1f, 0x0, 0x0, 0x0,
-    0x3f, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0,
-    0xfc, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0,
-    0xf0, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x0,
-    0xe0, 0x0, 0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x63, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x1e, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xf7, 0xe3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xcf, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0x3f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x7, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x7d, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0xf, 0xbf, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x3, 0xf7, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x7e, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x1f, 0xdf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x3,
-    0xfb, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xff,
-    0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x1f, 0xef,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x3, 0xfd, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x7f, 0xbf, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0xf, 0xf7, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x1, 0xfe, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x3f, 0xdf, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x7, 0xfb, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xff, 0x7f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x1f, 0xef, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x3, 0xfd, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x7f, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xf,
-    0xe7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x1, 0xf8,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3f, 0x1f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xc3, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0xf8, 0x7f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x1e, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x3c,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0xf, 0x80,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xc1, 0xf0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf8, 0x7e, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xf, 0xc0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xe3, 0xf8, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfc, 0x7f, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x9f, 0xe0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf3, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfe, 0x7f, 0x80, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xcf, 0xf0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf9,
-    0xfe, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x3f,
-    0xc0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe7, 0xf8,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0xff, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x9f, 0xe0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf3, 0xfc, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfe, 0x7f, 0x80, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xcf, 0xe0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf9, 0xfc, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x3f, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe7, 0xe0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0xf8, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x9f, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf3,
-    0xc0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x70,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xe7, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
-    0xfe, 0x7f, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff,
-    0xe7, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x7f, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xc7,
-    0xef, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x78,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80,
-
-    /* U+0031 "1" */
-    0x0, 0x0, 0xc, 0x1, 0xe0, 0x3f, 0x7, 0xf0,
-    0xff, 0x1f, 0xf3, 0xff, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0xff, 0x3f, 0xf1, 0xff, 0xf, 0xf0, 0x7f, 0x3,
-    0xf0, 0x0, 0x0, 0x0, 0x7f, 0x7, 0xf0, 0xff,
-    0x1f, 0xf3, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff,
-    0x3f, 0xf1, 0xff, 0xf, 0xf0, 0x7f, 0x3, 0xf0,
-    0x1e, 0x0, 0xc0,
-
-    /* U+0032 "2" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xf0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0x8f, 0xe0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xe3, 0xfc, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0x80, 0x3, 0xff, 0xff, 0xff, 0xfe, 0x3f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc, 0x0, 0x1f,
-    0xfe, 0x0, 0xff, 0xf1, 0xff, 0x80, 0x7, 0xff,
-    0xe0, 0x3f, 0xff, 0x1f, 0xf0, 0x1, 0xff, 0xfc,
-    0x7, 0xff, 0xf1, 0xfe, 0x0, 0x7f, 0xff, 0xc1,
-    0xff, 0xff, 0x1f, 0xc0, 0x1f, 0xff, 0xfc, 0x7f,
-    0xff, 0xf1, 0xf8, 0x7, 0xff, 0xff, 0x8f, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xf1, 0xff, 0xff,
-    0xe0, 0x1f, 0x8f, 0xff, 0xfe, 0x3f, 0xff, 0xf8,
-    0x3, 0xf8, 0xff, 0xff, 0x83, 0xff, 0xfe, 0x0,
-    0x7f, 0x8f, 0xff, 0xe0, 0x3f, 0xff, 0x80, 0xf,
-    0xf8, 0xff, 0xfc, 0x7, 0xff, 0xe0, 0x1, 0xff,
-    0x8f, 0xff, 0x0, 0x7f, 0xf8, 0x0, 0x3f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xc0, 0x1, 0xff, 0x1f, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x3f, 0xc7, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x7, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0xf, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80,
-
-    /* U+0033 "3" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe3, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xfe, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0xfc, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0x8f, 0xf8, 0x7, 0xff, 0xff, 0xff,
-    0xfe, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfc, 0x3, 0xff, 0xe0, 0xf, 0xff, 0x1f, 0xf8,
-    0xf, 0xff, 0xe0, 0x3f, 0xff, 0x1f, 0xf0, 0x3f,
-    0xff, 0xc0, 0xff, 0xff, 0x1f, 0xe0, 0xff, 0xff,
-    0xc1, 0xff, 0xff, 0x1f, 0xc3, 0xff, 0xff, 0x87,
-    0xff, 0xff, 0x1f, 0x8f, 0xff, 0xff, 0x8f, 0xff,
-    0xff, 0x0, 0x1f, 0xff, 0xff, 0x1f, 0xff, 0xfe,
-    0x0, 0x1f, 0xff, 0xfc, 0x3f, 0xff, 0xf8, 0xfc,
-    0x1f, 0xff, 0xf8, 0x3f, 0xff, 0xe3, 0xf8, 0x1f,
-    0xff, 0xe0, 0x7f, 0xff, 0x8f, 0xf0, 0x1f, 0xff,
-    0xc0, 0x7f, 0xfe, 0x3f, 0xe0, 0x1f, 0xff, 0x0,
-    0x7f, 0xf8, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf0, 0xf, 0xff, 0xff, 0xff, 0xfc, 0x7f,
-    0xe0, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xc0,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0x83, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x7f, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7e, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x7e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xf1, 0xff, 0xe0, 0xf, 0xff, 0x1f, 0xff,
-    0xfc, 0x7f, 0xfe, 0x3, 0xff, 0xf1, 0xff, 0xff,
-    0x1f, 0xff, 0xc0, 0x7f, 0xff, 0x1f, 0xff, 0xc7,
-    0xff, 0xfc, 0x1f, 0xff, 0xf1, 0xff, 0xf1, 0xff,
-    0xff, 0xc7, 0xff, 0xff, 0x1f, 0x80, 0x7f, 0xff,
-    0xf8, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff,
-    0x1f, 0xff, 0xfe, 0x0, 0x0, 0xff, 0xff, 0xe3,
-    0xff, 0xff, 0x8f, 0xc0, 0xf, 0xff, 0xf8, 0x3f,
-    0xff, 0xe3, 0xf8, 0x0, 0xff, 0xfe, 0x3, 0xff,
-    0xf8, 0xff, 0x0, 0xf, 0xff, 0xc0, 0x7f, 0xfe,
-    0x3f, 0xe0, 0x0, 0xff, 0xf0, 0x7, 0xff, 0x8f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0035 "5" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x63, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x1e, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x7, 0xe3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x1f, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x3, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x7f, 0xe3, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x1f,
-    0xfe, 0x0, 0xff, 0xf0, 0x0, 0x7f, 0xc7, 0xff,
-    0xe0, 0x3f, 0xff, 0x0, 0xf, 0xf1, 0xff, 0xfc,
-    0x7, 0xff, 0xf0, 0x1, 0xfc, 0x7f, 0xff, 0xc1,
-    0xff, 0xff, 0x0, 0x3f, 0x1f, 0xff, 0xfc, 0x7f,
-    0xff, 0xf0, 0x0, 0x7, 0xff, 0xff, 0x8f, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xf1, 0xff, 0xff,
-    0xe0, 0x0, 0xf, 0xff, 0xfe, 0x3f, 0xff, 0xf8,
-    0xfc, 0x0, 0xff, 0xff, 0x83, 0xff, 0xfe, 0x3f,
-    0x80, 0xf, 0xff, 0xe0, 0x3f, 0xff, 0x8f, 0xf0,
-    0x0, 0xff, 0xfc, 0x7, 0xff, 0xe3, 0xfe, 0x0,
-    0xf, 0xff, 0x0, 0x7f, 0xf8, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xc7, 0xfe, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xc0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xc7, 0xf8, 0x1, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7f, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xc7,
-    0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x78,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80,
-
-    /* U+0036 "6" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x63, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x1e, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x7, 0xe3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x1f, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x3, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x7f, 0xe3, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x1f,
-    0xfe, 0x0, 0xff, 0xf0, 0x0, 0x7f, 0xc7, 0xff,
-    0xe0, 0x3f, 0xff, 0x0, 0xf, 0xf1, 0xff, 0xfc,
-    0x7, 0xff, 0xf0, 0x1, 0xfc, 0x7f, 0xff, 0xc1,
-    0xff, 0xff, 0x0, 0x3f, 0x1f, 0xff, 0xfc, 0x7f,
-    0xff, 0xf0, 0x0, 0x7, 0xff, 0xff, 0x8f, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xf1, 0xff, 0xff,
-    0xe0, 0x1f, 0x8f, 0xff, 0xfe, 0x3f, 0xff, 0xf8,
-    0xff, 0xf8, 0xff, 0xff, 0x83, 0xff, 0xfe, 0x3f,
-    0xff, 0x8f, 0xff, 0xe0, 0x3f, 0xff, 0x8f, 0xff,
-    0xf8, 0xff, 0xfc, 0x7, 0xff, 0xe3, 0xff, 0xff,
-    0x8f, 0xff, 0x0, 0x7f, 0xf8, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xc7, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff,
-    0xc7, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7f, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xc7,
-    0xef, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x78,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80,
-
-    /* U+0037 "7" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x63, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x1e, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xf7, 0xe3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0x8f, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xe3, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xfe, 0x3f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x78,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x63, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x1e, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xf7, 0xe3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0x8f, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xe3, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xfe, 0x3f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x1f,
-    0xfe, 0x0, 0xff, 0xf1, 0xff, 0xff, 0xc7, 0xff,
-    0xe0, 0x3f, 0xff, 0x1f, 0xff, 0xf1, 0xff, 0xfc,
-    0x7, 0xff, 0xf1, 0xff, 0xfc, 0x7f, 0xff, 0xc1,
-    0xff, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0xfc, 0x7f,
-    0xff, 0xf1, 0xf8, 0x7, 0xff, 0xff, 0x8f, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xf1, 0xff, 0xff,
-    0xe0, 0x1f, 0x8f, 0xff, 0xfe, 0x3f, 0xff, 0xf8,
-    0xff, 0xf8, 0xff, 0xff, 0x83, 0xff, 0xfe, 0x3f,
-    0xff, 0x8f, 0xff, 0xe0, 0x3f, 0xff, 0x8f, 0xff,
-    0xf8, 0xff, 0xfc, 0x7, 0xff, 0xe3, 0xff, 0xff,
-    0x8f, 0xff, 0x0, 0x7f, 0xf8, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xc7, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff,
-    0xc7, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7f, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xc7,
-    0xef, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x78,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80,
-
-    /* U+0039 "9" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x63, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x1e, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xf7, 0xe3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0x8f, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xe3, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xfe, 0x3f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x1f,
-    0xfe, 0x0, 0xff, 0xf1, 0xff, 0xff, 0xc7, 0xff,
-    0xe0, 0x3f, 0xff, 0x1f, 0xff, 0xf1, 0xff, 0xfc,
-    0x7, 0xff, 0xf1, 0xff, 0xfc, 0x7f, 0xff, 0xc1,
-    0xff, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0xfc, 0x7f,
-    0xff, 0xf1, 0xf8, 0x7, 0xff, 0xff, 0x8f, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xf1, 0xff, 0xff,
-    0xe0, 0x0, 0xf, 0xff, 0xfe, 0x3f, 0xff, 0xf8,
-    0xfc, 0x0, 0xff, 0xff, 0x83, 0xff, 0xfe, 0x3f,
-    0x80, 0xf, 0xff, 0xe0, 0x3f, 0xff, 0x8f, 0xf0,
-    0x0, 0xff, 0xfc, 0x7, 0xff, 0xe3, 0xfe, 0x0,
-    0xf, 0xff, 0x0, 0x7f, 0xf8, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xc7, 0xfe, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xc0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xc7, 0xf8, 0x1, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7f, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xc7,
-    0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x78,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80,
-
-    /* U+003A ":" */
-    0x1f, 0x83, 0xfc, 0x7f, 0xe7, 0xfe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7f, 0xe7, 0xfe, 0x3f,
-    0xc0, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf8, 0x3f, 0xc7, 0xfe, 0x7f,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfe,
-    0x7f, 0xe3, 0xfc, 0xf, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7c, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8,
-
-    /* U+003D "=" */
-    0x0, 0xff, 0xf8, 0x7, 0xff, 0xc0, 0x0, 0x3f,
-    0xff, 0x0, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xf0,
-    0x3f, 0xff, 0xc0, 0x3, 0xff, 0xff, 0x7, 0xff,
-    0xfc, 0x0, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xc0,
-    0x3f, 0xff, 0xfe, 0x3f, 0xff, 0xfc, 0x7, 0xff,
-    0xff, 0xc7, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xf0,
-    0xff, 0xff, 0xe0, 0x7, 0xff, 0xfe, 0xf, 0xff,
-    0xf8, 0x0, 0x7f, 0xff, 0x81, 0xff, 0xfe, 0x0,
-    0x7, 0xff, 0xe0, 0x1f, 0xff, 0x80, 0x0, 0x7f,
-    0xfc, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0,
-
-    /* U+003E ">" */
-    0x0, 0x38, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7c,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xe0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8,
-
-    /* U+003F "?" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x8c, 0x78, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xef, 0xc7, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x3f, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xc7, 0xff, 0xf1, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0x1f, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x3f,
-    0xfe, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x3, 0xff,
-    0xf1, 0xff, 0xff, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x8f, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xff, 0xfc,
-    0x7f, 0xfc, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe3,
-    0xf0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x67, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf3, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x8c, 0x78, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xef, 0xc7, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x3f, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xc7, 0xff, 0xf1, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0x1f, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff,
-    0xe3, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x3f,
-    0xfe, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0x3, 0xff,
-    0xf1, 0xff, 0xff, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x8f, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xff, 0xfc,
-    0x7f, 0xfc, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe3,
-    0xf0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf0, 0xf,
-    0xc0, 0x0, 0x0, 0xf, 0xff, 0xfe, 0x3f, 0xfe,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xc7, 0xff, 0xf0,
-    0x0, 0x0, 0x67, 0xff, 0xf8, 0xff, 0xff, 0x80,
-    0x0, 0x6, 0x3f, 0xff, 0x1f, 0xff, 0xfc, 0x0,
-    0x0, 0xf3, 0xff, 0xe3, 0xff, 0xff, 0xe0, 0x0,
-    0x1f, 0x80, 0x0, 0x7f, 0xff, 0xff, 0x0, 0x1,
-    0xf8, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x3f,
-    0xc0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x3, 0xfc,
-    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x7f, 0xe0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0xf, 0xff, 0x0,
-    0xf, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xf0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0xf, 0xff, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0xff, 0xf0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0xf, 0xff, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0xff, 0xf0, 0x0, 0xff, 0xff,
-    0xff, 0x0, 0xf, 0xff, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0xff, 0xf0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0xf, 0xff, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0xff, 0xf0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0xf, 0xff, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0xff, 0xf0, 0x0, 0xff, 0xff, 0xff, 0x0, 0xf,
-    0xff, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0xff,
-    0xf0, 0x0, 0xff, 0xff, 0xff, 0x0, 0xf, 0xff,
-    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xf0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0xf, 0xff, 0x0,
-    0xf, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xf0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0xf, 0xff, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0xff, 0xf0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0xf, 0xff, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0xff, 0xf0, 0x0, 0xff, 0xff,
-    0xff, 0x0, 0xf, 0xff, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xf8, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xe3, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7f, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xe3, 0xf7, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x1e, 0x31, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-
-    /* U+0041 "A" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x63, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x1e, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xf7, 0xe3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0x8f, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xe3, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xfe, 0x3f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x1f,
-    0xfe, 0x0, 0xff, 0xf1, 0xff, 0xff, 0xc7, 0xff,
-    0xe0, 0x3f, 0xff, 0x1f, 0xff, 0xf1, 0xff, 0xfc,
-    0x7, 0xff, 0xf1, 0xff, 0xfc, 0x7f, 0xff, 0xc1,
-    0xff, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0xfc, 0x7f,
-    0xff, 0xf1, 0xf8, 0x7, 0xff, 0xff, 0x8f, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xf1, 0xff, 0xff,
-    0xe0, 0x1f, 0x8f, 0xff, 0xfe, 0x3f, 0xff, 0xf8,
-    0xff, 0xf8, 0xff, 0xff, 0x83, 0xff, 0xfe, 0x3f,
-    0xff, 0x8f, 0xff, 0xe0, 0x3f, 0xff, 0x8f, 0xff,
-    0xf8, 0xff, 0xfc, 0x7, 0xff, 0xe3, 0xff, 0xff,
-    0x8f, 0xff, 0x0, 0x7f, 0xf8, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x78,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0042 "B" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe3, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xfe, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0xfc, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0x8f, 0xf8, 0x7, 0xff, 0xff, 0xff,
-    0xfe, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xc0, 0x0, 0x7, 0xff, 0x80, 0x7, 0xff, 0x80,
-    0x0, 0xf, 0xff, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x3f,
-    0xfc, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x7f, 0xf8,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0xff, 0xf0, 0x0, 0x1, 0xff, 0xe0, 0x1, 0xff,
-    0xe0, 0x0, 0x3, 0xff, 0xc0, 0x3, 0xff, 0xc0,
-    0x0, 0x7, 0xff, 0x80, 0x7, 0xff, 0x80, 0x0,
-    0xf, 0xff, 0x0, 0xf, 0xff, 0x0, 0x0, 0x1f,
-    0xfe, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x3f, 0xfc,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x7f, 0xf8, 0x0, 0x0, 0xff, 0xf0, 0x0, 0xff,
-    0xf0, 0x0, 0x1, 0xff, 0xe0, 0x1, 0xff, 0xe0,
-    0x0, 0x3, 0xff, 0xc0, 0x3, 0xff, 0xc0, 0x0,
-    0x7, 0xff, 0x80, 0x7, 0xff, 0x80, 0x0, 0xf,
-    0xff, 0x0, 0xf, 0xff, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0xff, 0xf0, 0x0, 0xff, 0xf0,
-    0x0, 0x1, 0xff, 0xe0, 0x1, 0xff, 0xe0, 0x0,
-    0x1, 0xff, 0x80, 0x3, 0xff, 0xc0, 0x0, 0x1,
-    0xfe, 0x0, 0x7, 0xff, 0x80, 0x0, 0x3, 0xfc,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x1f,
-    0xfc, 0x0, 0x0, 0x7, 0x9f, 0xff, 0x1f, 0xf8,
-    0x0, 0x0, 0x6, 0x3f, 0xff, 0x1f, 0xf0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0x1f, 0xe0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x1f, 0xc0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0x1f, 0x80, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0xfc,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xe3, 0xf8, 0x0,
-    0x0, 0x6, 0x7f, 0xff, 0x8f, 0xf0, 0x0, 0x0,
-    0xc, 0x7f, 0xfe, 0x3f, 0xe0, 0x0, 0x0, 0x3c,
-    0xff, 0xf8, 0xff, 0xc0, 0x0, 0x0, 0xfc, 0x0,
-    0x3, 0xff, 0x80, 0x0, 0x1, 0xf8, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x7, 0xf8, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xf0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0xff, 0xf0, 0x0, 0x1, 0xff,
-    0xe0, 0x1, 0xff, 0xe0, 0x0, 0x3, 0xff, 0xc0,
-    0x3, 0xff, 0xc0, 0x0, 0x7, 0xff, 0x80, 0x7,
-    0xff, 0x80, 0x0, 0xf, 0xff, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x1f, 0xfe, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x3f, 0xfc, 0x0, 0x0,
-    0x7f, 0xf8, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0xff, 0xf0, 0x0, 0x1, 0xff, 0xe0,
-    0x1, 0xff, 0xe0, 0x0, 0x3, 0xff, 0xc0, 0x3,
-    0xff, 0xc0, 0x0, 0x7, 0xff, 0x80, 0x7, 0xff,
-    0x80, 0x0, 0xf, 0xff, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x1f, 0xfe, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0xff, 0xf0, 0x0, 0x1, 0xff, 0xe0, 0x1,
-    0xff, 0xe0, 0x0, 0x3, 0xff, 0xc0, 0x3, 0xff,
-    0xc0, 0x0, 0x7, 0xff, 0x80, 0x7, 0xff, 0x80,
-    0x0, 0xf, 0xff, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x3f,
-    0xfc, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf0, 0xf, 0xff, 0xff, 0xff, 0xfc, 0x7f,
-    0xe0, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xc0,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0x83, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x7f, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7e, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80,
-
-    /* U+0043 "C" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc6, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1e, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xfe,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xfe, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0x3, 0xfe, 0x3f, 0xff,
-    0xff, 0xff, 0xfc, 0x7, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xf0, 0xf, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xe0,
-    0x1f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0xfc, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0xf1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0xc7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc,
-
-    /* U+0044 "D" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe3, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xfe, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0xfc, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0x8f, 0xf8, 0x7, 0xff, 0xff, 0xff,
-    0xfe, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xc0, 0x0, 0x7, 0xff, 0x80, 0x7, 0xff, 0x80,
-    0x0, 0xf, 0xff, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x3f,
-    0xfc, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x7f, 0xf8,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0xff, 0xf0, 0x0, 0x1, 0xff, 0xe0, 0x1, 0xff,
-    0xe0, 0x0, 0x3, 0xff, 0xc0, 0x3, 0xff, 0xc0,
-    0x0, 0x7, 0xff, 0x80, 0x7, 0xff, 0x80, 0x0,
-    0xf, 0xff, 0x0, 0xf, 0xff, 0x0, 0x0, 0x1f,
-    0xfe, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x3f, 0xfc,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x7f, 0xf8, 0x0, 0x0, 0xff, 0xf0, 0x0, 0xff,
-    0xf0, 0x0, 0x1, 0xff, 0xe0, 0x1, 0xff, 0xe0,
-    0x0, 0x3, 0xff, 0xc0, 0x3, 0xff, 0xc0, 0x0,
-    0x7, 0xff, 0x80, 0x7, 0xff, 0x80, 0x0, 0xf,
-    0xff, 0x0, 0xf, 0xff, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0xff, 0xf0, 0x0, 0xff, 0xf0,
-    0x0, 0x1, 0xff, 0xe0, 0x1, 0xff, 0xe0, 0x0,
-    0x1, 0xff, 0x80, 0x3, 0xff, 0xc0, 0x0, 0x1,
-    0xfe, 0x0, 0x7, 0xff, 0x80, 0x0, 0x3, 0xfc,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x1f,
-    0xfc, 0x0, 0x0, 0x7, 0x80, 0x0, 0x1f, 0xf8,
-    0x0, 0x0, 0x6, 0x0, 0x0, 0x1f, 0xf0, 0x0,
-    0x0, 0xc, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0,
-    0x10, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0,
-    0x0, 0x6, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0,
-    0xc, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0xfc, 0x0,
-    0x3, 0xff, 0x80, 0x0, 0x1, 0xf8, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x7, 0xf8, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xf0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0xff, 0xf0, 0x0, 0x1, 0xff,
-    0xe0, 0x1, 0xff, 0xe0, 0x0, 0x3, 0xff, 0xc0,
-    0x3, 0xff, 0xc0, 0x0, 0x7, 0xff, 0x80, 0x7,
-    0xff, 0x80, 0x0, 0xf, 0xff, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x1f, 0xfe, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x3f, 0xfc, 0x0, 0x0,
-    0x7f, 0xf8, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0xff, 0xf0, 0x0, 0x1, 0xff, 0xe0,
-    0x1, 0xff, 0xe0, 0x0, 0x3, 0xff, 0xc0, 0x3,
-    0xff, 0xc0, 0x0, 0x7, 0xff, 0x80, 0x7, 0xff,
-    0x80, 0x0, 0xf, 0xff, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x1f, 0xfe, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0xff, 0xf0, 0x0, 0x1, 0xff, 0xe0, 0x1,
-    0xff, 0xe0, 0x0, 0x3, 0xff, 0xc0, 0x3, 0xff,
-    0xc0, 0x0, 0x7, 0xff, 0x80, 0x7, 0xff, 0x80,
-    0x0, 0xf, 0xff, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x3f,
-    0xfc, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf0, 0xf, 0xff, 0xff, 0xff, 0xfc, 0x7f,
-    0xe0, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xc0,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0x83, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x7f, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7e, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80,
-
-    /* U+0045 "E" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc6, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1e, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xfe,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xfe, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0x3, 0xfe, 0x3f, 0xff,
-    0xff, 0xff, 0xfc, 0x7, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xf0, 0xf, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x1f, 0xfe, 0x0, 0xff, 0xf0, 0x7,
-    0xfc, 0x7f, 0xfe, 0x1, 0xff, 0xf0, 0xf, 0xf1,
-    0xff, 0xfe, 0x7, 0xff, 0xf0, 0x1f, 0xc7, 0xff,
-    0xfc, 0x1f, 0xff, 0xf0, 0x3f, 0x1f, 0xff, 0xfc,
-    0x3f, 0xff, 0xf0, 0x0, 0x7f, 0xff, 0xf8, 0xff,
-    0xff, 0xf0, 0x0, 0xff, 0xff, 0xf1, 0xff, 0xff,
-    0xf1, 0xf8, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xc3,
-    0xf8, 0xff, 0xff, 0x83, 0xff, 0xff, 0x7, 0xf8,
-    0xff, 0xff, 0x3, 0xff, 0xfc, 0xf, 0xf8, 0xff,
-    0xfc, 0x7, 0xff, 0xf0, 0x1f, 0xf8, 0xff, 0xf0,
-    0x7, 0xff, 0xc0, 0x3f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xe0,
-    0x1f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0xfc, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0xf1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0xc7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc,
-
-    /* U+0046 "F" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc6, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1e, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xfe,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xfe, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0x3, 0xfe, 0x3f, 0xff,
-    0xff, 0xff, 0xfc, 0x7, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xf0, 0xf, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x1f, 0xfe, 0x0, 0xff, 0xf0, 0x7,
-    0xfc, 0x7f, 0xfe, 0x1, 0xff, 0xf0, 0xf, 0xf1,
-    0xff, 0xfe, 0x7, 0xff, 0xf0, 0x1f, 0xc7, 0xff,
-    0xfc, 0x1f, 0xff, 0xf0, 0x3f, 0x1f, 0xff, 0xfc,
-    0x3f, 0xff, 0xf0, 0x0, 0x7f, 0xff, 0xf8, 0xff,
-    0xff, 0xf0, 0x0, 0xff, 0xff, 0xf1, 0xff, 0xff,
-    0xf1, 0xf8, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xc3,
-    0xf8, 0xff, 0xff, 0x83, 0xff, 0xff, 0x7, 0xf8,
-    0xff, 0xff, 0x3, 0xff, 0xfc, 0xf, 0xf8, 0xff,
-    0xfc, 0x7, 0xff, 0xf0, 0x1f, 0xf8, 0xff, 0xf0,
-    0x7, 0xff, 0xc0, 0x3f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0047 "G" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x63, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x1e, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x7, 0xe3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x1f, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x3, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x7f, 0xe3, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xf0, 0x0, 0x7f, 0xc0, 0x0,
-    0x0, 0x3f, 0xff, 0x0, 0xf, 0xf0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x1, 0xfc, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xe0, 0x1f, 0x80, 0x0, 0x0, 0x3f, 0xff, 0xf8,
-    0xff, 0xf8, 0x0, 0x0, 0x3, 0xff, 0xfe, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x3f, 0xff, 0x8f, 0xff,
-    0xf8, 0x0, 0x0, 0x7, 0xff, 0xe3, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x7f, 0xf8, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xc7, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff,
-    0xc7, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7f, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xc7,
-    0xef, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x78,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80,
-
-    /* U+0048 "H" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x7e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xf1, 0xff, 0xe0, 0xf, 0xff, 0x1f, 0xff,
-    0xfc, 0x7f, 0xfe, 0x3, 0xff, 0xf1, 0xff, 0xff,
-    0x1f, 0xff, 0xc0, 0x7f, 0xff, 0x1f, 0xff, 0xc7,
-    0xff, 0xfc, 0x1f, 0xff, 0xf1, 0xff, 0xf1, 0xff,
-    0xff, 0xc7, 0xff, 0xff, 0x1f, 0x80, 0x7f, 0xff,
-    0xf8, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff,
-    0x1f, 0xff, 0xfe, 0x1, 0xf8, 0xff, 0xff, 0xe3,
-    0xff, 0xff, 0x8f, 0xff, 0x8f, 0xff, 0xf8, 0x3f,
-    0xff, 0xe3, 0xff, 0xf8, 0xff, 0xfe, 0x3, 0xff,
-    0xf8, 0xff, 0xff, 0x8f, 0xff, 0xc0, 0x7f, 0xfe,
-    0x3f, 0xff, 0xf8, 0xff, 0xf0, 0x7, 0xff, 0x8f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0x8c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0049 "I" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-
-    /* U+004A "J" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xf1, 0xff,
-    0xff, 0xff, 0xff, 0xc7, 0xff, 0xfc, 0x7f, 0xff,
-    0xff, 0xff, 0xfc, 0x7f, 0xff, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xc7, 0xff, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x7e, 0xf1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc7, 0x8c, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x60, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-
-    /* U+004B "K" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xc0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0xf, 0xef, 0xff, 0x0, 0x0,
-    0x0, 0x3f, 0xbf, 0xfc, 0x0, 0x0, 0x0, 0xfc,
-    0xff, 0xf0, 0x0, 0x0, 0x3, 0xf3, 0xff, 0xc0,
-    0x0, 0x0, 0xf, 0x8f, 0xff, 0x0, 0x0, 0x0,
-    0x3e, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0xf0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xf, 0xfc, 0x7f, 0xfc, 0x0, 0x0,
-    0x3f, 0xe3, 0xff, 0xf0, 0x0, 0x0, 0xff, 0x1f,
-    0xff, 0xe0, 0x0, 0x3, 0xf8, 0xff, 0xff, 0x80,
-    0x0, 0xf, 0xc7, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xf8, 0x0, 0x3, 0xf1, 0xff, 0xff, 0xc0, 0x0,
-    0xf, 0xe3, 0xff, 0xfe, 0x0, 0x0, 0x3f, 0xc7,
-    0xff, 0xf8, 0x0, 0x0, 0xff, 0x8f, 0xff, 0xc0,
-    0x0, 0x3, 0xff, 0x1f, 0xff, 0x0, 0x0, 0xf,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x3,
-    0xc3, 0xff, 0xc0, 0x0, 0x0, 0xf, 0xf, 0xff,
-    0x0, 0x0, 0x0, 0x3e, 0x3f, 0xfc, 0x0, 0x0,
-    0x0, 0xfc, 0xff, 0xf0, 0x0, 0x0, 0x3, 0xf3,
-    0xff, 0xc0, 0x0, 0x0, 0xf, 0xef, 0xff, 0x0,
-    0x0, 0x0, 0x3f, 0xbf, 0xfc, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+004C "L" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xc7,
-    0xff, 0xff, 0xff, 0xfe, 0x1, 0xff, 0x1f, 0xff,
-    0xff, 0xff, 0xfe, 0x3, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xfe, 0x7, 0xf1, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xf, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xf, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0,
-
-    /* U+004D "M" */
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7b, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x3,
-    0xbf, 0xff, 0xff, 0xcf, 0x0, 0x0, 0x0, 0xf7,
-    0xff, 0xff, 0xf9, 0xe0, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0xff, 0x3e, 0x0, 0x0, 0x7, 0xdf, 0xff,
-    0xff, 0xe7, 0xc0, 0x0, 0x0, 0xfb, 0xff, 0xff,
-    0xfc, 0xfc, 0x0, 0x0, 0x3f, 0x7f, 0xff, 0xff,
-    0x9f, 0x80, 0x0, 0x7, 0xef, 0xff, 0xff, 0xf3,
-    0xf8, 0x0, 0x1, 0xfd, 0xff, 0xff, 0xfe, 0x7f,
-    0x80, 0x0, 0x7f, 0xbf, 0xff, 0xff, 0xcf, 0xf0,
-    0x0, 0xf, 0xf7, 0xff, 0xff, 0xf9, 0xfe, 0x0,
-    0x1, 0xfe, 0xff, 0xff, 0xff, 0x3f, 0xc0, 0x0,
-    0x3f, 0xdf, 0xff, 0xff, 0xe7, 0xf8, 0x0, 0x7,
-    0xfb, 0xff, 0xff, 0xfc, 0xff, 0x0, 0x0, 0xff,
-    0x7f, 0xff, 0xff, 0x9f, 0xe0, 0x0, 0x1f, 0xef,
-    0xff, 0xff, 0xf3, 0xfc, 0x0, 0x3, 0xfd, 0xff,
-    0xff, 0xfe, 0x7f, 0x80, 0x0, 0x7f, 0xbf, 0xff,
-    0xff, 0xcf, 0xf0, 0x0, 0xf, 0xf7, 0xff, 0xff,
-    0xf9, 0xfe, 0x0, 0x1, 0xfe, 0xff, 0xff, 0xff,
-    0x3f, 0xc0, 0x0, 0x3f, 0xdf, 0xff, 0xff, 0xe3,
-    0xf8, 0x0, 0x7, 0xf3, 0xff, 0xff, 0xfc, 0x7f,
-    0x0, 0x0, 0xfe, 0x7f, 0xff, 0xff, 0x87, 0xe0,
-    0x0, 0x1f, 0x8f, 0xff, 0xff, 0xf0, 0xfc, 0x0,
-    0x3, 0xf1, 0xff, 0xff, 0xfe, 0xf, 0x80, 0x0,
-    0x7c, 0x3f, 0xff, 0xff, 0xc0, 0xf0, 0x0, 0xf,
-    0x7, 0xff, 0xff, 0xf8, 0x1e, 0x0, 0x1, 0xe0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x1, 0x0,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x30, 0x0,
-    0x0, 0xff, 0xff, 0x80, 0x0, 0xf, 0x0, 0x0,
-    0x3f, 0xff, 0xf8, 0x0, 0x1, 0xe0, 0x0, 0xf,
-    0xff, 0xff, 0x80, 0x0, 0x7e, 0x0, 0x3, 0xff,
-    0xff, 0xf8, 0x0, 0xf, 0xc0, 0x0, 0xff, 0xff,
-    0xff, 0x0, 0x3, 0xfc, 0x0, 0x1f, 0xff, 0xff,
-    0xe0, 0x0, 0xff, 0xc0, 0x3, 0xff, 0xff, 0xfc,
-    0x0, 0x1f, 0xf8, 0x0, 0x7f, 0xff, 0xff, 0x80,
-    0x7, 0xff, 0x80, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0xff, 0xf0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x1f,
-    0xfe, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x3, 0xff,
-    0xc0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x7f, 0xf8,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0xf, 0xff, 0x0,
-    0x1f, 0xff, 0xff, 0xe0, 0x1, 0xff, 0xe0, 0x3,
-    0xff, 0xff, 0xfc, 0x0, 0x3f, 0xfc, 0x0, 0x7f,
-    0xff, 0xff, 0x80, 0x7, 0xff, 0x80, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0xff, 0xf0, 0x1, 0xff, 0xff,
-    0xfe, 0x0, 0x1f, 0xfe, 0x0, 0x3f, 0xff, 0xff,
-    0xc0, 0x3, 0xff, 0xc0, 0x7, 0xff, 0xff, 0xf8,
-    0x0, 0x7f, 0xf8, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0xf, 0xff, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x1,
-    0xff, 0xe0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x3f,
-    0xfc, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x7, 0xff,
-    0x80, 0xf, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xf0,
-    0x1, 0xff, 0xff, 0xfe, 0x0, 0x1f, 0xfe, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xc0, 0x7,
-    0xff, 0xff, 0xf8, 0x0, 0x7f, 0xf8, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0xf, 0xff, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x1, 0xff, 0xe0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0x8c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+004E "N" */
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7b, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xcf, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf9, 0xe0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x3e, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe7, 0xc0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0xfc, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x9f, 0x80, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf3,
-    0xf8, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x7f,
-    0x80, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xcf, 0xf0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf9, 0xfe, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x3f, 0xc0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xe7, 0xf8, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0xff, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x9f, 0xe0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf3, 0xfc, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0x7f, 0x80, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xcf, 0xf0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf9, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x3f, 0xc0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe3,
-    0xf8, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x7f,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x87, 0xe0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0xfc, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfe, 0xf, 0x80, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0xf0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x1e, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x1, 0xe0, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x3c, 0x1f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x7, 0xc3, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0xf8, 0x7f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x1f, 0x8f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x3, 0xf1, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x7f, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xf, 0xf7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x1,
-    0xfe, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3f,
-    0xdf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xfb,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xff, 0x7f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x1f, 0xef, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x3, 0xfd, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x7f, 0xbf, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0xf, 0xf7, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x1, 0xfe, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x3f, 0xdf, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x7, 0xfb, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x7f, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0xf, 0xef, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0xfd, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1f,
-    0xbf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x1, 0xf7,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0x8c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+004F "O" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x63, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x1e, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xf7, 0xe3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0x8f, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xe3, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xfe, 0x3f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xc7, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff,
-    0xc7, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7f, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xc7,
-    0xef, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x78,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80,
-
-    /* U+0050 "P" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x63, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x1e, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xf7, 0xe3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0x8f, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xe3, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xfe, 0x3f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x1f,
-    0xfe, 0x0, 0xff, 0xf1, 0xff, 0xff, 0xc7, 0xff,
-    0xe0, 0x3f, 0xff, 0x1f, 0xff, 0xf1, 0xff, 0xfc,
-    0x7, 0xff, 0xf1, 0xff, 0xfc, 0x7f, 0xff, 0xc1,
-    0xff, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0xfc, 0x7f,
-    0xff, 0xf1, 0xf8, 0x7, 0xff, 0xff, 0x8f, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xf1, 0xff, 0xff,
-    0xe0, 0x1f, 0x8f, 0xff, 0xfe, 0x3f, 0xff, 0xf8,
-    0x3, 0xf8, 0xff, 0xff, 0x83, 0xff, 0xfe, 0x0,
-    0x7f, 0x8f, 0xff, 0xe0, 0x3f, 0xff, 0x80, 0xf,
-    0xf8, 0xff, 0xfc, 0x7, 0xff, 0xe0, 0x1, 0xff,
-    0x8f, 0xff, 0x0, 0x7f, 0xf8, 0x0, 0x3f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x63, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x1e, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xf7, 0xe3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xcf, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0x3f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x3, 0xc1, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x7c, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xf, 0x87, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x1,
-    0xf8, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3f,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xf3,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xfe, 0x7f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x1f, 0xef, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x3, 0xfd, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x7f, 0xbf, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0xf, 0xf7, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x1, 0xfe, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x3f, 0xdf, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x7, 0xfb, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0xff, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x1f, 0xef, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3,
-    0xfd, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x7f,
-    0xbf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x7, 0xf7,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xfe, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0xf, 0xdf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x1, 0xfb, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x1f, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x3, 0xbf, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xe7, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
-    0xfe, 0x7f, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff,
-    0xe7, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x7f, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xc7,
-    0xef, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x78,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80,
-
-    /* U+0052 "R" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x63, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x1e, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xf7, 0xe3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xcf, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0x3f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x1f,
-    0xff, 0x0, 0xff, 0xf9, 0xff, 0xff, 0xc7, 0xff,
-    0xe0, 0x1f, 0xff, 0x9f, 0xff, 0xf1, 0xff, 0xfe,
-    0x7, 0xff, 0xf1, 0xff, 0xfc, 0x7f, 0xff, 0xc0,
-    0xff, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0xfc, 0x3f,
-    0xff, 0xf1, 0xf8, 0x7, 0xff, 0xff, 0xcf, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xf9, 0xff, 0xff,
-    0xe0, 0x1f, 0x8f, 0xff, 0xfe, 0x1f, 0xff, 0xf8,
-    0x3, 0xf8, 0xff, 0xff, 0x81, 0xff, 0xfe, 0x0,
-    0x7f, 0x8f, 0xff, 0xf0, 0x3f, 0xff, 0xc0, 0xf,
-    0xf8, 0xff, 0xfc, 0x3, 0xff, 0xf0, 0x1, 0xff,
-    0x8f, 0xff, 0x80, 0x7f, 0xfc, 0x0, 0x3f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x1f, 0xfe, 0x0, 0x0,
-    0x0, 0x78, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0xf, 0x80, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x1,
-    0xf8, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x3f,
-    0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xf0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x0, 0x1f, 0xe0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x1f,
-    0xfe, 0x0, 0x0, 0x0, 0x7f, 0x80, 0x3, 0xff,
-    0xc0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x7f, 0xf8,
-    0x0, 0x0, 0x1, 0xfe, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0x1, 0xff, 0xe0, 0x0,
-    0x0, 0x7, 0xf8, 0x0, 0x3f, 0xfc, 0x0, 0x0,
-    0x0, 0xff, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0,
-    0x1f, 0xe0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x3,
-    0xfc, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x7f,
-    0x80, 0x3, 0xff, 0xc0, 0x0, 0x0, 0xf, 0xf0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0xf, 0xc0, 0x1,
-    0xff, 0xe0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x3f,
-    0xfc, 0x0, 0x0, 0x0, 0x1f, 0x0, 0x7, 0xff,
-    0x80, 0x0, 0x0, 0x3, 0xe0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x3c, 0x0, 0x1f, 0xfe, 0x0,
-    0x0, 0x0, 0x7, 0x80, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x70, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0053 "S" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x63, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x1e, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x7, 0xe3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x1f, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x3, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x7f, 0xe3, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0xf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfc, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x9e, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf3,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x7c,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xcf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf9, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x3f, 0x80, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xe7, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfc, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x9f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf3, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfe, 0x7f, 0x80, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xcf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf9, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe7,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x9f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf3, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x3f, 0x80, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xc7, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf8, 0x7e, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xe0, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0xf, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x81, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x1f,
-    0xff, 0x0, 0xff, 0xf8, 0x0, 0x7f, 0xc7, 0xff,
-    0xe0, 0x1f, 0xff, 0x80, 0xf, 0xf1, 0xff, 0xfe,
-    0x7, 0xff, 0xf0, 0x1, 0xfc, 0x7f, 0xff, 0xc0,
-    0xff, 0xff, 0x0, 0x3f, 0x1f, 0xff, 0xfc, 0x3f,
-    0xff, 0xf0, 0x0, 0x7, 0xff, 0xff, 0xcf, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xf9, 0xff, 0xff,
-    0xe0, 0x0, 0xf, 0xff, 0xfe, 0x1f, 0xff, 0xf8,
-    0xfc, 0x0, 0xff, 0xff, 0x81, 0xff, 0xfe, 0x3f,
-    0x80, 0xf, 0xff, 0xf0, 0x3f, 0xff, 0xcf, 0xf0,
-    0x0, 0xff, 0xfc, 0x3, 0xff, 0xf3, 0xfe, 0x0,
-    0xf, 0xff, 0x80, 0x7f, 0xfc, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xc1, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x78, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x87, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1,
-    0xf8, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf3,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xef, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfd, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xbf, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf7, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x1, 0xfe, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xdf, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfb, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xef, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfd, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xbf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf7,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xfe, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xdf, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3d, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xbf, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xe7, 0xfe, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xfe, 0x7f, 0xc0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xe7, 0xf8, 0x1, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x7f, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xc7,
-    0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x78,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80,
-
-    /* U+0054 "T" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x0,
-
-    /* U+0055 "U" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x7e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xf1, 0xff,
-    0xff, 0xff, 0xff, 0xc7, 0xff, 0xfc, 0x7f, 0xff,
-    0xff, 0xff, 0xfc, 0x7f, 0xff, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xc7, 0xff, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x7e, 0xf1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc7, 0x8c, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x60, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-
-    /* U+0056 "V" */
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x1, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x80, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0xf, 0xef, 0xff, 0x0, 0x0,
-    0x0, 0x3f, 0xbf, 0xfc, 0x0, 0x0, 0x0, 0xfc,
-    0xff, 0xf0, 0x0, 0x0, 0x3, 0xf3, 0xff, 0xc0,
-    0x0, 0x0, 0xf, 0x8f, 0xff, 0x0, 0x0, 0x0,
-    0x3c, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0xf0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0xf,
-    0x0, 0x0, 0x0, 0xff, 0xf0, 0x3c, 0x0, 0x0,
-    0x3, 0xff, 0xc1, 0xf0, 0x0, 0x0, 0xf, 0xff,
-    0x7, 0xc0, 0x0, 0x0, 0x3f, 0xfc, 0x3f, 0x0,
-    0x0, 0x0, 0xff, 0xf0, 0xfc, 0x0, 0x0, 0x3,
-    0xff, 0xc7, 0xf0, 0x0, 0x0, 0xf, 0xff, 0x3f,
-    0xc0, 0x0, 0x0, 0x3f, 0xfc, 0xff, 0x0, 0x0,
-    0x0, 0xff, 0xf3, 0xfc, 0x0, 0x0, 0x3, 0xff,
-    0xcf, 0xf0, 0x0, 0x0, 0xf, 0xff, 0x3f, 0xc0,
-    0x0, 0x0, 0x3f, 0xfc, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0xf3, 0xfc, 0x0, 0x0, 0x3, 0xff, 0xcf,
-    0xf0, 0x0, 0x0, 0xf, 0xff, 0x3f, 0xc0, 0x0,
-    0x0, 0x3f, 0xfc, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xf3, 0xfc, 0x0, 0x0, 0x3, 0xff, 0xcf, 0xf0,
-    0x0, 0x0, 0xf, 0xff, 0x3f, 0x80, 0x0, 0x0,
-    0x3f, 0xfc, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xf3,
-    0xf0, 0x0, 0x0, 0x3, 0xff, 0xcf, 0xc0, 0x0,
-    0x0, 0xf, 0xff, 0x3e, 0x0, 0x0, 0x0, 0x3f,
-    0xfc, 0xf0, 0x0, 0x0, 0x0, 0xff, 0xf3, 0xc0,
-    0x0, 0x0, 0x3, 0xff, 0xce, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0057 "W" */
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7b, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfe, 0x0, 0x1f, 0xfe, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xc0, 0x7,
-    0xff, 0xff, 0xf8, 0x0, 0x7f, 0xf8, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0xf, 0xff, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x1, 0xff, 0xe0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x3f, 0xfc, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x7, 0xff, 0x80, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0xff, 0xf0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x1f, 0xfe, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x3,
-    0xff, 0xc0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x7f,
-    0xf8, 0x0, 0xff, 0xff, 0xff, 0x0, 0xf, 0xff,
-    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x1, 0xff, 0xe0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0x3f, 0xfc, 0x0,
-    0x7f, 0xff, 0xff, 0x80, 0x7, 0xff, 0x80, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0xff, 0xf0, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x1f, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0xc0, 0x3, 0xff, 0xc0, 0x7, 0xff, 0xff,
-    0xf8, 0x0, 0x7f, 0xf8, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0xf, 0xff, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0x1, 0xff, 0xe0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0x3f, 0xfc, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x7,
-    0xff, 0x80, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xe0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xfc,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0xff, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x0, 0x1f, 0xe0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x1, 0xf8, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x3f, 0x0, 0x1, 0xff,
-    0xff, 0xf0, 0x0, 0x3, 0xc0, 0x0, 0x1f, 0xff,
-    0xfc, 0x0, 0x0, 0x30, 0x0, 0x1, 0xff, 0xff,
-    0x0, 0x0, 0x6, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf8, 0x1e, 0x0, 0x1, 0xe0, 0xff, 0xff,
-    0xff, 0x3, 0xc0, 0x0, 0x3c, 0x1f, 0xff, 0xff,
-    0xe0, 0xf8, 0x0, 0x7, 0xc3, 0xff, 0xff, 0xfc,
-    0x1f, 0x0, 0x0, 0xf8, 0x7f, 0xff, 0xff, 0x87,
-    0xe0, 0x0, 0x1f, 0x8f, 0xff, 0xff, 0xf0, 0xfc,
-    0x0, 0x3, 0xf1, 0xff, 0xff, 0xfe, 0x3f, 0x80,
-    0x0, 0x7f, 0x3f, 0xff, 0xff, 0xcf, 0xf0, 0x0,
-    0xf, 0xf7, 0xff, 0xff, 0xf9, 0xfe, 0x0, 0x1,
-    0xfe, 0xff, 0xff, 0xff, 0x3f, 0xc0, 0x0, 0x3f,
-    0xdf, 0xff, 0xff, 0xe7, 0xf8, 0x0, 0x7, 0xfb,
-    0xff, 0xff, 0xfc, 0xff, 0x0, 0x0, 0xff, 0x7f,
-    0xff, 0xff, 0x9f, 0xe0, 0x0, 0x1f, 0xef, 0xff,
-    0xff, 0xf3, 0xfc, 0x0, 0x3, 0xfd, 0xff, 0xff,
-    0xfe, 0x7f, 0x80, 0x0, 0x7f, 0xbf, 0xff, 0xff,
-    0xcf, 0xf0, 0x0, 0xf, 0xf7, 0xff, 0xff, 0xf9,
-    0xfe, 0x0, 0x1, 0xfe, 0xff, 0xff, 0xff, 0x3f,
-    0xc0, 0x0, 0x3f, 0xdf, 0xff, 0xff, 0xe7, 0xf8,
-    0x0, 0x7, 0xfb, 0xff, 0xff, 0xfc, 0xfe, 0x0,
-    0x0, 0x7f, 0x7f, 0xff, 0xff, 0x9f, 0xc0, 0x0,
-    0xf, 0xef, 0xff, 0xff, 0xf3, 0xf0, 0x0, 0x0,
-    0xfd, 0xff, 0xff, 0xfe, 0x7e, 0x0, 0x0, 0x1f,
-    0xbf, 0xff, 0xff, 0xcf, 0x80, 0x0, 0x1, 0xf7,
-    0xff, 0xff, 0xf9, 0xe0, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0xff, 0x3c, 0x0, 0x0, 0x3, 0xdf, 0xff,
-    0xff, 0xe7, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0x8c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0058 "X" */
-    0xe0, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0xf,
-    0xf0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x1f,
-    0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f,
-    0xfe, 0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0x7f, 0x0, 0x0, 0xfe,
-    0x7f, 0x0, 0x0, 0xfe, 0x3f, 0x0, 0x0, 0xfc,
-    0x3f, 0x0, 0x0, 0xfc, 0x1f, 0x0, 0x0, 0xf8,
-    0x1f, 0x0, 0x0, 0xf8, 0xf, 0x0, 0x0, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x0, 0x0, 0xf0, 0x1f, 0x0, 0x0, 0xf8,
-    0x1f, 0x0, 0x0, 0xf8, 0x3f, 0x0, 0x0, 0xfc,
-    0x3f, 0x0, 0x0, 0xfc, 0x7f, 0x0, 0x0, 0xfe,
-    0x7f, 0x0, 0x0, 0xfe, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0, 0x7f,
-    0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f,
-    0xf8, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0xf,
-    0xf0, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x7,
-
-    /* U+0059 "Y" */
-    0xe0, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0xf,
-    0xf0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x1f,
-    0xf8, 0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x3f,
-    0xfc, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0x7f, 0x0, 0x0, 0xfe, 0x7f, 0x0, 0x0, 0xfe,
-    0x3f, 0x0, 0x0, 0xfc, 0x3f, 0x0, 0x0, 0xfc,
-    0x1f, 0x0, 0x0, 0xf8, 0xf, 0x0, 0x0, 0xf0,
-    0xf, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
-    0x0, 0x1, 0x80, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x7, 0xe0, 0x0,
-    0x0, 0x7, 0xe0, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0xf, 0xf0, 0x0, 0x0, 0x1f, 0xf8, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xfc, 0x0,
-
-    /* U+005A "Z" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-
-    /* U+005C "\\" */
-    0xe0, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x0,
-    0xf0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0,
-    0xf8, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0,
-    0xfc, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-    0x7f, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x3f, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0,
-    0x1f, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0,
-    0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0xf0,
-    0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0xf8,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0xfc,
-    0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x7f,
-    0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x3f,
-    0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x1f,
-    0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x0, 0xf,
-    0x0, 0x0, 0x0, 0x7,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x0, 0xc0, 0x0, 0x7, 0x80, 0x0,
-    0x3f, 0x0, 0x0, 0xfe, 0x0, 0x3, 0xfc, 0x0,
-    0xf, 0xf8, 0x0, 0x3f, 0xf0, 0x0, 0xff, 0xe0,
-    0x3, 0xff, 0xc0, 0xf, 0xff, 0x38, 0x3f, 0xfc,
-    0xf0, 0xff, 0xf3, 0xc3, 0xff, 0xcf, 0x8f, 0xff,
-    0x3f, 0x3f, 0xfc, 0xfc, 0xff, 0xf3, 0xfb, 0xff,
-    0xcf, 0xef, 0xff, 0x3f, 0xff, 0xfc, 0xff, 0xff,
-    0xf3, 0xff, 0xff, 0xcf, 0xff, 0xff, 0x3f, 0xff,
-    0xfc, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xcf, 0xff,
-    0xff, 0x3f, 0xff, 0xfc, 0xff, 0xff, 0xf3, 0xff,
-    0xff, 0xc7, 0xff, 0xff, 0x1f, 0xff, 0xfc, 0x3f,
-    0xff, 0xf0, 0xff, 0xff, 0xc1, 0xff, 0xff, 0x3,
-    0xff, 0xfc, 0xf, 0xff, 0xf0, 0x3, 0xff, 0x80,
-    0xf, 0xfc, 0x0, 0x3f, 0xe0, 0x0, 0xff, 0x0,
-    0x3, 0xf8, 0x0, 0xf, 0xc0, 0x0, 0x0,
-
-    /* U+005F "_" */
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80,
-
-    /* U+0060 "`" */
-    0xe0, 0xf0, 0xf0, 0xf8, 0xf8, 0xfc, 0xfc, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0x3f, 0x3f,
-    0x1f, 0xf, 0xf,
-
-    /* U+0061 "a" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x63, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x1e, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xf7, 0xe3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0x8f, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xe3, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xfe, 0x3f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x1f,
-    0xfe, 0x0, 0xff, 0xf1, 0xff, 0xff, 0xc7, 0xff,
-    0xe0, 0x3f, 0xff, 0x1f, 0xff, 0xf1, 0xff, 0xfc,
-    0x7, 0xff, 0xf1, 0xff, 0xfc, 0x7f, 0xff, 0xc1,
-    0xff, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0xfc, 0x7f,
-    0xff, 0xf1, 0xf8, 0x7, 0xff, 0xff, 0x8f, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xf1, 0xff, 0xff,
-    0xe0, 0x1f, 0x8f, 0xff, 0xfe, 0x3f, 0xff, 0xf8,
-    0xff, 0xf8, 0xff, 0xff, 0x83, 0xff, 0xfe, 0x3f,
-    0xff, 0x8f, 0xff, 0xe0, 0x3f, 0xff, 0x8f, 0xff,
-    0xf8, 0xff, 0xfc, 0x7, 0xff, 0xe3, 0xff, 0xff,
-    0x8f, 0xff, 0x0, 0x7f, 0xf8, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x78,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0062 "b" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe3, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xfe, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0xfc, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0x8f, 0xf8, 0x7, 0xff, 0xff, 0xff,
-    0xfe, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xc0, 0x0, 0x7, 0xff, 0x80, 0x7, 0xff, 0x80,
-    0x0, 0xf, 0xff, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x3f,
-    0xfc, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x7f, 0xf8,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0xff, 0xf0, 0x0, 0x1, 0xff, 0xe0, 0x1, 0xff,
-    0xe0, 0x0, 0x3, 0xff, 0xc0, 0x3, 0xff, 0xc0,
-    0x0, 0x7, 0xff, 0x80, 0x7, 0xff, 0x80, 0x0,
-    0xf, 0xff, 0x0, 0xf, 0xff, 0x0, 0x0, 0x1f,
-    0xfe, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x3f, 0xfc,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x7f, 0xf8, 0x0, 0x0, 0xff, 0xf0, 0x0, 0xff,
-    0xf0, 0x0, 0x1, 0xff, 0xe0, 0x1, 0xff, 0xe0,
-    0x0, 0x3, 0xff, 0xc0, 0x3, 0xff, 0xc0, 0x0,
-    0x7, 0xff, 0x80, 0x7, 0xff, 0x80, 0x0, 0xf,
-    0xff, 0x0, 0xf, 0xff, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0xff, 0xf0, 0x0, 0xff, 0xf0,
-    0x0, 0x1, 0xff, 0xe0, 0x1, 0xff, 0xe0, 0x0,
-    0x1, 0xff, 0x80, 0x3, 0xff, 0xc0, 0x0, 0x1,
-    0xfe, 0x0, 0x7, 0xff, 0x80, 0x0, 0x3, 0xfc,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x1f,
-    0xfc, 0x0, 0x0, 0x7, 0x9f, 0xff, 0x1f, 0xf8,
-    0x0, 0x0, 0x6, 0x3f, 0xff, 0x1f, 0xf0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0x1f, 0xe0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x1f, 0xc0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0x1f, 0x80, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf8, 0xfc,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xe3, 0xf8, 0x0,
-    0x0, 0x6, 0x7f, 0xff, 0x8f, 0xf0, 0x0, 0x0,
-    0xc, 0x7f, 0xfe, 0x3f, 0xe0, 0x0, 0x0, 0x3c,
-    0xff, 0xf8, 0xff, 0xc0, 0x0, 0x0, 0xfc, 0x0,
-    0x3, 0xff, 0x80, 0x0, 0x1, 0xf8, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x7, 0xf8, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xf0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0xff, 0xf0, 0x0, 0x1, 0xff,
-    0xe0, 0x1, 0xff, 0xe0, 0x0, 0x3, 0xff, 0xc0,
-    0x3, 0xff, 0xc0, 0x0, 0x7, 0xff, 0x80, 0x7,
-    0xff, 0x80, 0x0, 0xf, 0xff, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x1f, 0xfe, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x3f, 0xfc, 0x0, 0x0,
-    0x7f, 0xf8, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0xff, 0xf0, 0x0, 0x1, 0xff, 0xe0,
-    0x1, 0xff, 0xe0, 0x0, 0x3, 0xff, 0xc0, 0x3,
-    0xff, 0xc0, 0x0, 0x7, 0xff, 0x80, 0x7, 0xff,
-    0x80, 0x0, 0xf, 0xff, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x1f, 0xfe, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0xff, 0xf0, 0x0, 0x1, 0xff, 0xe0, 0x1,
-    0xff, 0xe0, 0x0, 0x3, 0xff, 0xc0, 0x3, 0xff,
-    0xc0, 0x0, 0x7, 0xff, 0x80, 0x7, 0xff, 0x80,
-    0x0, 0xf, 0xff, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x3f,
-    0xfc, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf0, 0xf, 0xff, 0xff, 0xff, 0xfc, 0x7f,
-    0xe0, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xc0,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0x83, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x7f, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7e, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80,
-
-    /* U+0063 "c" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc6, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1e, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xfe,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xfe, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0x3, 0xfe, 0x3f, 0xff,
-    0xff, 0xff, 0xfc, 0x7, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xf0, 0xf, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xe0,
-    0x1f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0xfc, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0xf1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0xc7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc,
-
-    /* U+0064 "d" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe3, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xfe, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0xfc, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0x8f, 0xf8, 0x7, 0xff, 0xff, 0xff,
-    0xfe, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xc0, 0x0, 0x7, 0xff, 0x80, 0x7, 0xff, 0x80,
-    0x0, 0xf, 0xff, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x3f,
-    0xfc, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x7f, 0xf8,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0xff, 0xf0, 0x0, 0x1, 0xff, 0xe0, 0x1, 0xff,
-    0xe0, 0x0, 0x3, 0xff, 0xc0, 0x3, 0xff, 0xc0,
-    0x0, 0x7, 0xff, 0x80, 0x7, 0xff, 0x80, 0x0,
-    0xf, 0xff, 0x0, 0xf, 0xff, 0x0, 0x0, 0x1f,
-    0xfe, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x3f, 0xfc,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x7f, 0xf8, 0x0, 0x0, 0xff, 0xf0, 0x0, 0xff,
-    0xf0, 0x0, 0x1, 0xff, 0xe0, 0x1, 0xff, 0xe0,
-    0x0, 0x3, 0xff, 0xc0, 0x3, 0xff, 0xc0, 0x0,
-    0x7, 0xff, 0x80, 0x7, 0xff, 0x80, 0x0, 0xf,
-    0xff, 0x0, 0xf, 0xff, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0xff, 0xf0, 0x0, 0xff, 0xf0,
-    0x0, 0x1, 0xff, 0xe0, 0x1, 0xff, 0xe0, 0x0,
-    0x1, 0xff, 0x80, 0x3, 0xff, 0xc0, 0x0, 0x1,
-    0xfe, 0x0, 0x7, 0xff, 0x80, 0x0, 0x3, 0xfc,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x1f,
-    0xfc, 0x0, 0x0, 0x7, 0x80, 0x0, 0x1f, 0xf8,
-    0x0, 0x0, 0x6, 0x0, 0x0, 0x1f, 0xf0, 0x0,
-    0x0, 0xc, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0,
-    0x10, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0,
-    0x0, 0x6, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0,
-    0xc, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0x3c,
-    0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0xfc, 0x0,
-    0x3, 0xff, 0x80, 0x0, 0x1, 0xf8, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x7, 0xf8, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xf0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0xff, 0xf0, 0x0, 0x1, 0xff,
-    0xe0, 0x1, 0xff, 0xe0, 0x0, 0x3, 0xff, 0xc0,
-    0x3, 0xff, 0xc0, 0x0, 0x7, 0xff, 0x80, 0x7,
-    0xff, 0x80, 0x0, 0xf, 0xff, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x1f, 0xfe, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x3f, 0xfc, 0x0, 0x0,
-    0x7f, 0xf8, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0xff, 0xf0, 0x0, 0x1, 0xff, 0xe0,
-    0x1, 0xff, 0xe0, 0x0, 0x3, 0xff, 0xc0, 0x3,
-    0xff, 0xc0, 0x0, 0x7, 0xff, 0x80, 0x7, 0xff,
-    0x80, 0x0, 0xf, 0xff, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x1f, 0xfe, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0xff, 0xf0, 0x0, 0x1, 0xff, 0xe0, 0x1,
-    0xff, 0xe0, 0x0, 0x3, 0xff, 0xc0, 0x3, 0xff,
-    0xc0, 0x0, 0x7, 0xff, 0x80, 0x7, 0xff, 0x80,
-    0x0, 0xf, 0xff, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x3f,
-    0xfc, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf0, 0xf, 0xff, 0xff, 0xff, 0xfc, 0x7f,
-    0xe0, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xc0,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0x83, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x7f, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x7e, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80,
-
-    /* U+0065 "e" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc6, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1e, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xfe,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xfe, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0x3, 0xfe, 0x3f, 0xff,
-    0xff, 0xff, 0xfc, 0x7, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xf0, 0xf, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x1f, 0xfe, 0x0, 0xff, 0xf0, 0x7,
-    0xfc, 0x7f, 0xfe, 0x1, 0xff, 0xf0, 0xf, 0xf1,
-    0xff, 0xfe, 0x7, 0xff, 0xf0, 0x1f, 0xc7, 0xff,
-    0xfc, 0x1f, 0xff, 0xf0, 0x3f, 0x1f, 0xff, 0xfc,
-    0x3f, 0xff, 0xf0, 0x0, 0x7f, 0xff, 0xf8, 0xff,
-    0xff, 0xf0, 0x0, 0xff, 0xff, 0xf1, 0xff, 0xff,
-    0xf1, 0xf8, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xc3,
-    0xf8, 0xff, 0xff, 0x83, 0xff, 0xff, 0x7, 0xf8,
-    0xff, 0xff, 0x3, 0xff, 0xfc, 0xf, 0xf8, 0xff,
-    0xfc, 0x7, 0xff, 0xf0, 0x1f, 0xf8, 0xff, 0xf0,
-    0x7, 0xff, 0xc0, 0x3f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xe0,
-    0x1f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0xfc, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0xf1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0xc7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc,
-
-    /* U+0066 "f" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc6, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1e, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7e, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xfe,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xfe, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0x3, 0xfe, 0x3f, 0xff,
-    0xff, 0xff, 0xfc, 0x7, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xf0, 0xf, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x1f, 0xfe, 0x0, 0xff, 0xf0, 0x7,
-    0xfc, 0x7f, 0xfe, 0x1, 0xff, 0xf0, 0xf, 0xf1,
-    0xff, 0xfe, 0x7, 0xff, 0xf0, 0x1f, 0xc7, 0xff,
-    0xfc, 0x1f, 0xff, 0xf0, 0x3f, 0x1f, 0xff, 0xfc,
-    0x3f, 0xff, 0xf0, 0x0, 0x7f, 0xff, 0xf8, 0xff,
-    0xff, 0xf0, 0x0, 0xff, 0xff, 0xf1, 0xff, 0xff,
-    0xf1, 0xf8, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xc3,
-    0xf8, 0xff, 0xff, 0x83, 0xff, 0xff, 0x7, 0xf8,
-    0xff, 0xff, 0x3, 0xff, 0xfc, 0xf, 0xf8, 0xff,
-    0xfc, 0x7, 0xff, 0xf0, 0x1f, 0xf8, 0xff, 0xf0,
-    0x7, 0xff, 0xc0, 0x3f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0067 "g" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x63, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x1e, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x7, 0xe3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x1f, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x3, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x7f, 0xe3, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xf0, 0x0, 0x7f, 0xc0, 0x0,
-    0x0, 0x3f, 0xff, 0x0, 0xf, 0xf0, 0x0, 0x0,
-    0x7, 0xff, 0xf0, 0x1, 0xfc, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xe0, 0x1f, 0x80, 0x0, 0x0, 0x3f, 0xff, 0xf8,
-    0xff, 0xf8, 0x0, 0x0, 0x3, 0xff, 0xfe, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x3f, 0xff, 0x8f, 0xff,
-    0xf8, 0x0, 0x0, 0x7, 0xff, 0xe3, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x7f, 0xf8, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xc7, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff,
-    0xc7, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7f, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xc7,
-    0xef, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x78,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80,
-
-    /* U+0068 "h" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x7e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xf1, 0xff, 0xe0, 0xf, 0xff, 0x1f, 0xff,
-    0xfc, 0x7f, 0xfe, 0x3, 0xff, 0xf1, 0xff, 0xff,
-    0x1f, 0xff, 0xc0, 0x7f, 0xff, 0x1f, 0xff, 0xc7,
-    0xff, 0xfc, 0x1f, 0xff, 0xf1, 0xff, 0xf1, 0xff,
-    0xff, 0xc7, 0xff, 0xff, 0x1f, 0x80, 0x7f, 0xff,
-    0xf8, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff,
-    0x1f, 0xff, 0xfe, 0x1, 0xf8, 0xff, 0xff, 0xe3,
-    0xff, 0xff, 0x8f, 0xff, 0x8f, 0xff, 0xf8, 0x3f,
-    0xff, 0xe3, 0xff, 0xf8, 0xff, 0xfe, 0x3, 0xff,
-    0xf8, 0xff, 0xff, 0x8f, 0xff, 0xc0, 0x7f, 0xfe,
-    0x3f, 0xff, 0xf8, 0xff, 0xf0, 0x7, 0xff, 0x8f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0x8c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0069 "i" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xf1, 0xff,
-    0xff, 0xff, 0xff, 0xc7, 0xff, 0xfc, 0x7f, 0xff,
-    0xff, 0xff, 0xfc, 0x7f, 0xff, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xc7, 0xff, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x7e, 0xf1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc7, 0x8c, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x60, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-
-    /* U+006B "k" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xc0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0xf, 0xef, 0xff, 0x0, 0x0,
-    0x0, 0x3f, 0xbf, 0xfc, 0x0, 0x0, 0x0, 0xfc,
-    0xff, 0xf0, 0x0, 0x0, 0x3, 0xf3, 0xff, 0xc0,
-    0x0, 0x0, 0xf, 0x8f, 0xff, 0x0, 0x0, 0x0,
-    0x3e, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0xf0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xf, 0xfc, 0x7f, 0xfc, 0x0, 0x0,
-    0x3f, 0xe3, 0xff, 0xf0, 0x0, 0x0, 0xff, 0x1f,
-    0xff, 0xe0, 0x0, 0x3, 0xf8, 0xff, 0xff, 0x80,
-    0x0, 0xf, 0xc7, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xf8, 0x0, 0x3, 0xf1, 0xff, 0xff, 0xc0, 0x0,
-    0xf, 0xe3, 0xff, 0xfe, 0x0, 0x0, 0x3f, 0xc7,
-    0xff, 0xf8, 0x0, 0x0, 0xff, 0x8f, 0xff, 0xc0,
-    0x0, 0x3, 0xff, 0x1f, 0xff, 0x0, 0x0, 0xf,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x3,
-    0xc3, 0xff, 0xc0, 0x0, 0x0, 0xf, 0xf, 0xff,
-    0x0, 0x0, 0x0, 0x3e, 0x3f, 0xfc, 0x0, 0x0,
-    0x0, 0xfc, 0xff, 0xf0, 0x0, 0x0, 0x3, 0xf3,
-    0xff, 0xc0, 0x0, 0x0, 0xf, 0xef, 0xff, 0x0,
-    0x0, 0x0, 0x3f, 0xbf, 0xfc, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+006C "l" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xc7,
-    0xff, 0xff, 0xff, 0xfe, 0x1, 0xff, 0x1f, 0xff,
-    0xff, 0xff, 0xfe, 0x3, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xfe, 0x7, 0xf1, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xf, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xf, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0,
-
-    /* U+006D "m" */
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7b, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x3,
-    0xbf, 0xff, 0xff, 0xcf, 0x0, 0x0, 0x0, 0xf7,
-    0xff, 0xff, 0xf9, 0xe0, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0xff, 0x3e, 0x0, 0x0, 0x7, 0xdf, 0xff,
-    0xff, 0xe7, 0xc0, 0x0, 0x0, 0xfb, 0xff, 0xff,
-    0xfc, 0xfc, 0x0, 0x0, 0x3f, 0x7f, 0xff, 0xff,
-    0x9f, 0x80, 0x0, 0x7, 0xef, 0xff, 0xff, 0xf3,
-    0xf8, 0x0, 0x1, 0xfd, 0xff, 0xff, 0xfe, 0x7f,
-    0x80, 0x0, 0x7f, 0xbf, 0xff, 0xff, 0xcf, 0xf0,
-    0x0, 0xf, 0xf7, 0xff, 0xff, 0xf9, 0xfe, 0x0,
-    0x1, 0xfe, 0xff, 0xff, 0xff, 0x3f, 0xc0, 0x0,
-    0x3f, 0xdf, 0xff, 0xff, 0xe7, 0xf8, 0x0, 0x7,
-    0xfb, 0xff, 0xff, 0xfc, 0xff, 0x0, 0x0, 0xff,
-    0x7f, 0xff, 0xff, 0x9f, 0xe0, 0x0, 0x1f, 0xef,
-    0xff, 0xff, 0xf3, 0xfc, 0x0, 0x3, 0xfd, 0xff,
-    0xff, 0xfe, 0x7f, 0x80, 0x0, 0x7f, 0xbf, 0xff,
-    0xff, 0xcf, 0xf0, 0x0, 0xf, 0xf7, 0xff, 0xff,
-    0xf9, 0xfe, 0x0, 0x1, 0xfe, 0xff, 0xff, 0xff,
-    0x3f, 0xc0, 0x0, 0x3f, 0xdf, 0xff, 0xff, 0xe3,
-    0xf8, 0x0, 0x7, 0xf3, 0xff, 0xff, 0xfc, 0x7f,
-    0x0, 0x0, 0xfe, 0x7f, 0xff, 0xff, 0x87, 0xe0,
-    0x0, 0x1f, 0x8f, 0xff, 0xff, 0xf0, 0xfc, 0x0,
-    0x3, 0xf1, 0xff, 0xff, 0xfe, 0xf, 0x80, 0x0,
-    0x7c, 0x3f, 0xff, 0xff, 0xc0, 0xf0, 0x0, 0xf,
-    0x7, 0xff, 0xff, 0xf8, 0x1e, 0x0, 0x1, 0xe0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x1, 0x0,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x30, 0x0,
-    0x0, 0xff, 0xff, 0x80, 0x0, 0xf, 0x0, 0x0,
-    0x3f, 0xff, 0xf8, 0x0, 0x1, 0xe0, 0x0, 0xf,
-    0xff, 0xff, 0x80, 0x0, 0x7e, 0x0, 0x3, 0xff,
-    0xff, 0xf8, 0x0, 0xf, 0xc0, 0x0, 0xff, 0xff,
-    0xff, 0x0, 0x3, 0xfc, 0x0, 0x1f, 0xff, 0xff,
-    0xe0, 0x0, 0xff, 0xc0, 0x3, 0xff, 0xff, 0xfc,
-    0x0, 0x1f, 0xf8, 0x0, 0x7f, 0xff, 0xff, 0x80,
-    0x7, 0xff, 0x80, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0xff, 0xf0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x1f,
-    0xfe, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x3, 0xff,
-    0xc0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x7f, 0xf8,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0xf, 0xff, 0x0,
-    0x1f, 0xff, 0xff, 0xe0, 0x1, 0xff, 0xe0, 0x3,
-    0xff, 0xff, 0xfc, 0x0, 0x3f, 0xfc, 0x0, 0x7f,
-    0xff, 0xff, 0x80, 0x7, 0xff, 0x80, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0xff, 0xf0, 0x1, 0xff, 0xff,
-    0xfe, 0x0, 0x1f, 0xfe, 0x0, 0x3f, 0xff, 0xff,
-    0xc0, 0x3, 0xff, 0xc0, 0x7, 0xff, 0xff, 0xf8,
-    0x0, 0x7f, 0xf8, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0xf, 0xff, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x1,
-    0xff, 0xe0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x3f,
-    0xfc, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x7, 0xff,
-    0x80, 0xf, 0xff, 0xff, 0xf0, 0x0, 0xff, 0xf0,
-    0x1, 0xff, 0xff, 0xfe, 0x0, 0x1f, 0xfe, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xc0, 0x7,
-    0xff, 0xff, 0xf8, 0x0, 0x7f, 0xf8, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0xf, 0xff, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x1, 0xff, 0xe0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0x8c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+006E "n" */
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7b, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xcf, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf9, 0xe0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x3e, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe7, 0xc0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0xfc, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x9f, 0x80, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf3,
-    0xf8, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x7f,
-    0x80, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xcf, 0xf0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf9, 0xfe, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x3f, 0xc0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xe7, 0xf8, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0xff, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x9f, 0xe0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf3, 0xfc, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0x7f, 0x80, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xcf, 0xf0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf9, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x3f, 0xc0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe3,
-    0xf8, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x7f,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x87, 0xe0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0xfc, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfe, 0xf, 0x80, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0xf0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x1e, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x1, 0xe0, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x3c, 0x1f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x7, 0xc3, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0xf8, 0x7f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x1f, 0x8f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x3, 0xf1, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x7f, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xf, 0xf7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x1,
-    0xfe, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3f,
-    0xdf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xfb,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xff, 0x7f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x1f, 0xef, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x3, 0xfd, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x7f, 0xbf, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0xf, 0xf7, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x1, 0xfe, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x3f, 0xdf, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x7, 0xfb, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x7f, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0xf, 0xef, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0xfd, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1f,
-    0xbf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x1, 0xf7,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0x8c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+006F "o" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x63, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x1e, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xf7, 0xe3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0x8f, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xe3, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xfe, 0x3f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xc7, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff,
-    0xc7, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x7f, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xc7,
-    0xef, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x78,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80,
-
-    /* U+0070 "p" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x63, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x1e, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xf7, 0xe3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0x8f, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xe3, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xfe, 0x3f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x1f,
-    0xfe, 0x0, 0xff, 0xf1, 0xff, 0xff, 0xc7, 0xff,
-    0xe0, 0x3f, 0xff, 0x1f, 0xff, 0xf1, 0xff, 0xfc,
-    0x7, 0xff, 0xf1, 0xff, 0xfc, 0x7f, 0xff, 0xc1,
-    0xff, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0xfc, 0x7f,
-    0xff, 0xf1, 0xf8, 0x7, 0xff, 0xff, 0x8f, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xf1, 0xff, 0xff,
-    0xe0, 0x1f, 0x8f, 0xff, 0xfe, 0x3f, 0xff, 0xf8,
-    0x3, 0xf8, 0xff, 0xff, 0x83, 0xff, 0xfe, 0x0,
-    0x7f, 0x8f, 0xff, 0xe0, 0x3f, 0xff, 0x80, 0xf,
-    0xf8, 0xff, 0xfc, 0x7, 0xff, 0xe0, 0x1, 0xff,
-    0x8f, 0xff, 0x0, 0x7f, 0xf8, 0x0, 0x3f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x63, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x1e, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xf7, 0xe3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xcf, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0x3f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x3, 0xc1, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x7c, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xf, 0x87, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x1,
-    0xf8, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3f,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xf3,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xfe, 0x7f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x1f, 0xef, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x3, 0xfd, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x7f, 0xbf, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0xf, 0xf7, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x1, 0xfe, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x3f, 0xdf, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x7, 0xfb, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0xff, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x1f, 0xef, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3,
-    0xfd, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x7f,
-    0xbf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x7, 0xf7,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xfe, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0xf, 0xdf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x1, 0xfb, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x1f, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x3, 0xbf, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xe7, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
-    0xfe, 0x7f, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff,
-    0xe7, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x7f, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xc7,
-    0xef, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x78,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80,
-
-    /* U+0072 "r" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x63, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x1e, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xf7, 0xe3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xcf, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0x3f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x1f,
-    0xff, 0x0, 0xff, 0xf9, 0xff, 0xff, 0xc7, 0xff,
-    0xe0, 0x1f, 0xff, 0x9f, 0xff, 0xf1, 0xff, 0xfe,
-    0x7, 0xff, 0xf1, 0xff, 0xfc, 0x7f, 0xff, 0xc0,
-    0xff, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0xfc, 0x3f,
-    0xff, 0xf1, 0xf8, 0x7, 0xff, 0xff, 0xcf, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xf9, 0xff, 0xff,
-    0xe0, 0x1f, 0x8f, 0xff, 0xfe, 0x1f, 0xff, 0xf8,
-    0x3, 0xf8, 0xff, 0xff, 0x81, 0xff, 0xfe, 0x0,
-    0x7f, 0x8f, 0xff, 0xf0, 0x3f, 0xff, 0xc0, 0xf,
-    0xf8, 0xff, 0xfc, 0x3, 0xff, 0xf0, 0x1, 0xff,
-    0x8f, 0xff, 0x80, 0x7f, 0xfc, 0x0, 0x3f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x1f, 0xfe, 0x0, 0x0,
-    0x0, 0x78, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0xf, 0x80, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x1,
-    0xf8, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x3f,
-    0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xf0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x0, 0x1f, 0xe0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x1f,
-    0xfe, 0x0, 0x0, 0x0, 0x7f, 0x80, 0x3, 0xff,
-    0xc0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x7f, 0xf8,
-    0x0, 0x0, 0x1, 0xfe, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0x1, 0xff, 0xe0, 0x0,
-    0x0, 0x7, 0xf8, 0x0, 0x3f, 0xfc, 0x0, 0x0,
-    0x0, 0xff, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0,
-    0x1f, 0xe0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x3,
-    0xfc, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x7f,
-    0x80, 0x3, 0xff, 0xc0, 0x0, 0x0, 0xf, 0xf0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0xf, 0xc0, 0x1,
-    0xff, 0xe0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x3f,
-    0xfc, 0x0, 0x0, 0x0, 0x1f, 0x0, 0x7, 0xff,
-    0x80, 0x0, 0x0, 0x3, 0xe0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x3c, 0x0, 0x1f, 0xfe, 0x0,
-    0x0, 0x0, 0x7, 0x80, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x70, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x63, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x1e, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x7, 0xe3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x1f, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x3, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x7f, 0xe3, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0xf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfc, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x9e, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf3,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x7c,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xcf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf9, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x3f, 0x80, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xe7, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfc, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x9f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf3, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfe, 0x7f, 0x80, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xcf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf9, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe7,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x9f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf3, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x3f, 0x80, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xc7, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf8, 0x7e, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xe0, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0xf, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x81, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x1f,
-    0xff, 0x0, 0xff, 0xf8, 0x0, 0x7f, 0xc7, 0xff,
-    0xe0, 0x1f, 0xff, 0x80, 0xf, 0xf1, 0xff, 0xfe,
-    0x7, 0xff, 0xf0, 0x1, 0xfc, 0x7f, 0xff, 0xc0,
-    0xff, 0xff, 0x0, 0x3f, 0x1f, 0xff, 0xfc, 0x3f,
-    0xff, 0xf0, 0x0, 0x7, 0xff, 0xff, 0xcf, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xf9, 0xff, 0xff,
-    0xe0, 0x0, 0xf, 0xff, 0xfe, 0x1f, 0xff, 0xf8,
-    0xfc, 0x0, 0xff, 0xff, 0x81, 0xff, 0xfe, 0x3f,
-    0x80, 0xf, 0xff, 0xf0, 0x3f, 0xff, 0xcf, 0xf0,
-    0x0, 0xff, 0xfc, 0x3, 0xff, 0xf3, 0xfe, 0x0,
-    0xf, 0xff, 0x80, 0x7f, 0xfc, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xc1, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x78, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x87, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1,
-    0xf8, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf3,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xef, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfd, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xbf, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf7, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x1, 0xfe, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xdf, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfb, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xef, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfd, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xbf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf7,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xfe, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xdf, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3d, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xbf, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xe7, 0xfe, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xfe, 0x7f, 0xc0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xe7, 0xf8, 0x1, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x7f, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xc7,
-    0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x78,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80,
-
-    /* U+0074 "t" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x78, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x0,
-    0x0,
-
-    /* U+0075 "u" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x7e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xc7,
-    0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xf1, 0xff,
-    0xff, 0xff, 0xff, 0xc7, 0xff, 0xfc, 0x7f, 0xff,
-    0xff, 0xff, 0xfc, 0x7f, 0xff, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xc7, 0xff, 0xc7, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x7e, 0xf1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc7, 0x8c, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x60, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-
-    /* U+0076 "v" */
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x1, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x80, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xc0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0xf, 0xef, 0xff, 0x0, 0x0,
-    0x0, 0x3f, 0xbf, 0xfc, 0x0, 0x0, 0x0, 0xfc,
-    0xff, 0xf0, 0x0, 0x0, 0x3, 0xf3, 0xff, 0xc0,
-    0x0, 0x0, 0xf, 0x8f, 0xff, 0x0, 0x0, 0x0,
-    0x3c, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0xf0, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0xf,
-    0x0, 0x0, 0x0, 0xff, 0xf0, 0x3c, 0x0, 0x0,
-    0x3, 0xff, 0xc1, 0xf0, 0x0, 0x0, 0xf, 0xff,
-    0x7, 0xc0, 0x0, 0x0, 0x3f, 0xfc, 0x3f, 0x0,
-    0x0, 0x0, 0xff, 0xf0, 0xfc, 0x0, 0x0, 0x3,
-    0xff, 0xc7, 0xf0, 0x0, 0x0, 0xf, 0xff, 0x3f,
-    0xc0, 0x0, 0x0, 0x3f, 0xfc, 0xff, 0x0, 0x0,
-    0x0, 0xff, 0xf3, 0xfc, 0x0, 0x0, 0x3, 0xff,
-    0xcf, 0xf0, 0x0, 0x0, 0xf, 0xff, 0x3f, 0xc0,
-    0x0, 0x0, 0x3f, 0xfc, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0xf3, 0xfc, 0x0, 0x0, 0x3, 0xff, 0xcf,
-    0xf0, 0x0, 0x0, 0xf, 0xff, 0x3f, 0xc0, 0x0,
-    0x0, 0x3f, 0xfc, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xf3, 0xfc, 0x0, 0x0, 0x3, 0xff, 0xcf, 0xf0,
-    0x0, 0x0, 0xf, 0xff, 0x3f, 0x80, 0x0, 0x0,
-    0x3f, 0xfc, 0xfe, 0x0, 0x0, 0x0, 0xff, 0xf3,
-    0xf0, 0x0, 0x0, 0x3, 0xff, 0xcf, 0xc0, 0x0,
-    0x0, 0xf, 0xff, 0x3e, 0x0, 0x0, 0x0, 0x3f,
-    0xfc, 0xf0, 0x0, 0x0, 0x0, 0xff, 0xf3, 0xc0,
-    0x0, 0x0, 0x3, 0xff, 0xce, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0077 "w" */
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7b, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfe, 0x0, 0x1f, 0xfe, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xc0, 0x7,
-    0xff, 0xff, 0xf8, 0x0, 0x7f, 0xf8, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0xf, 0xff, 0x0, 0x1f, 0xff,
-    0xff, 0xe0, 0x1, 0xff, 0xe0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x3f, 0xfc, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x7, 0xff, 0x80, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0xff, 0xf0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x1f, 0xfe, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x3,
-    0xff, 0xc0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x7f,
-    0xf8, 0x0, 0xff, 0xff, 0xff, 0x0, 0xf, 0xff,
-    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x1, 0xff, 0xe0,
-    0x3, 0xff, 0xff, 0xfc, 0x0, 0x3f, 0xfc, 0x0,
-    0x7f, 0xff, 0xff, 0x80, 0x7, 0xff, 0x80, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0xff, 0xf0, 0x1, 0xff,
-    0xff, 0xfe, 0x0, 0x1f, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0xc0, 0x3, 0xff, 0xc0, 0x7, 0xff, 0xff,
-    0xf8, 0x0, 0x7f, 0xf8, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0xf, 0xff, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0x1, 0xff, 0xe0, 0x3, 0xff, 0xff, 0xfc, 0x0,
-    0x3f, 0xfc, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x7,
-    0xff, 0x80, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x7f,
-    0xe0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xfc,
-    0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0, 0xff, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x0, 0x1f, 0xe0, 0x0,
-    0xff, 0xff, 0xff, 0x0, 0x1, 0xf8, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x3f, 0x0, 0x1, 0xff,
-    0xff, 0xf0, 0x0, 0x3, 0xc0, 0x0, 0x1f, 0xff,
-    0xfc, 0x0, 0x0, 0x30, 0x0, 0x1, 0xff, 0xff,
-    0x0, 0x0, 0x6, 0x0, 0x0, 0x1f, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf8, 0x1e, 0x0, 0x1, 0xe0, 0xff, 0xff,
-    0xff, 0x3, 0xc0, 0x0, 0x3c, 0x1f, 0xff, 0xff,
-    0xe0, 0xf8, 0x0, 0x7, 0xc3, 0xff, 0xff, 0xfc,
-    0x1f, 0x0, 0x0, 0xf8, 0x7f, 0xff, 0xff, 0x87,
-    0xe0, 0x0, 0x1f, 0x8f, 0xff, 0xff, 0xf0, 0xfc,
-    0x0, 0x3, 0xf1, 0xff, 0xff, 0xfe, 0x3f, 0x80,
-    0x0, 0x7f, 0x3f, 0xff, 0xff, 0xcf, 0xf0, 0x0,
-    0xf, 0xf7, 0xff, 0xff, 0xf9, 0xfe, 0x0, 0x1,
-    0xfe, 0xff, 0xff, 0xff, 0x3f, 0xc0, 0x0, 0x3f,
-    0xdf, 0xff, 0xff, 0xe7, 0xf8, 0x0, 0x7, 0xfb,
-    0xff, 0xff, 0xfc, 0xff, 0x0, 0x0, 0xff, 0x7f,
-    0xff, 0xff, 0x9f, 0xe0, 0x0, 0x1f, 0xef, 0xff,
-    0xff, 0xf3, 0xfc, 0x0, 0x3, 0xfd, 0xff, 0xff,
-    0xfe, 0x7f, 0x80, 0x0, 0x7f, 0xbf, 0xff, 0xff,
-    0xcf, 0xf0, 0x0, 0xf, 0xf7, 0xff, 0xff, 0xf9,
-    0xfe, 0x0, 0x1, 0xfe, 0xff, 0xff, 0xff, 0x3f,
-    0xc0, 0x0, 0x3f, 0xdf, 0xff, 0xff, 0xe7, 0xf8,
-    0x0, 0x7, 0xfb, 0xff, 0xff, 0xfc, 0xfe, 0x0,
-    0x0, 0x7f, 0x7f, 0xff, 0xff, 0x9f, 0xc0, 0x0,
-    0xf, 0xef, 0xff, 0xff, 0xf3, 0xf0, 0x0, 0x0,
-    0xfd, 0xff, 0xff, 0xfe, 0x7e, 0x0, 0x0, 0x1f,
-    0xbf, 0xff, 0xff, 0xcf, 0x80, 0x0, 0x1, 0xf7,
-    0xff, 0xff, 0xf9, 0xe0, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0xff, 0x3c, 0x0, 0x0, 0x3, 0xdf, 0xff,
-    0xff, 0xe7, 0x0, 0x0, 0x0, 0x3b, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0x8c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0078 "x" */
-    0xe0, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0xf,
-    0xf0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x1f,
-    0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f,
-    0xfe, 0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0x7f, 0x0, 0x0, 0xfe,
-    0x7f, 0x0, 0x0, 0xfe, 0x3f, 0x0, 0x0, 0xfc,
-    0x3f, 0x0, 0x0, 0xfc, 0x1f, 0x0, 0x0, 0xf8,
-    0x1f, 0x0, 0x0, 0xf8, 0xf, 0x0, 0x0, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x0, 0x0, 0xf0, 0x1f, 0x0, 0x0, 0xf8,
-    0x1f, 0x0, 0x0, 0xf8, 0x3f, 0x0, 0x0, 0xfc,
-    0x3f, 0x0, 0x0, 0xfc, 0x7f, 0x0, 0x0, 0xfe,
-    0x7f, 0x0, 0x0, 0xfe, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xfe, 0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0, 0x7f,
-    0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f,
-    0xf8, 0x0, 0x0, 0x1f, 0xf0, 0x0, 0x0, 0xf,
-    0xf0, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x7,
-
-    /* U+0079 "y" */
-    0xe0, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0xf,
-    0xf0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x1f,
-    0xf8, 0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x3f,
-    0xfc, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0x7f,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
-    0x7f, 0x0, 0x0, 0xfe, 0x7f, 0x0, 0x0, 0xfe,
-    0x3f, 0x0, 0x0, 0xfc, 0x3f, 0x0, 0x0, 0xfc,
-    0x1f, 0x0, 0x0, 0xf8, 0xf, 0x0, 0x0, 0xf0,
-    0xf, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
-    0x0, 0x1, 0x80, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x7, 0xe0, 0x0,
-    0x0, 0x7, 0xe0, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0xf, 0xf0, 0x0, 0x0, 0x1f, 0xf8, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x0, 0x3f, 0xfc, 0x0,
-
-    /* U+007A "z" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-
-    /* U+007C "|" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0xfe, 0x3f, 0xc3, 0xfc, 0x1f,
-    0x81, 0xf8, 0xf, 0x0, 0x60, 0x6, 0x0, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0,
-    0x60, 0x6, 0x0, 0xf0, 0x1f, 0x81, 0xf8, 0x3f,
-    0xc3, 0xfc, 0x7f, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-
-    /* U+007E "~" */
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x63, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x1e, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xf7, 0xe3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xcf, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0x3f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0xe0, 0x3f, 0xfc, 0x7, 0x7f, 0xff, 0xff,
-    0x9e, 0x7, 0xff, 0x81, 0xef, 0xff, 0xff, 0xf3,
-    0xe0, 0xff, 0xf0, 0x7d, 0xff, 0xff, 0xfe, 0x7c,
-    0x1f, 0xfe, 0xf, 0xbf, 0xff, 0xff, 0xcf, 0xc3,
-    0xff, 0xc3, 0xf7, 0xff, 0xff, 0xf9, 0xf8, 0x7f,
-    0xf8, 0x7e, 0xff, 0xff, 0xff, 0x3f, 0x8f, 0xff,
-    0x1f, 0xdf, 0xff, 0xff, 0xe7, 0xf1, 0xff, 0xe3,
-    0xfb, 0xff, 0xff, 0xfc, 0xff, 0x3f, 0xfc, 0xff,
-    0x7f, 0xff, 0xff, 0x9f, 0xe7, 0xff, 0x9f, 0xef,
-    0xff, 0xff, 0xf3, 0xfc, 0xff, 0xf3, 0xfd, 0xff,
-    0xff, 0xfe, 0x7f, 0x9f, 0xfe, 0x7f, 0xbf, 0xff,
-    0xff, 0xcf, 0xf3, 0xff, 0xcf, 0xf7, 0xff, 0xff,
-    0xf9, 0xfe, 0x7f, 0xf9, 0xfe, 0xff, 0xff, 0xff,
-    0x3f, 0xcf, 0xff, 0x3f, 0xdf, 0xff, 0xff, 0xe7,
-    0xf9, 0xff, 0xe7, 0xfb, 0xff, 0xff, 0xfc, 0xff,
-    0x3f, 0xfc, 0xff, 0x7f, 0xff, 0xff, 0x9f, 0xe7,
-    0xff, 0x9f, 0xef, 0xff, 0xff, 0xf3, 0xfc, 0xff,
-    0xf3, 0xfd, 0xff, 0xff, 0xfe, 0x3f, 0x9f, 0xfe,
-    0x7f, 0x3f, 0xff, 0xff, 0xc7, 0xf3, 0xff, 0xcf,
-    0xe7, 0xff, 0xff, 0xf8, 0x7e, 0x7f, 0xf9, 0xf8,
-    0xff, 0xff, 0xff, 0xf, 0xcf, 0xff, 0x3f, 0x1f,
-    0xff, 0xff, 0xe0, 0xf8, 0xff, 0xc7, 0xc3, 0xff,
-    0xff, 0xfc, 0xf, 0xf, 0xf0, 0xf0, 0x7f, 0xff,
-    0xff, 0x81, 0xe1, 0xfe, 0x1e, 0xf, 0xff, 0xff,
-    0xf0, 0x0, 0x1f, 0x80, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0x3, 0xf0, 0x0, 0x1f, 0xff, 0xff, 0x1f,
-    0xff, 0x3c, 0xff, 0xf9, 0xff, 0xff, 0xc7, 0xff,
-    0xe3, 0x1f, 0xff, 0x9f, 0xff, 0xf1, 0xff, 0xfe,
-    0x67, 0xff, 0xf1, 0xff, 0xfc, 0x7f, 0xff, 0xc0,
-    0xff, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0xfc, 0x3f,
-    0xff, 0xf1, 0xf8, 0x7, 0xff, 0xff, 0xcf, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0xf9, 0xff, 0xff,
-    0xe0, 0x1f, 0x8f, 0xff, 0xfe, 0x1f, 0xff, 0xf8,
-    0xff, 0xf8, 0xff, 0xff, 0x81, 0xff, 0xfe, 0x3f,
-    0xff, 0x8f, 0xff, 0xf3, 0x3f, 0xff, 0xcf, 0xff,
-    0xf8, 0xff, 0xfc, 0x63, 0xff, 0xf3, 0xff, 0xff,
-    0x8f, 0xff, 0x9e, 0x7f, 0xfc, 0xff, 0xff, 0xf8,
-    0x0, 0x7, 0xe0, 0x0, 0x3f, 0xff, 0xff, 0x80,
-    0x0, 0xfc, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x3c,
-    0x3f, 0xc3, 0xc1, 0xff, 0xff, 0xfe, 0x7, 0x87,
-    0xf8, 0x78, 0x3f, 0xff, 0xff, 0xc1, 0xf1, 0xff,
-    0x8f, 0x87, 0xff, 0xff, 0xf8, 0x7e, 0x7f, 0xf9,
-    0xf8, 0xff, 0xff, 0xff, 0xf, 0xcf, 0xff, 0x3f,
-    0x1f, 0xff, 0xff, 0xe3, 0xf9, 0xff, 0xe7, 0xf3,
-    0xff, 0xff, 0xfc, 0x7f, 0x3f, 0xfc, 0xfe, 0x7f,
-    0xff, 0xff, 0x9f, 0xe7, 0xff, 0x9f, 0xef, 0xff,
-    0xff, 0xf3, 0xfc, 0xff, 0xf3, 0xfd, 0xff, 0xff,
-    0xfe, 0x7f, 0x9f, 0xfe, 0x7f, 0xbf, 0xff, 0xff,
-    0xcf, 0xf3, 0xff, 0xcf, 0xf7, 0xff, 0xff, 0xf9,
-    0xfe, 0x7f, 0xf9, 0xfe, 0xff, 0xff, 0xff, 0x3f,
-    0xcf, 0xff, 0x3f, 0xdf, 0xff, 0xff, 0xe7, 0xf9,
-    0xff, 0xe7, 0xfb, 0xff, 0xff, 0xfc, 0xff, 0x3f,
-    0xfc, 0xff, 0x7f, 0xff, 0xff, 0x9f, 0xe7, 0xff,
-    0x9f, 0xef, 0xff, 0xff, 0xf3, 0xfc, 0xff, 0xf3,
-    0xfd, 0xff, 0xff, 0xfe, 0x7f, 0x9f, 0xfe, 0x7f,
-    0xbf, 0xff, 0xff, 0xcf, 0xe3, 0xff, 0xc7, 0xf7,
-    0xff, 0xff, 0xf9, 0xfc, 0x7f, 0xf8, 0xfe, 0xff,
-    0xff, 0xff, 0x3f, 0xf, 0xff, 0xf, 0xdf, 0xff,
-    0xff, 0xe7, 0xe1, 0xff, 0xe1, 0xfb, 0xff, 0xff,
-    0xfc, 0xf8, 0x3f, 0xfc, 0x1f, 0x7f, 0xff, 0xff,
-    0x9f, 0x7, 0xff, 0x83, 0xef, 0xff, 0xff, 0xf3,
-    0xc0, 0xff, 0xf0, 0x3d, 0xff, 0xff, 0xfe, 0x70,
-    0x1f, 0xfe, 0x3, 0xbf, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfc, 0x7f, 0xff, 0xff,
-    0xff, 0xe7, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
-    0xfe, 0x7f, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff,
-    0xe7, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x7f, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xc7,
-    0xef, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x78,
-    0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 307, .box_w = 1, .box_h = 1, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1, .adv_w = 1253, .box_w = 1, .box_h = 1, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2, .adv_w = 1253, .box_w = 36, .box_h = 43, .ofs_x = 9, .ofs_y = 49},
-    {.bitmap_index = 196, .adv_w = 1253, .box_w = 60, .box_h = 96, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 916, .adv_w = 1253, .box_w = 59, .box_h = 88, .ofs_x = 9, .ofs_y = 4},
-    {.bitmap_index = 1565, .adv_w = 1253, .box_w = 56, .box_h = 96, .ofs_x = 13, .ofs_y = 0},
-    {.bitmap_index = 2237, .adv_w = 1253, .box_w = 12, .box_h = 32, .ofs_x = 33, .ofs_y = 50},
-    {.bitmap_index = 2285, .adv_w = 1253, .box_w = 8, .box_h = 68, .ofs_x = 47, .ofs_y = 14},
-    {.bitmap_index = 2353, .adv_w = 1253, .box_w = 8, .box_h = 68, .ofs_x = 23, .ofs_y = 14},
-    {.bitmap_index = 2421, .adv_w = 1253, .box_w = 45, .box_h = 68, .ofs_x = 16, .ofs_y = 14},
-    {.bitmap_index = 2804, .adv_w = 1253, .box_w = 44, .box_h = 68, .ofs_x = 17, .ofs_y = 14},
-    {.bitmap_index = 3178, .adv_w = 1253, .box_w = 8, .box_h = 27, .ofs_x = 23, .ofs_y = 14},
-    {.bitmap_index = 3205, .adv_w = 1253, .box_w = 44, .box_h = 12, .ofs_x = 17, .ofs_y = 42},
-    {.bitmap_index = 3271, .adv_w = 0, .box_w = 12, .box_h = 12, .ofs_x = -6, .ofs_y = 0},
-    {.bitmap_index = 3289, .adv_w = 1253, .box_w = 32, .box_h = 69, .ofs_x = 23, .ofs_y = 14},
-    {.bitmap_index = 3565, .adv_w = 1253, .box_w = 59, .box_h = 96, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 4273, .adv_w = 1253, .box_w = 12, .box_h = 87, .ofs_x = 57, .ofs_y = 5},
-    {.bitmap_index = 4404, .adv_w = 1253, .box_w = 59, .box_h = 96, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 5112, .adv_w = 1253, .box_w = 55, .box_h = 96, .ofs_x = 14, .ofs_y = 0},
-    {.bitmap_index = 5772, .adv_w = 1253, .box_w = 59, .box_h = 88, .ofs_x = 9, .ofs_y = 4},
-    {.bitmap_index = 6421, .adv_w = 1253, .box_w = 59, .box_h = 96, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 7129, .adv_w = 1253, .box_w = 59, .box_h = 96, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 7837, .adv_w = 1253, .box_w = 59, .box_h = 92, .ofs_x = 9, .ofs_y = 4},
-    {.bitmap_index = 8516, .adv_w = 1253, .box_w = 59, .box_h = 96, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 9224, .adv_w = 1253, .box_w = 59, .box_h = 96, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 9932, .adv_w = 307, .box_w = 12, .box_h = 51, .ofs_x = 4, .ofs_y = 21},
-    {.bitmap_index = 10009, .adv_w = 1253, .box_w = 52, .box_h = 82, .ofs_x = 13, .ofs_y = 0},
-    {.bitmap_index = 10542, .adv_w = 1253, .box_w = 51, .box_h = 54, .ofs_x = 14, .ofs_y = 0},
-    {.bitmap_index = 10887, .adv_w = 1253, .box_w = 52, .box_h = 82, .ofs_x = 13, .ofs_y = 0},
-    {.bitmap_index = 11420, .adv_w = 1253, .box_w = 60, .box_h = 83, .ofs_x = 9, .ofs_y = 13},
-    {.bitmap_index = 12043, .adv_w = 1253, .box_w = 60, .box_h = 96, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 12763, .adv_w = 1253, .box_w = 59, .box_h = 92, .ofs_x = 9, .ofs_y = 4},
-    {.bitmap_index = 13442, .adv_w = 1253, .box_w = 55, .box_h = 96, .ofs_x = 14, .ofs_y = 0},
-    {.bitmap_index = 14102, .adv_w = 1253, .box_w = 55, .box_h = 96, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 14762, .adv_w = 1253, .box_w = 55, .box_h = 96, .ofs_x = 14, .ofs_y = 0},
-    {.bitmap_index = 15422, .adv_w = 1253, .box_w = 55, .box_h = 96, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 16082, .adv_w = 1253, .box_w = 55, .box_h = 92, .ofs_x = 9, .ofs_y = 4},
-    {.bitmap_index = 16715, .adv_w = 1253, .box_w = 59, .box_h = 96, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 17423, .adv_w = 1253, .box_w = 59, .box_h = 88, .ofs_x = 9, .ofs_y = 4},
-    {.bitmap_index = 18072, .adv_w = 1253, .box_w = 50, .box_h = 96, .ofs_x = 14, .ofs_y = 0},
-    {.bitmap_index = 18672, .adv_w = 1253, .box_w = 59, .box_h = 92, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 19351, .adv_w = 1253, .box_w = 46, .box_h = 88, .ofs_x = 9, .ofs_y = 4},
-    {.bitmap_index = 19857, .adv_w = 1253, .box_w = 55, .box_h = 92, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 20490, .adv_w = 1253, .box_w = 59, .box_h = 88, .ofs_x = 9, .ofs_y = 4},
-    {.bitmap_index = 21139, .adv_w = 1253, .box_w = 59, .box_h = 88, .ofs_x = 9, .ofs_y = 4},
-    {.bitmap_index = 21788, .adv_w = 1253, .box_w = 59, .box_h = 96, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 22496, .adv_w = 1253, .box_w = 59, .box_h = 92, .ofs_x = 9, .ofs_y = 4},
-    {.bitmap_index = 23175, .adv_w = 1253, .box_w = 59, .box_h = 96, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 23883, .adv_w = 1253, .box_w = 59, .box_h = 92, .ofs_x = 9, .ofs_y = 4},
-    {.bitmap_index = 24562, .adv_w = 1253, .box_w = 59, .box_h = 96, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 25270, .adv_w = 1253, .box_w = 50, .box_h = 82, .ofs_x = 14, .ofs_y = 14},
-    {.bitmap_index = 25783, .adv_w = 1253, .box_w = 59, .box_h = 92, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 26462, .adv_w = 1253, .box_w = 46, .box_h = 88, .ofs_x = 9, .ofs_y = 4},
-    {.bitmap_index = 26968, .adv_w = 1253, .box_w = 59, .box_h = 88, .ofs_x = 9, .ofs_y = 4},
-    {.bitmap_index = 27617, .adv_w = 1253, .box_w = 32, .box_h = 68, .ofs_x = 23, .ofs_y = 14},
-    {.bitmap_index = 27889, .adv_w = 1253, .box_w = 32, .box_h = 69, .ofs_x = 23, .ofs_y = 14},
-    {.bitmap_index = 28165, .adv_w = 1253, .box_w = 52, .box_h = 96, .ofs_x = 13, .ofs_y = 0},
-    {.bitmap_index = 28789, .adv_w = 1253, .box_w = 32, .box_h = 69, .ofs_x = 23, .ofs_y = 14},
-    {.bitmap_index = 29065, .adv_w = 1253, .box_w = 22, .box_h = 43, .ofs_x = 9, .ofs_y = 49},
-    {.bitmap_index = 29184, .adv_w = 1253, .box_w = 51, .box_h = 12, .ofs_x = 14, .ofs_y = 0},
-    {.bitmap_index = 29261, .adv_w = 1253, .box_w = 8, .box_h = 27, .ofs_x = 23, .ofs_y = 56},
-    {.bitmap_index = 29288, .adv_w = 1253, .box_w = 59, .box_h = 92, .ofs_x = 9, .ofs_y = 4},
-    {.bitmap_index = 29967, .adv_w = 1253, .box_w = 55, .box_h = 96, .ofs_x = 14, .ofs_y = 0},
-    {.bitmap_index = 30627, .adv_w = 1253, .box_w = 55, .box_h = 96, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 31287, .adv_w = 1253, .box_w = 55, .box_h = 96, .ofs_x = 14, .ofs_y = 0},
-    {.bitmap_index = 31947, .adv_w = 1253, .box_w = 55, .box_h = 96, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 32607, .adv_w = 1253, .box_w = 55, .box_h = 92, .ofs_x = 9, .ofs_y = 4},
-    {.bitmap_index = 33240, .adv_w = 1253, .box_w = 59, .box_h = 96, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 33948, .adv_w = 1253, .box_w = 59, .box_h = 88, .ofs_x = 9, .ofs_y = 4},
-    {.bitmap_index = 34597, .adv_w = 1253, .box_w = 50, .box_h = 96, .ofs_x = 14, .ofs_y = 0},
-    {.bitmap_index = 35197, .adv_w = 1253, .box_w = 59, .box_h = 92, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 35876, .adv_w = 1253, .box_w = 46, .box_h = 88, .ofs_x = 9, .ofs_y = 4},
-    {.bitmap_index = 36382, .adv_w = 1253, .box_w = 55, .box_h = 92, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 37015, .adv_w = 1253, .box_w = 59, .box_h = 88, .ofs_x = 9, .ofs_y = 4},
-    {.bitmap_index = 37664, .adv_w = 1253, .box_w = 59, .box_h = 88, .ofs_x = 9, .ofs_y = 4},
-    {.bitmap_index = 38313, .adv_w = 1253, .box_w = 59, .box_h = 96, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 39021, .adv_w = 1253, .box_w = 59, .box_h = 92, .ofs_x = 9, .ofs_y = 4},
-    {.bitmap_index = 39700, .adv_w = 1253, .box_w = 59, .box_h = 96, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 40408, .adv_w = 1253, .box_w = 59, .box_h = 92, .ofs_x = 9, .ofs_y = 4},
-    {.bitmap_index = 41087, .adv_w = 1253, .box_w = 59, .box_h = 96, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 41795, .adv_w = 1253, .box_w = 50, .box_h = 82, .ofs_x = 14, .ofs_y = 14},
-    {.bitmap_index = 42308, .adv_w = 1253, .box_w = 59, .box_h = 92, .ofs_x = 9, .ofs_y = 0},
-    {.bitmap_index = 42987, .adv_w = 1253, .box_w = 46, .box_h = 88, .ofs_x = 9, .ofs_y = 4},
-    {.bitmap_index = 43493, .adv_w = 1253, .box_w = 59, .box_h = 88, .ofs_x = 9, .ofs_y = 4},
-    {.bitmap_index = 44142, .adv_w = 1253, .box_w = 32, .box_h = 68, .ofs_x = 23, .ofs_y = 14},
-    {.bitmap_index = 44414, .adv_w = 1253, .box_w = 32, .box_h = 69, .ofs_x = 23, .ofs_y = 14},
-    {.bitmap_index = 44690, .adv_w = 1253, .box_w = 52, .box_h = 96, .ofs_x = 13, .ofs_y = 0},
-    {.bitmap_index = 45314, .adv_w = 1253, .box_w = 12, .box_h = 68, .ofs_x = 33, .ofs_y = 14},
-    {.bitmap_index = 45416, .adv_w = 1253, .box_w = 59, .box_h = 96, .ofs_x = 9, .ofs_y = 0}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint8_t glyph_id_ofs_list_3[] = {
-    0, 0, 1, 2, 3, 4, 5, 6,
-    7, 8, 9, 10, 11, 12, 13, 14,
-    15, 16, 17, 18, 19, 20, 21, 22,
-    23, 24, 25, 26, 27, 28, 29, 0,
-    30, 0, 31
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 3, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 36, .range_length = 23, .glyph_id_start = 4,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 60, .range_length = 31, .glyph_id_start = 27,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 92, .range_length = 35, .glyph_id_start = 58,
-        .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_3, .list_length = 35, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL
-    }
-};
-
-
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = NULL,
-    .kern_scale = 0,
-    .cmap_num = 4,
-    .bpp = 1,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-    .cache = &cache
-#endif
-
-};
-
-extern const lv_font_t lv_font_montserrat_48;
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t dseg14_96 = {
-#else
-lv_font_t dseg14_96 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 96,          /*The maximum line height required by the font*/
-    .base_line = 0,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -12,
-    .underline_thickness = 5,
-#endif
-    .static_bitmap = 0,
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-    .fallback = &lv_font_montserrat_48,
-#endif
-    .user_data = NULL,
-};
-
-
-
-#endif /*#if DSEG14_96*/
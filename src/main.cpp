@@ -4,27 +4,59 @@
 #include "I2C_Driver.h"
 #include "Display_ST7701.h"
 #include "TCA9554PWR.h"
+#include "Needle_LUT.h"
+#include "Ring_Indicator.h"
+#include "Digit_Cache.h"
+#include "Numeric_Display.h"
+#include "Render_Stats.h"
+#include "Frame_Snapshot.h"
+#include "Image_Cache.h"
+#include "Needle_Sprites.h"
+#include "Static_Layer.h"
+#include "Blend_Kernels.h"
+#include "Frame_Profiler.h"
+#include "Metrics.h"
+#include "Event_Trace.h"
+#include "Redraw_Heatmap.h"
+#include "Channel_History.h"
+#include "Trend_Graph.h"
+#include "Shift_Light.h"
+#include "Color_Palette.h"
+#include "Arc_Fill.h"
+#include "Gauge_Descriptors.h"
+#include "Gauge_Update.h"
+#include "render_bench.h"
+#include "images/tabby_needle.h"
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
+#include <freertos/semphr.h>
 #include "freertos/queue.h"
 #include <WiFi.h>
 #include <WebServer.h>
 #include <Preferences.h>
 #include <esp_now.h>
 #include <esp_wifi.h>
+#include <esp_heap_caps.h>
 #include <math.h>
 
 // --- CONFIGURATION ---
 bool test_mode_enabled = false; 
 bool show_perf_stats = false; 
+bool show_heatmap = false;     // Redraw heat map overlay (debug)
+bool dash_view = false;        // Multi-channel tiles instead of the single gauge
+bool show_trend = false;       // Sparkline of the current channel under the value
+bool shift_light = false;      // RPM shift-light arc over the dial
+bool ring_gradient = false;    // Ring colour follows the value smoothly instead of by zone
+bool show_arc = false;         // Zone-coloured arc filled up to the value
+int shift_start_rpm = 5000;    // First segment lights
+int shift_rpm = 7000;          // All segments flash
 bool peak_hold_enabled = true; // New Toggle
+bool needle_image = false;     // Pre-rotated tabby_needle sprite instead of the line
+bool bg_artwork = false;       // gauge_bg under the static layer
 
 enum GaugeMode { MODE_BOOST=0, MODE_AFR=1, MODE_WATER=2, MODE_OIL=3 };
 
-LV_FONT_DECLARE(dseg14_60);
-LV_FONT_DECLARE(dseg14_96);
-LV_FONT_DECLARE(dseg14_120)
-// LV_IMG_DECLARE(gauge_bg);
+extern const img_pack_t gauge_bg_pack;  // LZ4-packed artwork, see Image_Cache
 
 QueueHandle_t canMsgQueue;
 #define CAN_QUEUE_LENGTH 32
@@ -34,6 +66,7 @@ typedef struct {
   float boost_psi; float afr_gas; int rpm; int water_temp_c; float oil_press_psi;
 } HaltechData_t;
 HaltechData_t HaltechData;
+SemaphoreHandle_t can_data_lock;  // Held by the CAN task per frame, and by a golden case throughout
 
 Preferences preferences;
 WebServer server(80);
@@ -46,14 +79,21 @@ uint32_t color_link_icon = 0x00C851; // Connectivity icon (green)
 uint32_t needle_color = 0xFF6600;     // Needle color (orange)
 uint32_t color_peak = 0xFFFFFF;      // Peak stripe (white)
 uint32_t color_background = 0x000000; // Screen background (black)
-uint32_t current_applied_text = 0;
 int current_brightness = 40;
 // Forward declarations
+void build_screen();
+void apply_theme();
+void static_layer_sync();
+void update_gauge_master(unsigned long now_ms);
+void set_channel_value(GaugeMode mode, float v);
+void input_changed();
+void request_mode(int m);
+void dash_create();
+void dash_update(bool force);
+void set_view(bool dash);
+void trend_rebuild();
 
-float displayed_val = 0.0; 
-float target_val = 0.0;
-float peak_val = -999.0;
-unsigned long peak_timer = 0;
+gauge_state_t gauge = { 0.0f, 0.0f, -999.0f, 0, 0, 1 };  // Filter, peak and zone of the current mode
 const unsigned long PEAK_HOLD_TIME = 30000;
 unsigned long last_data_time = 0;
 unsigned long last_broadcast = 0;
@@ -62,13 +102,86 @@ unsigned long last_broadcast = 0;
 unsigned long perf_last_time = 0;
 int perf_frames = 0;
 int perf_fps = 0;
-int perf_frame_ms = 0;
 
 volatile bool flag_new_peer = false;
-volatile bool flag_reboot = false;
+volatile int pending_mode = -1;   // Mode change requested from the web UI / ESP-NOW, applied by loop()
 volatile bool flag_theme_update = false; 
 volatile bool flag_bright_update = false;
 volatile bool flag_stats_update = false;
+volatile bool flag_heatmap_update = false;
+volatile bool flag_bench = false;
+volatile bool flag_needle_update = false;
+
+// --- IDLE-AWARE SCHEDULING ---
+// Every new sample bumps input_gen. While it stands still, the value has settled
+// and no animation runs, loop() skips the gauge update, LVGL refreshes at the
+// idle period and the task sleeps until new data notifies it.
+#define IDLE_REFR_PERIOD 100   // LVGL refresh period while idle [ms]
+#define IDLE_POLL_MS     50    // Longest idle sleep (web server, ESP-NOW flags)
+volatile uint32_t input_gen = 0;
+uint32_t input_gen_seen = 0;
+volatile bool render_idle = false;
+TaskHandle_t loop_task = NULL;
+uint32_t loop_sleep_us = 0;       // Time blocked in the current 1 s window
+unsigned long load_window_start = 0;
+int loop_load_pct = 100;          // CPU share of the UI loop over the last second
+
+// Exported at /metrics; registered once in setup(), updated lock-free from any task
+metric_t *m_can_frames, *m_can_changes, *m_espnow_rx, *m_frames, *m_px, *m_render_us;
+metric_t *m_boost, *m_afr, *m_rpm, *m_water, *m_oil, *m_displayed, *m_fps, *m_load, *m_idle;
+metric_t *m_img_hits, *m_img_misses, *m_img_evictions, *m_img_bytes, *m_img_decode_us;
+// Event trace: a CAN frame is one flow (rx -> decode -> update -> refresh),
+// numbered identically on both sides of canMsgQueue since it never reorders
+uint16_t tr_can_rx, tr_can_decode, tr_can_flow, tr_queue, tr_update, tr_lvgl, tr_render, tr_idle, tr_espnow;
+uint32_t can_rx_seq = 0, can_proc_seq = 0;
+volatile uint32_t input_flow = 0;   // Flow id of the last frame that changed a reading
+uint32_t flow_updated = 0, flow_pending = 0;
+
+void trace_setup() {
+  trace_init(getCpuFrequencyMhz());
+  tr_can_rx = trace_name("can_rx");         tr_can_decode = trace_name("can_decode");
+  tr_can_flow = trace_name("can_frame");    tr_queue = trace_name("can_queue_depth");
+  tr_update = trace_name("update");         tr_lvgl = trace_name("lv_timer_handler");
+  tr_render = trace_name("refresh");        tr_idle = trace_name("idle");
+  tr_espnow = trace_name("espnow_rx");
+}
+
+static const float RENDER_US_BOUNDS[] = { 500, 1000, 2000, 5000, 10000, 20000, 50000 };
+
+void metrics_init() {
+  m_can_frames  = metric_counter("gauge_can_frames_total", "CAN frames processed");
+  m_can_changes = metric_counter("gauge_can_changes_total", "CAN frames that changed a reading");
+  m_espnow_rx   = metric_counter("gauge_espnow_rx_total", "ESP-NOW packets received");
+  m_frames      = metric_counter("gauge_frames_total", "Display refreshes that did work");
+  m_px          = metric_counter("gauge_px_touched_total", "Pixels rendered and flushed");
+  m_render_us   = metric_histogram("gauge_render_us", "Refresh time, render + flush (us)", RENDER_US_BOUNDS, 7);
+  m_boost       = metric_gauge("gauge_boost_psi", "Boost (psi)");
+  m_afr         = metric_gauge("gauge_afr", "Air/fuel ratio");
+  m_rpm         = metric_gauge("gauge_rpm", "Engine speed (rpm)");
+  m_water       = metric_gauge("gauge_water_temp_c", "Coolant temperature (C)");
+  m_oil         = metric_gauge("gauge_oil_press_psi", "Oil pressure (psi)");
+  m_displayed   = metric_gauge("gauge_displayed_value", "Value currently shown by the gauge");
+  m_fps         = metric_gauge("gauge_fps", "Refreshes over the last second");
+  m_load        = metric_gauge("gauge_loop_load_pct", "UI loop CPU share over the last second");
+  m_idle        = metric_gauge("gauge_render_idle", "1 while the UI loop is idling");
+  m_img_hits      = metric_counter("gauge_image_cache_hits_total", "Image cache lookups served decoded");
+  m_img_misses    = metric_counter("gauge_image_cache_misses_total", "Image cache lookups that decoded");
+  m_img_evictions = metric_counter("gauge_image_cache_evictions_total", "Images evicted for the budget");
+  m_img_bytes     = metric_gauge("gauge_image_cache_bytes", "Decoded image bytes held in PSRAM");
+  m_img_decode_us = metric_counter("gauge_image_cache_decode_us_total", "Time spent decoding images (us)");
+}
+
+// Image_Cache keeps its own counters; copied into the registry on each scrape
+void image_cache_metrics_sync() {
+  static image_cache_stats_t seen = {};
+  image_cache_stats_t st = image_cache_stats();
+  metric_add(m_img_hits, st.hits - seen.hits);
+  metric_add(m_img_misses, st.misses - seen.misses);
+  metric_add(m_img_evictions, st.evictions - seen.evictions);
+  metric_add(m_img_decode_us, st.total_decode_us - seen.total_decode_us);
+  metric_set(m_img_bytes, st.bytes_used);
+  seen = st;
+}
 
 #define WIFI_CHANNEL 1
 typedef struct __attribute__((packed)) { 
@@ -82,16 +195,56 @@ typedef struct { uint8_t mac[6]; int mode; unsigned long last_seen; } PeerGauge;
 PeerGauge fleet[10]; int fleet_count = 0;
 
 lv_obj_t *main_scr;
-lv_obj_t *val_label_int;
-lv_obj_t *val_label_dec;
+// Shared theme styles: a theme change updates these in place
+lv_style_t style_screen, style_mode_label, style_link_icon, style_peak, style_perf;
+lv_style_t style_tile, style_caption, style_track, style_value;
+uint32_t applied_text = 0, applied_bg = 0, applied_needle = 0;  // Colours baked into caches
+uint32_t applied_label = 0, applied_icon = 0;                     // ... and into the static layer
+unsigned long theme_apply_us = 0;
+lv_obj_t *val_display = NULL;
+digit_cache_t digits_int, digits_dec;   // Glyph coverage tiles for the value display
+numeric_display_t value_disp;           // "-15" + ".0" in fixed DSEG cells
+#define VALUE_INT_CELLS 3
+#define VALUE_DECIMALS  1
+#define VALUE_INT_HEIGHT 120            // Digit heights in px (former dseg14_120 / dseg14_96)
+#define VALUE_DEC_HEIGHT 96
 lv_obj_t *mode_label;
+lv_obj_t *dash_root = NULL;      // Live tile widgets (numeric + bar)
+lv_obj_t *dash_static = NULL;    // Tile frames and captions, under static_root
+digit_cache_t digits_tile;
+#define DASH_DIGIT_HEIGHT 34   // 27 px cells: "-15.0" fits a tile
+bool dash_recolor = false;
+trend_graph_t trend;
+lv_obj_t *trend_obj = NULL;
+#define TREND_W 240             // One column per 300 ms of history: 72 s
+#define TREND_H 40
+#define TREND_PER_COL 3         // 100 ms history buckets per column
+lv_obj_t *shift_obj = NULL;
+volatile uint32_t shift_state = 0;  // Computed by the CAN task, shown by loop()
+history_point_t trend_points[TREND_W * TREND_PER_COL];  // Query buffer, also used by /history
+lv_obj_t *static_root;   // Hidden parent of the static widgets, flattened by Static_Layer
+lv_obj_t *bg_art;
+bool static_dirty = false;  // Static layer needs a rebuild before the next frame
 lv_obj_t *link_icon; 
 lv_obj_t *bar; lv_obj_t *peak_dot;
 lv_obj_t *perf_label;
-lv_obj_t *needle_tip; 
+lv_obj_t *needle_tip = NULL; 
+arc_fill_t arc_fill;      // Filled from the start of the sweep to the needle
+lv_obj_t *arc_obj = NULL;
+#define ARC_R_IN  192     // Inside the needle's 185..225 band, so it only covers swept pixels
+#define ARC_R_OUT 210
+needle_seg_t needle_seg;  // Endpoints currently drawn by needle_tip
+uint16_t needle_idx = 0;  // LUT step currently drawn (selects the sprite)
+bool needle_drawn_image = false;
+#define NEEDLE_WIDTH 8
 
-const float RANGES[4][2] = { {-15,30}, {8,22}, {0,120}, {0,100} };
-const char* MODE_NAMES[4] = { "BOOST", "AFR", "WATER", "OIL P" };
+// Ranges, zones, smoothing and sweep per mode: GAUGES in Gauge_Descriptors.h
+static_assert(GAUGE_COUNT == MODE_OIL + 1, "One descriptor per GaugeMode");
+#define ZONE_COLOR(z) ((z) == 0 ? color_low : (z) == 1 ? color_mid : color_high)
+palette_t mode_palette[4];    // Gradient ring colours, rebuilt by apply_theme()
+uint16_t zone_565[3];         // Zone colours in panel format, likewise
+int32_t ring_shown565 = -1;   // Ring colour currently drawn (RGB565), -1 = none yet
+uint32_t zone_color = 0x4CAF50;
 
 bool receiving_data = false;
 volatile bool data_ready = false;
@@ -121,14 +274,15 @@ void update_peer_list(const uint8_t *mac, int mode) {
 void OnDataRecv(const esp_now_recv_info_t * info, const uint8_t *incomingData, int len) {
   const uint8_t* mac = info->src_addr;
   if (len != sizeof(EspNowPacket)) return;
+  metric_inc(m_espnow_rx);
+  trace_instant(tr_espnow, incomingData[0]);
   EspNowPacket *pkt = (EspNowPacket *)incomingData;
 
   if (pkt->type == 1) { 
     update_peer_list(mac, pkt->mode);
   } 
   else if (pkt->type == 2) { 
-    preferences.begin("gauge", false); preferences.putInt("mode", pkt->mode); preferences.end();
-    flag_reboot = true; 
+    request_mode(pkt->mode);
   }
   else if (pkt->type == 3) { 
     text_color = pkt->c1; color_low = pkt->c2; color_mid = pkt->c3; color_high = pkt->c4;
@@ -227,8 +381,17 @@ void handleRoot() {
   html += "<div class='card'><h3>LOCAL GAUGE</h3>";
   // PEAK TOGGLE
   html += "<a href='/peak?p=" + String(!peak_hold_enabled) + "'><button class='btn'>Peak Hold: " + String(peak_hold_enabled?"ON":"OFF") + "</button></a><br>";
+  html += "<a href='/needle?i=" + String(!needle_image) + "'><button class='btn'>Needle: " + String(needle_image?"IMAGE":"LINE") + "</button></a><br>";
+  html += "<a href='/artwork?a=" + String(!bg_artwork) + "'><button class='btn'>Artwork: " + String(bg_artwork?"ON":"OFF") + "</button></a><br>";
+  html += "<a href='/view?d=" + String(!dash_view) + "'><button class='btn'>View: " + String(dash_view?"DASH":"GAUGE") + "</button></a><br>";
+  html += "<a href='/trend?t=" + String(!show_trend) + "'><button class='btn'>Trend: " + String(show_trend?"ON":"OFF") + "</button></a><br>";
+  html += "<a href='/arc?a=" + String(!show_arc) + "'><button class='btn'>Arc Fill: " + String(show_arc?"ON":"OFF") + "</button></a><br>";
+  html += "<a href='/ring?g=" + String(!ring_gradient) + "'><button class='btn'>Ring: " + String(ring_gradient?"GRADIENT":"ZONES") + "</button></a><br>";
+  html += "<a href='/shift?s=" + String(!shift_light) + "'><button class='btn'>Shift Light: " + String(shift_light?"ON":"OFF") + "</button></a><br>";
+  html += "<form action='/shift' method='get'><label>Start:</label><input type='number' name='lo' min='0' max='20000' step='100' value='" + String(shift_start_rpm) + "'> <label>Shift:</label><input type='number' name='hi' min='0' max='20000' step='100' value='" + String(shift_rpm) + "'> <button style='width:auto;'>Set RPM</button></form>";
+  html += "<a href='/heatmap?h=" + String(!show_heatmap) + "'><button class='btn'>Heat Map: " + String(show_heatmap?"ON":"OFF") + "</button></a><br>";
   
-  html += "<p>Mode: <strong>" + String(MODE_NAMES[current_mode]) + "</strong></p>";
+  html += "<p>Mode: <strong>" + String(GAUGES[current_mode].name) + "</strong> (" + GAUGES[current_mode].units + ")</p>";
   html += "<a href='/set?mode=0'><button class='btn-b'>Boost</button></a>";
   html += "<a href='/set?mode=1'><button class='btn-a'>AFR</button></a>";
   html += "<a href='/set?mode=2'><button class='btn-w'>Water</button></a>";
@@ -242,7 +405,7 @@ void handleRoot() {
             String macStr = "";
             for(int j=0; j<6; j++) { if(j>0) macStr += ":"; char buf[3]; sprintf(buf, "%02X", fleet[i].mac[j]); macStr += buf; }
             String macClean = macStr; macClean.replace(":", ""); 
-            html += "<div class='card'><h4>Gauge " + macClean.substring(9) + "</h4><p>" + String(MODE_NAMES[fleet[i].mode]) + "</p><a href='/rem?mac=" + macClean + "&mode=0'><button class='btn-b'>Boost</button></a><a href='/rem?mac=" + macClean + "&mode=1'><button class='btn-a'>AFR</button></a><a href='/rem?mac=" + macClean + "&mode=2'><button class='btn-w'>Water</button></a><a href='/rem?mac=" + macClean + "&mode=3'><button class='btn-o'>Oil</button></a></div>";
+            html += "<div class='card'><h4>Gauge " + macClean.substring(9) + "</h4><p>" + String(GAUGES[fleet[i].mode].name) + "</p><a href='/rem?mac=" + macClean + "&mode=0'><button class='btn-b'>Boost</button></a><a href='/rem?mac=" + macClean + "&mode=1'><button class='btn-a'>AFR</button></a><a href='/rem?mac=" + macClean + "&mode=2'><button class='btn-w'>Water</button></a><a href='/rem?mac=" + macClean + "&mode=3'><button class='btn-o'>Oil</button></a></div>";
         }
     }
   }
@@ -265,9 +428,8 @@ void handleTheme() {
 }
 void handleSet() {
     if (server.hasArg("mode")) {
-        int m = server.arg("mode").toInt();
-        preferences.begin("gauge", false); preferences.putInt("mode", m); preferences.end();
-        ESP.restart();
+        request_mode(server.arg("mode").toInt());
+        server.sendHeader("Location", "/"); server.send(303);
     }
 }
 void handleTest() {
@@ -297,6 +459,86 @@ void handlePeak() {
         server.sendHeader("Location", "/"); server.send(303);
     }
 }
+void handleView() {
+    if (server.hasArg("d")) {
+        bool d = server.arg("d").toInt();
+        if (d != dash_view) set_view(d);
+        preferences.begin("gauge", false); preferences.putBool("dash", dash_view); preferences.end();
+        server.sendHeader("Location", "/"); server.send(303);
+    }
+}
+void handleArc() {
+    if (server.hasArg("a")) {
+        show_arc = server.arg("a").toInt();
+        preferences.begin("gauge", false); preferences.putBool("arc", show_arc); preferences.end();
+        if (arc_obj) {
+            if (show_arc && !dash_view) lv_obj_clear_flag(arc_obj, LV_OBJ_FLAG_HIDDEN);
+            else lv_obj_add_flag(arc_obj, LV_OBJ_FLAG_HIDDEN);
+        }
+        input_changed();  // Bring the fill up to the needle
+        server.sendHeader("Location", "/"); server.send(303);
+    }
+}
+void handleRing() {
+    if (server.hasArg("g")) {
+        ring_gradient = server.arg("g").toInt();  // Next update picks the ring colour from the other table
+        preferences.begin("gauge", false); preferences.putBool("rgrad", ring_gradient); preferences.end();
+        input_changed();
+        server.sendHeader("Location", "/"); server.send(303);
+    }
+}
+void handleShift() {
+    if (server.hasArg("s")) {
+        shift_light = server.arg("s").toInt();
+        if (shift_obj) {
+            if (shift_light && !dash_view) lv_obj_clear_flag(shift_obj, LV_OBJ_FLAG_HIDDEN);
+            else lv_obj_add_flag(shift_obj, LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+    if (server.hasArg("lo") && server.hasArg("hi")) {
+        int lo = server.arg("lo").toInt(), hi = server.arg("hi").toInt();
+        if (lo < 0 || hi <= lo) { server.send(400, "text/plain", "Bad Request"); return; }
+        shift_start_rpm = lo; shift_rpm = hi;
+        shift_light_set_rpm_range(lo, hi);
+        shift_state = shift_light_state(HaltechData.rpm);
+    }
+    preferences.begin("gauge", false);
+    preferences.putBool("shift", shift_light); preferences.putInt("rpm_lo", shift_start_rpm); preferences.putInt("rpm_sh", shift_rpm);
+    preferences.end();
+    server.sendHeader("Location", "/"); server.send(303);
+}
+void handleHeatmap() {
+    if (server.hasArg("h")) show_heatmap = server.arg("h").toInt();
+    flag_heatmap_update = true;
+    server.sendHeader("Location", "/"); server.send(303);
+}
+void handleNeedle() {
+    if (server.hasArg("i")) {
+        needle_image = server.arg("i").toInt();
+        preferences.begin("gauge", false); preferences.putBool("nimg", needle_image); preferences.end();
+        flag_needle_update = true;
+        server.sendHeader("Location", "/"); server.send(303);
+    }
+}
+void handleArtwork() {
+    if (server.hasArg("a")) {
+        bg_artwork = server.arg("a").toInt();
+        preferences.begin("gauge", false); preferences.putBool("bgart", bg_artwork); preferences.end();
+        static_dirty = true;
+        server.sendHeader("Location", "/"); server.send(303);
+    }
+}
+void handleTrend() {
+    if (server.hasArg("t")) {
+        show_trend = server.arg("t").toInt();
+        preferences.begin("gauge", false); preferences.putBool("trend", show_trend); preferences.end();
+        if (trend_obj) {
+            if (show_trend && !dash_view) { trend_rebuild(); lv_obj_clear_flag(trend_obj, LV_OBJ_FLAG_HIDDEN); }
+            else lv_obj_add_flag(trend_obj, LV_OBJ_FLAG_HIDDEN);
+        }
+        server.sendHeader("Location", "/"); server.send(303);
+    }
+}
 void handleRemote() {
     if (server.hasArg("mac") && server.hasArg("mode")) {
       String macStr = server.arg("mac");
@@ -308,6 +550,246 @@ void handleRemote() {
     } else { server.send(400, "text/plain", "Bad Request"); }
 }
 
+// Frame profiler history as CSV, oldest second first
+void handleProfile() {
+    String csv = "t_ms,stage,count,min_us,avg_us,p99_us,max_us\n";
+    for (int i = 0; i < prof_history_count(); i++) {
+        const prof_summary_t *ps = prof_history(i);
+        for (int k = 0; k < PROF_STAGE_COUNT; k++) {
+            const prof_stat_t *st = &ps->stage[k];
+            csv += String(ps->t_ms) + "," + prof_stage_name((prof_stage_t)k) + "," + String(st->count) + "," +
+                   String(st->min_us) + "," + String(st->avg_us) + "," + String(st->p99_us) + "," + String(st->max_us) + "\n";
+        }
+    }
+    server.send(200, "text/csv", csv);
+}
+
+// Prometheus text exposition, or compact JSON with ?format=json
+void handleMetrics() {
+    static char buf[6144];  // Static: web handlers run on the small loop stack
+    image_cache_metrics_sync();
+    if (server.arg("format") == "json") {
+        metrics_format_json(buf, sizeof(buf));
+        server.send(200, "application/json", buf);
+    } else {
+        metrics_format_prometheus(buf, sizeof(buf));
+        server.send(200, "text/plain; version=0.0.4", buf);
+    }
+}
+
+// /history?ch=0..4&s=seconds (>= 1)&n=points: the last s seconds of a channel at the
+// finest level that fits in n points. ?bench=1 times one query per level.
+void handleHistory() {
+    const int max_n = TREND_W * TREND_PER_COL;
+    int ch = server.hasArg("ch") ? server.arg("ch").toInt() : current_mode;
+    // Spans past what the 10 s level retains just return all of it
+    long s = server.hasArg("s") ? server.arg("s").toInt() : 60;
+    if (s < 1) { server.send(400, "text/plain", "Bad Request"); return; }
+    uint32_t max_s = history_stats()->capacity[HISTORY_10S] * (history_bucket_ms(HISTORY_10S) / 1000);
+    uint32_t span_ms = LV_MIN((uint32_t)s, LV_MAX(max_s, 1u)) * 1000;
+    int n = server.hasArg("n") ? LV_CLAMP(1, server.arg("n").toInt(), max_n) : 240;
+    uint32_t now = millis();
+    uint32_t from = now > span_ms ? now - span_ms : 0;
+    String out = "{";
+    if (server.arg("bench") == "1") {
+        out += "\"bench\":[";
+        for (int l = 0; l < HISTORY_LEVELS; l++) {
+            int got = history_query(ch, (history_level_t)l, 0, now, trend_points, max_n);
+            uint32_t us = history_stats()->last_query_us;
+            out += String(l ? "," : "") + "{\"level\":" + l + ",\"points\":" + got + ",\"us\":" + us +
+                   ",\"ns_per_point\":" + (got ? us * 1000 / got : 0) + "}";
+        }
+        out += "],";
+    } else {
+        history_level_t level = history_level_for(span_ms, n);
+        int got = history_query(ch, level, from, now, trend_points, n);
+        String t = "", mn = "", mx = "", avg = "";
+        for (int i = 0; i < got; i++) {
+            if (i) { t += ','; mn += ','; mx += ','; avg += ','; }
+            t += trend_points[i].t_ms; mn += String(trend_points[i].min, 2);
+            mx += String(trend_points[i].max, 2); avg += String(trend_points[i].avg, 2);
+        }
+        out += "\"ch\":" + String(ch) + ",\"level\":" + (int)level + ",\"bucket_ms\":" + history_bucket_ms(level) +
+               ",\"t\":[" + t + "],\"min\":[" + mn + "],\"max\":[" + mx + "],\"avg\":[" + avg + "],";
+    }
+    const history_stats_t *hs = history_stats();
+    out += "\"stats\":{\"appends\":" + String(hs->appends) + ",\"append_avg_cycles\":" + hs->append_avg_cycles +
+           ",\"append_max_cycles\":" + hs->append_max_cycles + ",\"bytes\":" + (uint32_t)hs->bytes +
+           ",\"capacity\":[" + hs->capacity[0] + "," + hs->capacity[1] + "," + hs->capacity[2] + "," + hs->capacity[3] + "]}}";
+    server.send(200, "application/json", out);
+}
+
+// /trace?cmd=start|stop, or no argument to download the binary dump
+// (stops recording). Convert with tools/trace2chrome.py.
+void trace_write_chunk(const void *data, size_t len, void *ctx) {
+    server.sendContent((const char *)data, len);
+}
+
+void handleTrace() {
+    String cmd = server.arg("cmd");
+    if (cmd == "start") { trace_start(); server.send(200, "text/plain", "Trace: recording"); return; }
+    if (cmd == "stop") { trace_stop(); server.send(200, "text/plain", "Trace: stopped"); return; }
+    trace_stop();
+    server.sendHeader("Content-Disposition", "attachment; filename=trace.bin");
+    server.setContentLength(trace_export_size());
+    server.send(200, "application/octet-stream", "");
+    trace_export(trace_write_chunk, NULL);
+}
+
+void handleBench() {
+    flag_bench = true;  // Runs from loop(), results go to Serial
+    server.send(200, "text/plain", "Render bench started, see serial output");
+}
+
+// A/B switch between the packed blend kernels and LVGL's stock loops: take
+// /golden references with k=0, switch to k=1 and compare (expect max_delta=0)
+void handleKernels() {
+    if (server.hasArg("k")) blend_kernels_enabled = server.arg("k").toInt();
+    server.send(200, "text/plain", String("Blend kernels: ") + (blend_kernels_enabled ? "ON" : "OFF"));
+}
+
+// --- FRAME SNAPSHOTS ---
+// Fixed golden scenarios: mode, value and theme (0 = factory, 1 = alternate).
+// /golden?case=N returns the frame as BMP for storing off-device; ref=1 keeps it
+// as the in-RAM reference and cmp=1 (or /golden with no case) diffs against it,
+// so render changes toggled at runtime can be checked for visual regressions.
+typedef struct { GaugeMode mode; float value; int theme; } GoldenCase;
+const GoldenCase GOLDEN_CASES[] = {
+    { MODE_BOOST, -10.0, 0 }, { MODE_BOOST, 12.3, 0 }, { MODE_BOOST, 25.0, 1 },
+    { MODE_AFR, 14.7, 0 }, { MODE_WATER, 90.0, 0 }, { MODE_OIL, 55.5, 1 },
+};
+#define GOLDEN_CASE_COUNT ((int)(sizeof(GOLDEN_CASES) / sizeof(GOLDEN_CASES[0])))
+#define GOLDEN_TOLERANCE 8        // Per-channel delta (8-bit scale) counted as equal
+#define GOLDEN_MAX_DIFF_PPM 500   // Differing pixels allowed per million
+// ct, cl, cm, ch, cbg, cml, cli, cn, cp
+const uint32_t GOLDEN_THEMES[2][9] = {
+    { 0xFFD700, 0x2196F3, 0x4CAF50, 0xF44336, 0x000000, 0x969696, 0x00C851, 0xFF6600, 0xFFFFFF },
+    { 0x00E5FF, 0x3F51B5, 0xFFEB3B, 0xFF1744, 0x101010, 0xCCCCCC, 0x00C851, 0xFFFFFF, 0xFF00FF },
+};
+uint16_t *snap_buf = NULL;
+uint16_t *golden_ref[GOLDEN_CASE_COUNT];
+
+void get_theme(uint32_t *t) {
+    t[0] = text_color; t[1] = color_low; t[2] = color_mid; t[3] = color_high; t[4] = color_background;
+    t[5] = color_mode_label; t[6] = color_link_icon; t[7] = needle_color; t[8] = color_peak;
+}
+void set_theme(const uint32_t *t) {
+    text_color = t[0]; color_low = t[1]; color_mid = t[2]; color_high = t[3]; color_background = t[4];
+    color_mode_label = t[5]; color_link_icon = t[6]; needle_color = t[7]; color_peak = t[8];
+}
+
+// Finish any pending render, then copy the live framebuffer out
+bool take_snapshot() {
+    if (!snap_buf) snap_buf = fb_snapshot_alloc();
+    uint16_t *fb = lcd_get_framebuffer();
+    if (!snap_buf || !fb) return false;
+    static_layer_sync();
+    lv_refr_now(NULL);
+    fb_snapshot_copy(snap_buf, fb);
+    return true;
+}
+
+void send_snapshot_bmp() {
+    uint8_t hdr[FB_BMP_HEADER_SIZE];
+    size_t n = fb_bmp_header(hdr, FB_SNAP_W, FB_SNAP_H);
+    server.setContentLength(n + FB_SNAP_PIXELS * sizeof(uint16_t));
+    server.send(200, "image/bmp", "");
+    server.sendContent((const char *)hdr, n);
+    const int rows = 16;
+    for (int y = 0; y < FB_SNAP_H; y += rows) {
+        server.sendContent((const char *)(snap_buf + y * FB_SNAP_W), rows * FB_SNAP_W * sizeof(uint16_t));
+    }
+}
+
+// Renders one case over the live state and puts it all back: CAN decoding
+// waits on can_data_lock meanwhile, so the frame and the restored readings are
+// never mixed with a frame that arrived in between
+bool render_golden_case(const GoldenCase *gc) {
+    xSemaphoreTake(can_data_lock, portMAX_DELAY);
+    HaltechData_t saved_data = HaltechData;
+    gauge_state_t saved_gauge = gauge;
+    uint32_t saved_theme[9]; get_theme(saved_theme);
+    GaugeMode saved_mode = current_mode;
+    bool saved_stats = show_perf_stats, saved_test = test_mode_enabled, saved_dash = dash_view;
+    bool saved_gradient = ring_gradient;
+    if (saved_dash) set_view(false);  // References are of the gauge view
+    ring_gradient = false;            // ... with the zone-coloured ring
+
+    // Consecutive cases mostly share a theme: only re-theme when it differs
+    bool retheme = memcmp(saved_theme, GOLDEN_THEMES[gc->theme], sizeof(saved_theme)) != 0;
+    set_theme(GOLDEN_THEMES[gc->theme]);
+    current_mode = gc->mode;
+    show_perf_stats = false; test_mode_enabled = false;
+    if (retheme) apply_theme();
+    lv_label_set_text(mode_label, GAUGES[current_mode].name);
+    lv_obj_add_flag(link_icon, LV_OBJ_FLAG_HIDDEN);  // Fleet-dependent, keep frames reproducible
+    if (fleet_count > 0) static_dirty = true;        // The icon is in the static layer
+    lv_obj_add_flag(perf_label, LV_OBJ_FLAG_HIDDEN);
+    if (trend_obj) lv_obj_add_flag(trend_obj, LV_OBJ_FLAG_HIDDEN);  // Time-dependent
+    if (shift_obj) lv_obj_add_flag(shift_obj, LV_OBJ_FLAG_HIDDEN);  // RPM-dependent
+    if (arc_obj) lv_obj_add_flag(arc_obj, LV_OBJ_FLAG_HIDDEN);      // Not in the references
+    if (show_heatmap) heatmap_show(false);
+    set_channel_value(gc->mode, gc->value);
+    gauge.displayed = gc->value; gauge.peak = gc->value; gauge.zone = 1;
+    update_gauge_master(millis());
+    bool ok = take_snapshot();
+
+    set_theme(saved_theme);
+    current_mode = saved_mode;
+    show_perf_stats = saved_stats; test_mode_enabled = saved_test; ring_gradient = saved_gradient;
+    HaltechData = saved_data;
+    gauge = saved_gauge;
+    if (retheme) apply_theme();
+    lv_label_set_text(mode_label, GAUGES[current_mode].name);
+    if (fleet_count > 0) { lv_obj_clear_flag(link_icon, LV_OBJ_FLAG_HIDDEN); static_dirty = true; }
+    if (show_perf_stats) lv_obj_clear_flag(perf_label, LV_OBJ_FLAG_HIDDEN);
+    if (show_heatmap) heatmap_show(true);
+    if (trend_obj && show_trend && !saved_dash) lv_obj_clear_flag(trend_obj, LV_OBJ_FLAG_HIDDEN);
+    if (shift_obj && shift_light && !saved_dash) lv_obj_clear_flag(shift_obj, LV_OBJ_FLAG_HIDDEN);
+    if (arc_obj && show_arc && !saved_dash) lv_obj_clear_flag(arc_obj, LV_OBJ_FLAG_HIDDEN);
+    if (saved_dash) set_view(true);
+    xSemaphoreGive(can_data_lock);
+    input_changed();  // Redraw the live readings
+    return ok;
+}
+
+String golden_compare(int i) {
+    String line = "case " + String(i) + " " + GAUGES[GOLDEN_CASES[i].mode].name + ": ";
+    if (!golden_ref[i]) return line + "no reference\n";
+    fb_diff_t d;
+    fb_snapshot_diff(golden_ref[i], snap_buf, GOLDEN_TOLERANCE, &d);
+    line += fb_diff_pass(&d, GOLDEN_MAX_DIFF_PPM) ? "PASS" : "FAIL";
+    return line + " diff_px=" + String(d.diff_px) + " ppm=" + String(d.diff_ppm) + " max_delta=" + String(d.max_delta) + "\n";
+}
+
+void handleSnapshot() {
+    if (!take_snapshot()) { server.send(500, "text/plain", "Snapshot failed"); return; }
+    send_snapshot_bmp();
+}
+
+void handleGolden() {
+    if (!server.hasArg("case")) {
+        String out = "";
+        for (int i = 0; i < GOLDEN_CASE_COUNT; i++) {
+            out += render_golden_case(&GOLDEN_CASES[i]) ? golden_compare(i) : "case " + String(i) + ": snapshot failed\n";
+        }
+        server.send(200, "text/plain", out);
+        return;
+    }
+    int i = server.arg("case").toInt();
+    if (i < 0 || i >= GOLDEN_CASE_COUNT) { server.send(400, "text/plain", "Bad Request"); return; }
+    if (!render_golden_case(&GOLDEN_CASES[i])) { server.send(500, "text/plain", "Snapshot failed"); return; }
+    if (server.hasArg("ref")) {
+        if (!golden_ref[i]) golden_ref[i] = fb_snapshot_alloc();
+        if (golden_ref[i]) fb_snapshot_copy(golden_ref[i], snap_buf);
+        server.send(200, "text/plain", golden_ref[i] ? "Reference stored\n" : "Out of memory\n");
+    } else if (server.hasArg("cmp")) {
+        server.send(200, "text/plain", golden_compare(i));
+    } else {
+        send_snapshot_bmp();
+    }
+}
+
 void handleUIColors() {
     if (server.hasArg("cbg")) {
         color_background = hexToColor(server.arg("cbg"));
@@ -352,77 +834,209 @@ void setup_wifi() {
   server.on("/", handleRoot);
   server.on("/theme", handleTheme); server.on("/set", handleSet); server.on("/rem", handleRemote);
   server.on("/bright", handleBright); server.on("/test", handleTest); server.on("/stats", handleStats);
-  server.on("/peak", handlePeak); server.on("/uicolors", handleUIColors);
+  server.on("/peak", handlePeak); server.on("/uicolors", handleUIColors); server.on("/needle", handleNeedle);
+  server.on("/artwork", handleArtwork); server.on("/heatmap", handleHeatmap);
+  server.on("/view", handleView); server.on("/trend", handleTrend);
+  server.on("/shift", handleShift); server.on("/ring", handleRing);
+  server.on("/arc", handleArc);
+  server.on("/bench", handleBench); server.on("/kernels", handleKernels);
+  server.on("/profile", handleProfile); server.on("/metrics", handleMetrics);
+  server.on("/trace", handleTrace); server.on("/history", handleHistory);
+  server.on("/snapshot", handleSnapshot); server.on("/golden", handleGolden);
   server.begin();
 }
 
 // --- UI ---
+void needle_draw_cb(lv_event_t *e) {
+  lv_layer_t *layer = lv_event_get_layer(e);
+  if (needle_drawn_image) {
+    lv_area_t coords;
+    lv_draw_image_dsc_t img;
+    lv_draw_image_dsc_init(&img);
+    img.src = needle_sprite_get(needle_idx, &coords);
+    img.recolor = lv_color_hex(needle_color);  // A8 sprite takes the needle colour
+    img.recolor_opa = LV_OPA_COVER;
+    lv_draw_image(layer, &img, &coords);
+    return;
+  }
+  lv_draw_line_dsc_t dsc;
+  lv_draw_line_dsc_init(&dsc);
+  dsc.color = lv_color_hex(needle_color);
+  dsc.width = NEEDLE_WIDTH;
+  dsc.round_start = 0; dsc.round_end = 0;  // Not rounded
+  dsc.p1.x = needle_seg.x0; dsc.p1.y = needle_seg.y0;
+  dsc.p2.x = needle_seg.x1; dsc.p2.y = needle_seg.y1;
+  lv_draw_line(layer, &dsc);
+}
+
 void common_label_setup() {
-  val_label_int = lv_label_create(lv_scr_act());
-  lv_obj_set_style_text_color(val_label_int, lv_color_hex(text_color), 0);
-  lv_obj_set_style_clip_corner(val_label_int, true, 0);
-
-  val_label_dec = lv_label_create(lv_scr_act());
-  lv_obj_set_style_text_color(val_label_dec, lv_color_hex(text_color), 0);
-  lv_obj_set_style_clip_corner(val_label_dec, true, 0); 
-
-  // Reserve space for a single-digit decimal (one place) to avoid tearing
-  // lv_obj_set_width(val_label_dec, 64); // fixed width for ".X" (wider to avoid wrapping)
-  // Prevent LVGL from breaking the label into multiple lines; clip overflow instead
-  // lv_label_set_long_mode(val_label_dec, LV_LABEL_LONG_CLIP);
-  // Ensure label height can hold the large numeric font to avoid vertical clipping/wrapping
-  // lv_obj_set_height(val_label_dec, 140);
-  // lv_obj_set_style_text_align(val_label_dec, LV_TEXT_ALIGN_CENTER, 0);
+  // Value is drawn from cached glyph tiles into fixed cells (see Numeric_Display);
+  // 12 px gap between integer and decimal
+  val_display = numeric_display_create(lv_scr_act(), &value_disp, &digits_int, VALUE_INT_CELLS,
+                                       &digits_dec, VALUE_DECIMALS, 12);
+  lv_obj_add_style(val_display, &style_value, 0);
 
+    // Live rather than flattened into the static layer: a mode switch then
+    // redraws just this label instead of rebuilding the whole layer
     mode_label = lv_label_create(lv_scr_act());
+    lv_obj_add_style(mode_label, &style_mode_label, 0);
+    lv_label_set_text(mode_label, GAUGES[current_mode].name);
+}
+
+void init_styles() {
+    lv_style_init(&style_screen);
+    lv_style_set_bg_opa(&style_screen, LV_OPA_COVER);  // static_root has no theme style of its own
+    lv_style_init(&style_mode_label);
     #ifdef LV_FONT_MONTSERRAT_28
-    lv_obj_set_style_text_font(mode_label, &lv_font_montserrat_28, 0);
+    lv_style_set_text_font(&style_mode_label, &lv_font_montserrat_28);
     #else
-    lv_obj_set_style_text_font(mode_label, &lv_font_montserrat_14, 0);
+    lv_style_set_text_font(&style_mode_label, &lv_font_montserrat_14);
     #endif
-    lv_obj_set_style_text_color(mode_label, lv_color_hex(color_mode_label), 0);
-    lv_label_set_text(mode_label, MODE_NAMES[current_mode]);
-    // Use native 96px dseg font (no transform needed)
-    lv_obj_set_style_text_font(val_label_int, &dseg14_120, 0);
-    lv_obj_set_style_text_font(val_label_dec, &dseg14_96, 0);
+    lv_style_init(&style_link_icon);
+    lv_style_set_text_font(&style_link_icon, &lv_font_montserrat_20);
+    lv_style_init(&style_peak);
+    lv_style_set_radius(&style_peak, 4);
+    lv_style_set_border_width(&style_peak, 0);
+    lv_style_init(&style_perf);
+    lv_style_set_text_color(&style_perf, lv_color_white());
+    lv_style_set_bg_color(&style_perf, lv_color_black());
+    lv_style_set_bg_opa(&style_perf, 150);
+    lv_style_init(&style_tile);
+    lv_style_set_radius(&style_tile, 10);
+    lv_style_set_border_width(&style_tile, 2);
+    lv_style_set_border_opa(&style_tile, LV_OPA_40);
+    lv_style_init(&style_caption);
+    lv_style_set_text_font(&style_caption, &lv_font_montserrat_14);
+    lv_style_init(&style_track);
+    lv_style_set_radius(&style_track, 4);
+    lv_style_set_bg_opa(&style_track, LV_OPA_COVER);
+    lv_style_init(&style_value);  // Text colour of the digit tiles
 }
 
-void load_current_style() {
-    lv_obj_clean(lv_scr_act());
-    lv_obj_set_style_bg_color(lv_scr_act(), lv_color_hex(color_background), 0);
-    
-    //lv_obj_t * img = lv_image_create(lv_scr_act());
-    //lv_image_set_src(img, &gauge_bg);
-    //lv_obj_center(img);
-    //lv_obj_set_style_image_opa(img, 50, 0);
+// Push the current theme colours into the shared styles and caches in place.
+// Only what actually changed is invalidated; nothing is recreated.
+void apply_theme() {
+    lv_style_set_bg_color(&style_screen, lv_color_hex(color_background));
+    lv_style_set_text_color(&style_mode_label, lv_color_hex(color_mode_label));
+    lv_style_set_text_color(&style_link_icon, lv_color_hex(color_link_icon));
+    lv_style_set_bg_color(&style_peak, lv_color_hex(color_peak));
+    lv_style_set_border_color(&style_tile, lv_color_hex(color_mode_label));
+    lv_style_set_text_color(&style_caption, lv_color_hex(color_mode_label));
+    lv_style_set_text_color(&style_value, lv_color_hex(text_color));
+    // Bar track: a dim mode-label grey over the background (0x303030 on the factory theme)
+    lv_style_set_bg_color(&style_track, lv_color_mix(lv_color_hex(color_mode_label), lv_color_hex(color_background), 82));
+    // Every style touched above, or objects using it keep their cached look
+    lv_obj_report_style_change(&style_screen);
+    lv_obj_report_style_change(&style_mode_label);
+    lv_obj_report_style_change(&style_link_icon);
+    lv_obj_report_style_change(&style_peak);
+    lv_obj_report_style_change(&style_tile);
+    lv_obj_report_style_change(&style_caption);
+    lv_obj_report_style_change(&style_track);
+    lv_obj_report_style_change(&style_value);
+
+    // Value -> ring colour: native RGB565, so the per-frame path is a lookup
+    for (int m = 0; m < 4; m++) {
+        const GaugeDesc &g = GAUGES[m];
+        palette_build(&mode_palette[m], g.min, g.max, g.zoned ? g.zone_low : NAN, g.zoned ? g.zone_high : NAN,
+                      lv_color_hex(color_low), lv_color_hex(color_mid), lv_color_hex(color_high));
+    }
+    for (int z = 0; z < 3; z++) zone_565[z] = lv_color_to_u16(lv_color_hex(ZONE_COLOR(z)));
+
+    // The trend bakes in text and background colour
+    if (trend_obj && (text_color != applied_text || color_background != applied_bg)) trend_rebuild();
+    if (needle_color != applied_needle) {
+        if (needle_tip && needle_drawn_image) needle_sprite_invalidate(needle_tip, needle_idx);
+        else if (needle_tip) needle_invalidate(needle_tip, &needle_seg, NEEDLE_WIDTH);
+        applied_needle = needle_color;
+    }
+    // Ring colour follows zone_color on the next update (ring_indicator_set_color)
+    dash_recolor = true;  // Tile bars likewise on the next dash_update()
+    if (shift_obj) shift_light_set_colors(shift_obj, lv_color_hex(color_mid), lv_color_hex(text_color), lv_color_hex(color_high));
+    // The static layer shows the background, link icon and (mode-label coloured)
+    // dash frames and captions: re-flatten only when one of those changed
+    if (color_background != applied_bg || color_mode_label != applied_label || color_link_icon != applied_icon)
+        static_dirty = true;
+    applied_text = text_color; applied_bg = color_background;
+    applied_label = color_mode_label; applied_icon = color_link_icon;
+}
+
+// Re-flatten the static widgets if anything under static_root changed. The
+// artwork is only decoded for the snapshot and freed once it is in the layer.
+void static_layer_sync() {
+    if (!static_dirty) return;
+    static_dirty = false;
+    const lv_image_dsc_t *art = bg_artwork ? image_cache_get(&gauge_bg_pack) : NULL;
+    lv_image_set_src(bg_art, art);
+    if (art) lv_obj_clear_flag(bg_art, LV_OBJ_FLAG_HIDDEN);
+    else lv_obj_add_flag(bg_art, LV_OBJ_FLAG_HIDDEN);
+    if (static_layer_rebuild() && art) {
+        lv_image_set_src(bg_art, NULL);
+        image_cache_drop(&gauge_bg_pack);
+    }
+}
+
+// Theme change from the web UI / ESP-NOW: apply and render synchronously so the
+// full cost (property updates + redraw) can be timed
+void apply_theme_timed() {
+    unsigned long start = micros();
+    apply_theme();
+    static_layer_sync();
+    lv_refr_now(NULL);
+    theme_apply_us = micros() - start;
+    Serial.printf("Theme applied in %lu us (%u px redrawn, static layer %u us)\n", theme_apply_us,
+                  (unsigned)render_stats_last()->px_touched, (unsigned)static_layer_build_us());
+}
+
+// Built once at boot; theme changes go through apply_theme()
+void build_screen() {
+    init_styles();
+    apply_theme();
+    // Glyph coverage, independent of the theme (procedural segments, any size)
+    digit_cache_build(&digits_int, VALUE_INT_HEIGHT);
+    digit_cache_build(&digits_dec, VALUE_DEC_HEIGHT);
+    digit_cache_build(&digits_tile, DASH_DIGIT_HEIGHT);
+    lv_obj_add_style(lv_scr_act(), &style_screen, 0);
+
+    // STATIC LAYER - background, artwork, link icon and mode label are drawn once
+    // into an opaque cached image; only the widgets created after it render per frame
+    static_root = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(static_root);
+    lv_obj_add_style(static_root, &style_screen, 0);
+    lv_obj_set_size(static_root, LCD_WIDTH, LCD_HEIGHT);
+    lv_obj_set_pos(static_root, 0, 0);
+    lv_obj_clear_flag(static_root, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    static_layer_create(lv_scr_act(), static_root, LCD_WIDTH, LCD_HEIGHT);
+    static_dirty = true;
+
+    bg_art = lv_image_create(static_root);  // Source set at rebuild time (static_layer_sync)
+    lv_obj_center(bg_art);
+    lv_obj_set_style_image_opa(bg_art, 50, 0);
+    lv_obj_add_flag(bg_art, LV_OBJ_FLAG_HIDDEN);
 
     // LINK ICON
-    link_icon = lv_label_create(lv_scr_act());
-    lv_obj_set_style_text_font(link_icon, &lv_font_montserrat_20, 0);
+    link_icon = lv_label_create(static_root);
+    lv_obj_add_style(link_icon, &style_link_icon, 0);
     lv_label_set_text(link_icon, LV_SYMBOL_WIFI);
-    lv_obj_set_style_text_color(link_icon, lv_color_hex(color_link_icon), 0);
     lv_obj_align(link_icon, LV_ALIGN_BOTTOM_MID, 0, -80); 
     if(fleet_count == 0) lv_obj_add_flag(link_icon, LV_OBJ_FLAG_HIDDEN);
 
     // PERF OVERLAY (MOVED TO CENTER-TOP)
     perf_label = lv_label_create(lv_scr_act());
     lv_obj_align(perf_label, LV_ALIGN_CENTER, 0, -140); // Move performance monitor above main text
-    lv_obj_set_style_text_color(perf_label, lv_color_white(), 0);
-    lv_obj_set_style_bg_color(perf_label, lv_color_black(), 0);
-    lv_obj_set_style_bg_opa(perf_label, 150, 0); 
+    lv_obj_add_style(perf_label, &style_perf, 0);
     if(!show_perf_stats) lv_obj_add_flag(perf_label, LV_OBJ_FLAG_HIDDEN);
 
     // === STATIC RING INDICATOR (outer border, color-changing) ===
-    bar = lv_obj_create(lv_scr_act());
-    const int ring_size = 480; // square (w == h)
-    lv_obj_set_size(bar, ring_size, ring_size);  // Fill most of screen
+    // Pre-rasterised A8 mask, recoloured at blit time (see Ring_Indicator)
+    bar = ring_indicator_create(lv_scr_act(), lv_color_hex(zone_color));
     lv_obj_align(bar, LV_ALIGN_CENTER, 0, 0);
-    lv_obj_set_style_bg_opa(bar, LV_OPA_TRANSP, 0);  // Transparent background
-    lv_obj_set_style_pad_all(bar, 0, 0);
-    lv_obj_set_style_border_width(bar, 16, 0);  // Thick border for ring
-    lv_obj_set_style_border_color(bar, lv_color_hex(color_low), 0);  // Start with low color
-    lv_obj_set_style_border_side(bar, LV_BORDER_SIDE_FULL, 0);
-    lv_obj_set_style_radius(bar, ring_size / 2, 0);  // Full circle (half of size)
+
+    // SHIFT LIGHT - arc of LED segments inside the needle's sweep; only segments
+    // whose state changed are repainted (see Shift_Light)
+    shift_obj = shift_light_create(lv_scr_act());
+    shift_light_set_colors(shift_obj, lv_color_hex(color_mid), lv_color_hex(text_color), lv_color_hex(color_high));
+    if (!shift_light) lv_obj_add_flag(shift_obj, LV_OBJ_FLAG_HIDDEN);
     
     // COMMENTED OUT: Horizontal bar UI
     // bar = lv_bar_create(lv_scr_act());
@@ -447,32 +1061,46 @@ void load_current_style() {
     // lv_obj_set_size(peak_dot, 4, 56); // thin vertical stripe that extends above/below bar
     peak_dot = lv_obj_create(lv_scr_act());
     lv_obj_set_size(peak_dot, 8, 8);  // Small indicator dot (hidden for now)
-    lv_obj_set_style_radius(peak_dot, 4, 0);
-    lv_obj_set_style_bg_color(peak_dot, lv_color_hex(color_peak), 0);
-    lv_obj_set_style_border_width(peak_dot, 0, 0);
+    lv_obj_add_style(peak_dot, &style_peak, 0);
     lv_obj_set_pos(peak_dot, 0, 0);
     if(!peak_hold_enabled) lv_obj_add_flag(peak_dot, LV_OBJ_FLAG_HIDDEN); // Initial State
     
-    // NEEDLE TIP - thin triangle that orbits around center
-    needle_tip = lv_line_create(lv_scr_act());
-    lv_obj_set_style_line_width(needle_tip, 8, 0);  // Thin line width
-    lv_obj_set_style_line_color(needle_tip, lv_color_hex(needle_color), 0);
-    lv_obj_set_style_line_rounded(needle_tip, 0, 0);  // Not rounded
+    // ARC FILL - under the needle, repaints only the wedge the value moved through
+    arc_obj = arc_fill_create(lv_scr_act(), &arc_fill, 240, 240, ARC_R_IN, ARC_R_OUT, GAUGES[0].sweep_start_deg,
+                              GAUGES[0].sweep_range_deg, palette_expand(zone_565[gauge.zone]));
+    if (!show_arc) lv_obj_add_flag(arc_obj, LV_OBJ_FLAG_HIDDEN);
+
+    // NEEDLE TIP - full-screen transparent layer that draws the needle from the LUT
+    // so only tight rects around the old/new needle are invalidated on movement
+    needle_tip = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(needle_tip);
+    lv_obj_set_size(needle_tip, LCD_WIDTH, LCD_HEIGHT);
+    lv_obj_set_pos(needle_tip, 0, 0);
+    lv_obj_clear_flag(needle_tip, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(needle_tip, needle_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
     
     common_label_setup();
     lv_obj_align(mode_label, LV_ALIGN_BOTTOM_MID, 0, -40);
-    lv_obj_align(val_label_int, LV_ALIGN_CENTER, 50, -10); // Move right 40 px, up 10 px
-    lv_obj_align(val_label_dec, LV_ALIGN_CENTER, 50, -10);  // Move right 40 px, up 10 px
-    
-    current_applied_text = 0; 
+    // Integer's RIGHT edge anchored 44 px right of centre, vertically centred 5 px low
+    lv_obj_set_pos(val_display, LCD_WIDTH / 2 + 44 - value_disp.int_width,
+                   LCD_HEIGHT / 2 + 5 - digits_int.h / 2);
+
+    // TREND - under the value, clear of the needle band
+    trend_obj = trend_create(lv_scr_act(), &trend, TREND_W, TREND_H);
+    if (trend_obj) {
+        lv_obj_set_pos(trend_obj, (LCD_WIDTH - TREND_W) / 2, 320);
+        trend_rebuild();
+        if (!show_trend) lv_obj_add_flag(trend_obj, LV_OBJ_FLAG_HIDDEN);
+    }
+
+    dash_create();
 }
 
-void update_ui(float val, float min, float max, float peak, uint32_t color_hex) {
-    // Ring indicator: only update color based on gauge value
-    static uint32_t prev_color = 0;
-    if (color_hex != prev_color) {
-        lv_obj_set_style_border_color(bar, lv_color_hex(color_hex), 0);
-        prev_color = color_hex;
+void update_ui(float normalized, float peak, uint16_t ring565) {
+    // Ring indicator: only touched when the native colour changes
+    if (ring565 != ring_shown565) {
+        ring_shown565 = ring565;
+        ring_indicator_set_color(bar, palette_expand(ring565));
     }
 
     // Peak indicator (optional, currently not used)
@@ -482,122 +1110,517 @@ void update_ui(float val, float min, float max, float peak, uint32_t color_hex)
       lv_obj_add_flag(peak_dot, LV_OBJ_FLAG_HIDDEN);
     }
     
-    // Update needle tip position based on gauge value
-    float angle_start = 135.0f;  // Start angle in degrees (SSW - South-Southwest)
-    float angle_range = 270.0f;  // 315 degrees clockwise sweep
-    // Path: SSW (112.5°) → South (90°) → N (270°) → E (0°/360°) → SSE (67.5°)
-    // Midpoint: 112.5 + 157.5 = 270° (North - 12 o'clock)
-    
-    // Map value to angle
-    float normalized = (val - min) / (max - min);
-    normalized = (normalized < 0) ? 0 : (normalized > 1) ? 1 : normalized;  // Clamp to 0-1
-    float angle_deg = angle_start + normalized * angle_range;
-    
-    // Convert to radians
-    float angle_rad = angle_deg * M_PI / 180.0f;
-    
-    // Calculate needle line from 185 to 225px radius to inside of ring
-    int center_x = 240;
-    int center_y = 240;
-    int radius_start = 185;  // Starting radius
-    int radius_end = 225;    // Ending radius (tip)
-    
-    // Line points: start, tip
-    static lv_point_precise_t needle_points[2];
-    
-    // Start point at 225px radius
-    needle_points[0].x = center_x + (int)(radius_start * cosf(angle_rad));
-    needle_points[0].y = center_y + (int)(radius_start * sinf(angle_rad));
-    
-    // Tip point at 240px radius
-    needle_points[1].x = center_x + (int)(radius_end * cosf(angle_rad));
-    needle_points[1].y = center_y + (int)(radius_end * sinf(angle_rad));
-    
-    lv_line_set_points(needle_tip, needle_points, 2);
+    // Update needle tip position from the 0..1 position (angles baked into the LUT in setup)
+    uint16_t idx = needle_lut_index(normalized);
+    const needle_seg_t *seg = needle_lut_get(idx);
+    bool image = needle_image && needle_sprites_ready();
+
+    if (show_arc) {
+        arc_fill_set_color(&arc_fill, palette_expand(zone_565[gauge.zone]));  // Whole fill, on zone change only
+        arc_fill_set(&arc_fill, idx);
+    }
+
+    if (image != needle_drawn_image) {
+        // Style switch: clear whichever needle is on screen, draw the other
+        if (needle_drawn_image) needle_sprite_invalidate(needle_tip, needle_idx);
+        else needle_invalidate(needle_tip, &needle_seg, NEEDLE_WIDTH);
+        needle_drawn_image = image;
+        needle_idx = idx; needle_seg = *seg;
+        if (image) needle_sprite_invalidate(needle_tip, needle_idx);
+        else needle_invalidate(needle_tip, &needle_seg, NEEDLE_WIDTH);
+    } else if (image) {
+        // One sprite per LUT step; invalidate the old and new sprite boxes
+        if (idx != needle_idx) {
+            needle_sprite_invalidate(needle_tip, needle_idx);
+            needle_idx = idx; needle_seg = *seg;
+            needle_sprite_invalidate(needle_tip, needle_idx);
+        }
+    } else if (!needle_seg_equal(seg, &needle_seg)) {
+        // Only redraw when the quantised endpoints actually move
+        needle_invalidate(needle_tip, &needle_seg, NEEDLE_WIDTH);
+        needle_idx = idx; needle_seg = *seg;
+        needle_invalidate(needle_tip, &needle_seg, NEEDLE_WIDTH);
+    }
 }
 
-void update_gauge_master() {
-    if (text_color != current_applied_text) {
-        lv_obj_set_style_text_color(val_label_int, lv_color_hex(text_color), 0);
-        lv_obj_set_style_text_color(val_label_dec, lv_color_hex(text_color), 0);
-        current_applied_text = text_color;
+// Boost and AFR have colour thresholds; the other channels stay in the mid zone
+int mode_zone(GaugeMode mode, float v, int prev) { return gauge_zone(GAUGES[mode], v, prev); }
+
+// Each mode's reading, resolved at compile time in the templated update
+template <GaugeMode M> float channel_read();
+template <> float channel_read<MODE_BOOST>() { return HaltechData.boost_psi; }
+template <> float channel_read<MODE_AFR>() { return HaltechData.afr_gas; }
+template <> float channel_read<MODE_WATER>() { return (float)HaltechData.water_temp_c; }
+template <> float channel_read<MODE_OIL>() { return HaltechData.oil_press_psi; }
+
+float channel_value(GaugeMode mode) {
+    switch(mode) {
+      case MODE_BOOST: return channel_read<MODE_BOOST>();
+      case MODE_AFR: return channel_read<MODE_AFR>();
+      case MODE_WATER: return channel_read<MODE_WATER>();
+      case MODE_OIL: return channel_read<MODE_OIL>();
     }
+    return 0;
+}
+
+// One instantiation per mode: every descriptor field is a constant, so there
+// is no mode branching per frame and the divisions fold into multiplies
+template <GaugeMode M> void update_gauge(unsigned long now_ms) {
+    constexpr const GaugeDesc &G = GAUGES[M];
+    static_assert(G.decimals == VALUE_DECIMALS, "Value display has VALUE_DECIMALS fixed cells");
+    gauge_step(G, &gauge, channel_read<M>(), now_ms, peak_hold_enabled, PEAK_HOLD_TIME);
+    zone_color = ZONE_COLOR(gauge.zone);
+    uint16_t ring565 = ring_gradient ? palette_lookup(&mode_palette[M], gauge.displayed) : zone_565[gauge.zone];
+
+    // Fixed-point value; only cells whose character changed get invalidated
+    numeric_display_set(&value_disp, gauge_fixed(G, gauge.displayed));
+    update_ui(gauge_position(G, gauge.displayed), gauge.peak, ring565);
+}
+
+typedef void (*gauge_update_fn)(unsigned long now_ms);
+const gauge_update_fn GAUGE_UPDATE[4] = {
+    update_gauge<MODE_BOOST>, update_gauge<MODE_AFR>, update_gauge<MODE_WATER>, update_gauge<MODE_OIL>,
+};
+
+void update_gauge_master(unsigned long now_ms) {
+    GAUGE_UPDATE[current_mode](now_ms);  // The only per-mode decision of the frame
+}
+
+// New sample available: wakes the UI loop immediately if it is sleeping idle
+void input_changed() {
+    input_gen++;
+    if (render_idle && loop_task) xTaskNotifyGive(loop_task);
+}
+
+// Rotating 1025 sprites takes far longer than a frame, so it runs on its own
+// low-priority task from a private copy of the artwork's A8 plane (the decoded
+// image goes back to the cache straight away). update_ui keeps drawing the line
+// needle until needle_sprites_ready().
+volatile bool needle_building = false;
+static uint8_t *needle_art_a8 = NULL;
+static int needle_art_w = 0, needle_art_h = 0;
 
-    switch(current_mode) {
-      case MODE_BOOST: target_val = HaltechData.boost_psi; break;
-      case MODE_AFR: target_val = HaltechData.afr_gas; break;
-      case MODE_WATER: target_val = (float)HaltechData.water_temp_c; break;
-      case MODE_OIL: target_val = HaltechData.oil_press_psi; break;
+void needle_build_task(void *arg) {
+    // Artwork points along +x from its left-middle pivot, so the pivot sits on
+    // the gauge centre and the arrow lands just inside the ring
+    bool ok = needle_sprites_init(needle_art_a8, needle_art_w, needle_art_h, 0, needle_art_h / 2, 240, 240,
+                                  GAUGES[0].sweep_start_deg, GAUGES[0].sweep_range_deg);
+    heap_caps_free(needle_art_a8);
+    needle_art_a8 = NULL;
+    needle_building = false;
+    if (ok) {
+        flag_needle_update = true;  // Swap the needle in, or free it if the line was chosen meanwhile
+        input_changed();
     }
+    vTaskDelete(NULL);
+}
 
-    // Time-aware smoothing with a per-frame clamp to avoid large jumps
-    static unsigned long last_update_ms = 0;
-    unsigned long now_ms = millis();
-    float dt = last_update_ms ? (now_ms - last_update_ms) / 1000.0f : (1.0f/30.0f);
-    last_update_ms = now_ms;
-    float delta = target_val - displayed_val;
-    if (fabsf(delta) < 0.05f) {
-      displayed_val = target_val;
-    } else {
-      const float smoothing = 0.24f; // lower = smoother/slower
-      const float max_rate_per_sec = 40.0f; // units per second maximum change
-      float step = delta * smoothing;
-      float max_step = max_rate_per_sec * dt;
-      if (fabsf(step) > max_step) step = (step > 0) ? max_step : -max_step;
-      displayed_val += step;
+// Start building the sprite atlas; only done once the image needle is chosen
+bool needle_sprites_load() {
+    if (needle_sprites_ready() || needle_building) return true;
+    const lv_image_dsc_t *needle_art = image_cache_get(&tabby_needle_pack);
+    if (!needle_art) return false;
+    int w = needle_art->header.w, h = needle_art->header.h;
+    uint8_t *a8 = (uint8_t *)heap_caps_malloc(w * h, MALLOC_CAP_SPIRAM);
+    if (a8) memcpy(a8, needle_art->data + w * h * 2, w * h);  // A8 plane follows RGB565
+    image_cache_drop(&tabby_needle_pack);
+    if (!a8) {
+        log_msg("Needle: Failed to copy artwork!");
+        return false;
     }
+    needle_art_a8 = a8; needle_art_w = w; needle_art_h = h;
+    needle_building = true;
+    // Idle priority on core 0: the UI loop and the CAN tasks never wait on it,
+    // and IDLE0 still gets its share to feed the task watchdog
+    if (xTaskCreatePinnedToCore(needle_build_task, "Needle", 4096, NULL, tskIDLE_PRIORITY, NULL, 0) != pdPASS) {
+        log_msg("Needle: Failed to start build task!");
+        heap_caps_free(needle_art_a8);
+        needle_art_a8 = NULL;
+        needle_building = false;
+        return false;
+    }
+    return true;
+}
 
-    if (peak_hold_enabled) {
-        if (target_val > peak_val) { peak_val = target_val; peak_timer = millis(); }
-        if (millis() - peak_timer > PEAK_HOLD_TIME) peak_val = target_val;
-    }
-
-    uint32_t color_hex = color_low;
-    lv_color_t c = lv_color_hex(color_low);
-    if (current_mode == MODE_BOOST) {
-        if(displayed_val < 0) { c = lv_color_hex(color_low); color_hex = color_low; }
-        else if(displayed_val < 20) { c = lv_color_hex(color_mid); color_hex = color_mid; }
-        else { c = lv_color_hex(color_high); color_hex = color_high; }
-    } else if (current_mode == MODE_AFR) {
-        if(displayed_val < 10) { c = lv_color_hex(color_low); color_hex = color_low; }
-        else if(displayed_val < 15) { c = lv_color_hex(color_mid); color_hex = color_mid; }
-        else { c = lv_color_hex(color_high); color_hex = color_high; }
+// Needle style changed from the web UI: build the atlas, or put the line back and free it
+void needle_style_apply() {
+    if (needle_image) {
+        needle_sprites_load();  // update_ui swaps the drawn needle once it is ready
+    } else if (needle_sprites_ready()) {  // Ready means the build task is done with the atlas
+        // needle_draw_cb must stop reading sprites before the atlas goes
+        if (needle_tip && needle_drawn_image) {
+            needle_sprite_invalidate(needle_tip, needle_idx);
+            needle_invalidate(needle_tip, &needle_seg, NEEDLE_WIDTH);
+        }
+        needle_drawn_image = false;
+        needle_sprites_free();
+    }
+    input_changed();
+}
+
+// Nothing left to animate: value has converged and no peak hold is about to expire
+bool gauge_settled(unsigned long now_ms) {
+    if (dash_view) return lv_anim_count_running() == 0;  // Tiles show readings directly, nothing to converge
+    if (shift_light && (shift_state & SHIFT_FLASH)) return false;  // Flashing needs the frame rate
+    if (gauge.displayed != gauge.target) return false;
+    if (peak_hold_enabled && gauge.peak != gauge.target && now_ms - gauge.peak_timer > PEAK_HOLD_TIME) return false;
+    return lv_anim_count_running() == 0;
+}
+
+// Every flushed area feeds the frame stats and, while recording, the heat map
+void flush_hook(const lv_area_t *area, uint32_t copy_cycles) {
+    render_stats_flush(area, copy_cycles);
+    heatmap_flush(area);
+}
+
+// Render_Stats frame callback: split each refresh into render and flush stages
+void profile_frame(const render_frame_stats_t *st) {
+    prof_record(PROF_RENDER, st->refr_cycles - st->flush_cycles);
+    prof_record(PROF_FLUSH, st->flush_cycles);
+    trace_complete(tr_render, st->refr_cycles);
+    if (flow_pending) { trace_flow(tr_can_flow, flow_pending); flow_pending = 0; }
+    metric_inc(m_frames);
+    metric_add(m_px, st->px_touched);
+    metric_observe(m_render_us, st->render_us);
+}
+
+// Perf overlay: min/avg/p99 per stage over the last second
+void update_perf_label() {
+    char buf[256];
+    int n = snprintf(buf, sizeof(buf), "FPS: %d  LOAD: %d%% %s\nDIGIT: %d/%d us\nus min/avg/p99", perf_fps,
+                     loop_load_pct, render_idle ? "IDLE" : "ACTIVE", (int)digits_int.render_us, (int)digits_int.blit_us);
+    const prof_summary_t *ps = prof_latest();
+    for (int i = 0; ps && i < PROF_STAGE_COUNT && n < (int)sizeof(buf); i++) {
+        const prof_stat_t *st = &ps->stage[i];
+        n += snprintf(buf + n, sizeof(buf) - n, "\n%s %u/%u/%u", prof_stage_name((prof_stage_t)i),
+                      (unsigned)st->min_us, (unsigned)st->avg_us, (unsigned)st->p99_us);
+    }
+    lv_label_set_text(perf_label, buf);
+}
+
+void set_render_idle(bool idle) {
+    if (idle == render_idle) return;
+    render_idle = idle;
+    lv_timer_t *refr = lv_display_get_refr_timer(lv_display_get_default());
+    lv_timer_set_period(refr, idle ? IDLE_REFR_PERIOD : LV_DEF_REFR_PERIOD);
+    if (!idle) lv_timer_ready(refr);  // Render the wake-up frame without waiting out the idle period
+}
+
+// --- RENDER BENCH ---
+// Scripted value sweeps through the real update path with a synchronous
+// refresh per frame; per-frame cost comes from Render_Stats. Uses a fixed
+// 33 ms timestep so results don't depend on how long frames take.
+#define BENCH_FRAMES 300
+
+void set_channel_value(GaugeMode mode, float v) {
+    switch(mode) {
+      case MODE_BOOST: HaltechData.boost_psi = v; break;
+      case MODE_AFR: HaltechData.afr_gas = v; break;
+      case MODE_WATER: HaltechData.water_temp_c = (int)v; break;
+      case MODE_OIL: HaltechData.oil_press_psi = v; break;
+    }
+    input_changed();
+}
+
+// --- MODE SWITCHING ---
+// All modes share one screen; switching swaps the channel in place (label
+// redraw plus the next update) instead of writing NVS and rebooting. Each mode
+// keeps its own filter and peak state, so switching away and back resumes where
+// it left off. The NVS write happens later on a low-priority task.
+#define MODE_SAVE_DELAY_MS 2000   // Coalesces rapid switching into one flash write
+typedef struct { float displayed, peak; unsigned long peak_timer; int zone; bool valid; } ModeState;
+ModeState mode_state[4];
+volatile int mode_to_save = -1;
+TaskHandle_t settings_task = NULL;
+
+// Any task: web handler, ESP-NOW callback
+void request_mode(int m) {
+    if (m < MODE_BOOST || m > MODE_OIL) return;
+    pending_mode = m;
+    input_changed();  // Wake an idle loop
+}
+
+void switch_mode(GaugeMode m) {
+    if (m == current_mode) return;
+    unsigned long now = millis();
+    mode_state[current_mode] = { gauge.displayed, gauge.peak, gauge.peak_timer, gauge.zone, true };
+    current_mode = m;
+    const ModeState *ms = &mode_state[m];
+    if (ms->valid) {
+        gauge.displayed = ms->displayed; gauge.peak = ms->peak; gauge.peak_timer = ms->peak_timer; gauge.zone = ms->zone;
     } else {
-        c = lv_color_hex(color_mid); color_hex = color_mid;
-    }
-
-    int i_part = (int)displayed_val;
-    int d_part = abs((int)((displayed_val - i_part) * 10));
-    char b1[16]; snprintf(b1, sizeof(b1), "%d", i_part);
-    char b2[16]; snprintf(b2, sizeof(b2), ".%d", d_part);
-    static char prev_b1[16] = ""; static char prev_b2[16] = "";
-    if (strcmp(prev_b1, b1) != 0) {
-      lv_label_set_text(val_label_int, b1);
-      strncpy(prev_b1, b1, sizeof(prev_b1));
-    }
-    if (strcmp(prev_b2, b2) != 0) {
-      lv_label_set_text(val_label_dec, b2);
-      strncpy(prev_b2, b2, sizeof(prev_b2));
-    }
-    // Dynamic spacing: right-justify integer label and place decimal to its right
-    static int prev_int_w = 0; static int prev_dec_w = 0;
-    int int_w = lv_obj_get_width(val_label_int);
-    int dec_w = lv_obj_get_width(val_label_dec);
-    if (int_w != prev_int_w || dec_w != prev_dec_w) {
-      prev_int_w = int_w; prev_dec_w = dec_w;
-      int spacing = 12;  // Gap between integer and decimal
-      // Anchor the integer's RIGHT edge at this x (relative to center)
-      int anchor_x = -(spacing / 2);
-      int int_center_x = anchor_x - (int_w / 2) + 50;  // +40 px right
-      int dec_center_x = anchor_x + spacing + (dec_w / 2) + 50;  // +40 px right
-      lv_obj_align(val_label_int, LV_ALIGN_CENTER, int_center_x, 5);  // Y: 10 (up 10 px from 20)
-      lv_obj_align(val_label_dec, LV_ALIGN_CENTER, dec_center_x, 5);   // Y: 10 (up 10 px from 20)
-    }
-
-    float min = RANGES[current_mode][0];
-    float max = RANGES[current_mode][1];
-    
-    update_ui(displayed_val, min, max, peak_val, color_hex);
+        // First visit: start on the live reading rather than sweeping from another channel's value
+        gauge.displayed = gauge.peak = channel_value(m); gauge.peak_timer = now; gauge.zone = 1;
+    }
+    lv_label_set_text(mode_label, GAUGES[m].name);
+    if (trend_obj && show_trend) trend_rebuild();  // Replays the new channel's history
+    update_gauge_master(now);
+    broadcast_presence();  // Peers' fleet lists show the new mode right away
+    mode_to_save = m;
+    if (settings_task) xTaskNotifyGive(settings_task);
+}
+
+void settings_save_task(void *arg) {
+    Preferences prefs;  // Own handle; the loop task keeps using `preferences`
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        vTaskDelay(pdMS_TO_TICKS(MODE_SAVE_DELAY_MS));
+        ulTaskNotifyTake(pdTRUE, 0);  // Switches during the delay are covered by this write
+        prefs.begin("gauge", false); prefs.putInt("mode", mode_to_save); prefs.end();
+    }
+}
+
+// --- DASHBOARD VIEW ---
+// Five tiles (the four modes plus RPM) on the same screen as the gauge. Frames
+// and captions are flattened into the static layer; each tile's digits and bar
+// are live and only touched when that channel's shown value changes, so a
+// steady channel costs nothing and a moving one only its changed cells.
+#define DASH_TILE_COUNT 5
+#define DASH_TILE_H     92
+#define DASH_RPM        4   // Tile index of the non-mode channel
+typedef struct {
+  const char *name;
+  float min, max;
+  uint8_t int_cells, decimals;
+  int32_t x, y, w;        // Tile box, corners inside the ring band (r < 224)
+} DashTileDef;
+const DashTileDef DASH_TILES[DASH_TILE_COUNT] = {
+  { GAUGES[MODE_BOOST].name, GAUGES[MODE_BOOST].min, GAUGES[MODE_BOOST].max, 3, 1,  80,  86, 152 },
+  { GAUGES[MODE_AFR].name,   GAUGES[MODE_AFR].min,   GAUGES[MODE_AFR].max,   2, 1, 248,  86, 152 },
+  { GAUGES[MODE_WATER].name, GAUGES[MODE_WATER].min, GAUGES[MODE_WATER].max, 3, 0,  80, 190, 152 },
+  { GAUGES[MODE_OIL].name,   GAUGES[MODE_OIL].min,   GAUGES[MODE_OIL].max,   3, 1, 248, 190, 152 },
+  { "RPM",                   0,                      9000,                   4, 0, 164, 294, 152 },
+};
+typedef struct {
+  numeric_display_t nd;
+  lv_obj_t *fill;         // Bar fill inside its track
+  int32_t bar_w;          // Track width (fill at max)
+  int32_t scaled, fill_px;
+  int zone;
+  bool valid;
+} DashTile;
+DashTile dash_tiles[DASH_TILE_COUNT];
+
+float dash_value(int i) {
+    return i == DASH_RPM ? (float)HaltechData.rpm : channel_value((GaugeMode)i);
+}
+
+// Fixed-point scales per channel, indexed like the dashboard tiles
+static const float HISTORY_SCALES[DASH_TILE_COUNT] = { 100, 100, 10, 10, 1 };
+
+// Test mode has no frames to follow: every channel goes in once per pass
+void history_sample_all() {
+    for (int i = 0; i < DASH_TILE_COUNT; i++) history_sample(i, dash_value(i));
+}
+
+// Column c of the trend covers 100 ms buckets [c * TREND_PER_COL, (c + 1) * TREND_PER_COL)
+uint32_t trend_next_col = 0;   // First column not yet pushed
+
+void trend_push_points(const history_point_t *p, int n) {
+    float mn = p[0].min, mx = p[0].max, sum = 0;
+    for (int i = 0; i < n; i++) {
+        if (p[i].min < mn) mn = p[i].min;
+        if (p[i].max > mx) mx = p[i].max;
+        sum += p[i].avg;
+    }
+    trend_push(&trend, mn, mx, sum / n);
+}
+
+// Columns whose last bucket has closed
+uint32_t trend_done_cols() {
+    return history_available(HISTORY_100MS) ? (history_newest(HISTORY_100MS) + 1) / TREND_PER_COL : 0;
+}
+
+// Push the columns completed since the last call (one per ~300 ms)
+void trend_update() {
+    uint32_t done = trend_done_cols();
+    if (done - trend_next_col > TREND_W) trend_next_col = done - TREND_W;
+    const uint32_t col_ms = TREND_PER_COL * history_bucket_ms(HISTORY_100MS);
+    for (; trend_next_col < done; trend_next_col++) {
+        uint32_t from = trend_next_col * col_ms;
+        int n = history_query(current_mode, HISTORY_100MS, from, from + col_ms - 1, trend_points, TREND_PER_COL);
+        if (n) trend_push_points(trend_points, n);
+    }
+}
+
+// Redraw the whole trend for the current channel from its history; needed
+// only after a mode, theme or visibility change, otherwise columns are pushed
+void trend_rebuild() {
+    trend_set_range(&trend, GAUGES[current_mode].min, GAUGES[current_mode].max);
+    trend_set_colors(&trend, lv_color_hex(color_background), lv_color_hex(text_color));
+    trend_clear(&trend);
+    uint32_t done = trend_done_cols();
+    uint32_t first = done > TREND_W ? done - TREND_W : 0;
+    const uint32_t col_ms = TREND_PER_COL * history_bucket_ms(HISTORY_100MS);
+    trend_next_col = done;
+    if (done == first) return;
+    // One query for the window, then grouped by column (buckets carry their start time)
+    int n = history_query(current_mode, HISTORY_100MS, first * col_ms, done * col_ms - 1,
+                          trend_points, TREND_W * TREND_PER_COL);
+    for (int i = 0; i < n; ) {
+        uint32_t col = trend_points[i].t_ms / col_ms;
+        int j = i;
+        while (j < n && trend_points[j].t_ms / col_ms == col) j++;
+        trend_push_points(&trend_points[i], j - i);
+        i = j;
+    }
+}
+
+void dash_create() {
+    dash_static = lv_obj_create(static_root);
+    lv_obj_remove_style_all(dash_static);
+    lv_obj_set_size(dash_static, LCD_WIDTH, LCD_HEIGHT);
+    dash_root = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(dash_root);
+    lv_obj_set_size(dash_root, LCD_WIDTH, LCD_HEIGHT);
+    lv_obj_clear_flag(dash_root, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+
+    for (int i = 0; i < DASH_TILE_COUNT; i++) {
+        const DashTileDef *d = &DASH_TILES[i];
+        DashTile *t = &dash_tiles[i];
+        lv_obj_t *frame = lv_obj_create(dash_static);
+        lv_obj_remove_style_all(frame);
+        lv_obj_add_style(frame, &style_tile, 0);
+        lv_obj_set_pos(frame, d->x, d->y);
+        lv_obj_set_size(frame, d->w, DASH_TILE_H);
+        lv_obj_t *cap = lv_label_create(dash_static);
+        lv_obj_add_style(cap, &style_caption, 0);
+        lv_label_set_text(cap, d->name);
+        lv_obj_set_pos(cap, d->x + 12, d->y + 6);
+
+        lv_obj_t *num = numeric_display_create(dash_root, &t->nd, &digits_tile, d->int_cells,
+                                               &digits_tile, d->decimals, 2);
+        lv_obj_add_style(num, &style_value, 0);
+        int32_t num_w = t->nd.cells[t->nd.cell_count - 1].area.x2 + 1;  // Layout not run yet
+        lv_obj_set_pos(num, d->x + d->w - 10 - num_w, d->y + 28);
+        t->bar_w = d->w - 24;
+        lv_obj_t *track = lv_obj_create(dash_root);
+        lv_obj_remove_style_all(track);
+        lv_obj_add_style(track, &style_track, 0);
+        lv_obj_set_pos(track, d->x + 12, d->y + DASH_TILE_H - 16);
+        lv_obj_set_size(track, t->bar_w, 6);
+        lv_obj_clear_flag(track, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+        t->fill = lv_obj_create(track);
+        lv_obj_remove_style_all(t->fill);
+        lv_obj_set_style_radius(t->fill, 4, 0);
+        lv_obj_set_style_bg_opa(t->fill, LV_OPA_COVER, 0);
+        lv_obj_set_size(t->fill, 0, 6);
+        t->zone = 1;
+        t->valid = false;
+    }
+    if (!dash_view) {
+        lv_obj_add_flag(dash_static, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_add_flag(dash_root, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+void dash_update(bool force) {
+    static const int32_t POW10[] = { 1, 10, 100 };
+    force |= dash_recolor;
+    dash_recolor = false;
+    for (int i = 0; i < DASH_TILE_COUNT; i++) {
+        const DashTileDef *d = &DASH_TILES[i];
+        DashTile *t = &dash_tiles[i];
+        float v = dash_value(i);
+        int32_t scaled = (int32_t)(v * POW10[d->decimals]);
+        if (t->valid && scaled == t->scaled && !force) continue;  // Tile untouched this frame
+        t->scaled = scaled;
+        t->valid = true;
+        numeric_display_set(&t->nd, scaled);  // Invalidates only the changed cells
+
+        float norm = (v - d->min) / (d->max - d->min);
+        int32_t px = (int32_t)(LV_CLAMP(0.0f, norm, 1.0f) * t->bar_w);
+        int z = i == DASH_RPM ? 1 : mode_zone((GaugeMode)i, v, t->zone);
+        if (z != t->zone || force) {
+            t->zone = z;
+            lv_obj_set_style_bg_color(t->fill, lv_color_hex(ZONE_COLOR(z)), 0);
+        }
+        if (px != t->fill_px) {
+            t->fill_px = px;
+            lv_obj_set_width(t->fill, px);
+        }
+    }
+}
+
+// Swap between the single gauge and the tiles. The static layer is rebuilt
+// once for the tile frames; everything else is a visibility flip.
+void set_view(bool dash) {
+    lv_obj_t *gauge_objs[] = { bar, peak_dot, needle_tip, val_display, mode_label };
+    for (lv_obj_t *o : gauge_objs) {
+        if (dash) lv_obj_add_flag(o, LV_OBJ_FLAG_HIDDEN);
+        else lv_obj_clear_flag(o, LV_OBJ_FLAG_HIDDEN);
+    }
+    if (!dash && !peak_hold_enabled) lv_obj_add_flag(peak_dot, LV_OBJ_FLAG_HIDDEN);
+    if (trend_obj) {
+        if (!dash && show_trend) { trend_rebuild(); lv_obj_clear_flag(trend_obj, LV_OBJ_FLAG_HIDDEN); }
+        else lv_obj_add_flag(trend_obj, LV_OBJ_FLAG_HIDDEN);
+    }
+    if (arc_obj) {
+        if (!dash && show_arc) lv_obj_clear_flag(arc_obj, LV_OBJ_FLAG_HIDDEN);
+        else lv_obj_add_flag(arc_obj, LV_OBJ_FLAG_HIDDEN);
+    }
+    if (shift_obj) {
+        if (!dash && shift_light) lv_obj_clear_flag(shift_obj, LV_OBJ_FLAG_HIDDEN);
+        else lv_obj_add_flag(shift_obj, LV_OBJ_FLAG_HIDDEN);  // The RPM tile takes over
+    }
+    if (dash) { lv_obj_clear_flag(dash_static, LV_OBJ_FLAG_HIDDEN); lv_obj_clear_flag(dash_root, LV_OBJ_FLAG_HIDDEN); }
+    else { lv_obj_add_flag(dash_static, LV_OBJ_FLAG_HIDDEN); lv_obj_add_flag(dash_root, LV_OBJ_FLAG_HIDDEN); }
+    dash_view = dash;
+    static_dirty = true;
+    if (dash) dash_update(true);
+    input_changed();  // Run the next update for whichever view is now up
+}
+
+float bench_script_value(int f, float min, float max) {
+    float mid = (min + max) / 2;
+    static uint32_t lcg = 1;
+    if (f == 0) lcg = 1;
+    if (f < 90) return min + (max - min) * f / 90.0f;        // Ramp up
+    if (f < 120) return max;                                 // Hold (steady state)
+    if (f < 150) return mid;                                 // Step
+    if (f < 210) {                                           // Sensor noise +-2%
+        lcg = lcg * 1664525u + 1013904223u;
+        return mid + (max - min) * 0.02f * (((lcg >> 16) & 0xFF) / 127.5f - 1.0f);
+    }
+    return max - (max - min) * (f - 210) / 90.0f;            // Ramp down
+}
+
+bench_summary_t run_render_bench() {
+    bool prev_test = test_mode_enabled;
+    test_mode_enabled = false;
+    float min = GAUGES[current_mode].min;
+    float max = GAUGES[current_mode].max;
+    uint32_t sum_us = 0, max_us = 0, sum_px = 0, sum_inv = 0, sum_flush = 0, busy = 0;
+    unsigned long t = millis();
+
+    Serial.printf("BENCH mode=%s frames=%d\n", GAUGES[current_mode].name, BENCH_FRAMES);
+    heatmap_reset();
+    heatmap_set_recording(true);
+    Serial.println("frame,value,render_us,inv_areas,flushes,px_touched");
+    for (int f = 0; f < BENCH_FRAMES; f++) {
+        float v = bench_script_value(f, min, max);
+        set_channel_value(current_mode, v);
+        uint32_t seq = render_stats_last()->frame;
+        t += 33;
+        update_gauge_master(t);
+        lv_refr_now(NULL);
+
+        render_frame_stats_t st = {};
+        if (render_stats_last()->frame != seq) st = *render_stats_last();
+        Serial.printf("%d,%.2f,%u,%u,%u,%u\n", f, v, (unsigned)st.render_us, st.inv_areas, st.flushes, (unsigned)st.px_touched);
+        sum_us += st.render_us; sum_px += st.px_touched; sum_inv += st.inv_areas; sum_flush += st.flushes;
+        if (st.render_us > max_us) max_us = st.render_us;
+        if (st.flushes) busy++;
+    }
+    bench_summary_t sum = { BENCH_FRAMES, sum_us / BENCH_FRAMES, max_us, busy, sum_px / BENCH_FRAMES,
+                            sum_inv / (float)BENCH_FRAMES, sum_flush / (float)BENCH_FRAMES };
+    Serial.printf("BENCH summary: avg_us=%u max_us=%u busy_frames=%u avg_px=%u avg_inv=%.1f avg_flush=%.1f\n",
+                  (unsigned)sum.avg_us, (unsigned)sum.max_us, (unsigned)sum.busy_frames, (unsigned)sum.avg_px,
+                  sum.avg_inv, sum.avg_flush);
+    heatmap_set_recording(false);
+    heatmap_report(GAUGES[current_mode].name);
+    test_mode_enabled = prev_test;
+    return sum;
 }
 
 // --- CAN BUS ---
@@ -607,11 +1630,18 @@ void process_can_queue_task(void *arg) {
   twai_message_t message;
   while (1) {
     if (xQueueReceive(canMsgQueue, &message, pdMS_TO_TICKS(1)) == pdPASS) {
+      uint32_t t0 = prof_now();
+      uint32_t seq = ++can_proc_seq;
+      trace_begin(tr_can_decode, message.identifier);
+      trace_flow(tr_can_flow, seq);
+      xSemaphoreTake(can_data_lock, portMAX_DELAY);
+      HaltechData_t before = HaltechData;
       switch (message.identifier) {
         case 0x360: { 
           HaltechData.rpm = get_uint16_be(message.data, 0);
           uint16_t raw_map = get_uint16_be(message.data, 2);
           HaltechData.boost_psi = (raw_map * 0.1 - 101.3) * 0.145038;
+          shift_state = shift_light_state(HaltechData.rpm);  // At frame rate, shown on the next loop pass
           break;
         }
         case 0x361: { 
@@ -630,6 +1660,26 @@ void process_can_queue_task(void *arg) {
           break;
         }
       }
+      metric_inc(m_can_frames);
+      // Each reading enters the history at its own frame rate
+      switch (message.identifier) {
+        case 0x360: history_sample(DASH_RPM, HaltechData.rpm); history_sample(MODE_BOOST, HaltechData.boost_psi); break;
+        case 0x361: history_sample(MODE_OIL, HaltechData.oil_press_psi); break;
+        case 0x362: history_sample(MODE_WATER, HaltechData.water_temp_c); break;
+        case 0x368: history_sample(MODE_AFR, HaltechData.afr_gas); break;
+      }
+      // Frames repeat at a fixed rate; only a changed reading counts as new input
+      if (memcmp(&before, &HaltechData, sizeof(HaltechData_t)) != 0) {
+        input_flow = seq;
+        input_changed();
+        metric_inc(m_can_changes);
+        metric_set(m_boost, HaltechData.boost_psi); metric_set(m_afr, HaltechData.afr_gas);
+        metric_set(m_rpm, HaltechData.rpm); metric_set(m_water, HaltechData.water_temp_c);
+        metric_set(m_oil, HaltechData.oil_press_psi);
+      }
+      xSemaphoreGive(can_data_lock);
+      prof_end(PROF_SAMPLE, t0);
+      trace_end(tr_can_decode);
     }
     vTaskDelay(pdMS_TO_TICKS(1));
   }
@@ -639,7 +1689,12 @@ void receive_can_task(void *arg) {
   while (1) {
     twai_message_t message;
     if (twai_receive(&message, pdMS_TO_TICKS(5)) == ESP_OK) {
-      xQueueSend(canMsgQueue, &message, 0);
+      trace_begin(tr_can_rx, message.identifier);
+      if (xQueueSend(canMsgQueue, &message, 0) == pdPASS) {
+        trace_flow(tr_can_flow, ++can_rx_seq);
+        trace_counter(tr_queue, uxQueueMessagesWaiting(canMsgQueue));
+      }
+      trace_end(tr_can_rx);
     }
     vTaskDelay(pdMS_TO_TICKS(1));
   }
@@ -647,6 +1702,7 @@ void receive_can_task(void *arg) {
 
 void setup() {
   Serial.begin(115200);
+  loop_task = xTaskGetCurrentTaskHandle();  // setup() and loop() share the Arduino loop task
   drivers_init();
   lv_obj_set_style_bg_color(lv_scr_act(), lv_color_black(), 0); 
 
@@ -663,27 +1719,69 @@ void setup() {
   color_peak = preferences.getUInt("cp", 0xFFFFFF);
   current_brightness = preferences.getInt("bright", 40);
   peak_hold_enabled = preferences.getBool("peak", true); // LOAD PEAK SETTING
+  needle_image = preferences.getBool("nimg", false);
+  bg_artwork = preferences.getBool("bgart", false);
+  dash_view = preferences.getBool("dash", false);
+  show_trend = preferences.getBool("trend", false);
+  shift_light = preferences.getBool("shift", false);
+  ring_gradient = preferences.getBool("rgrad", false);
+  show_arc = preferences.getBool("arc", false);
+  shift_start_rpm = preferences.getInt("rpm_lo", 5000);
+  shift_rpm = preferences.getInt("rpm_sh", 7000);
   preferences.end();
 
   set_backlight(current_brightness);
-  load_current_style(); 
+  render_stats_attach(lv_display_get_default());
+  lvgl_set_flush_hook(flush_hook);
+  prof_init(getCpuFrequencyMhz());
+  metrics_init();
+  history_init(HISTORY_SCALES, DASH_TILE_COUNT, HISTORY_DEFAULT_BUDGET);  // Four modes + RPM
+  trace_setup();
+  render_stats_set_frame_cb(profile_frame);
+  heatmap_attach(lv_display_get_default());
+
+  // Needle path: SSW (135 deg) clockwise through North (270 deg) to SSE (45 deg),
+  // from 185 px radius to the inside of the ring at 225 px
+  needle_lut_init(240, 240, 185, 225, GAUGES[0].sweep_start_deg, GAUGES[0].sweep_range_deg);
+  needle_seg = *needle_lut_get(0);
+  if (needle_image) needle_sprites_load();  // In the background; otherwise on the first /needle?i=1
+  ring_mask_init(480, 16);  // Full-screen ring, 16 px band
+  // Top 120 deg, just inside the needle's inner end (r 185)
+  shift_light_init(240, 240, 164, 178, 210.0f, 120.0f);
+  shift_light_set_rpm_range(shift_start_rpm, shift_rpm);
+  zone_color = color_low;
+  build_screen(); 
+  if (dash_view) set_view(true);
 
   setup_wifi();
   
   canMsgQueue = xQueueCreate(CAN_QUEUE_LENGTH, CAN_QUEUE_ITEM_SIZE);
+  can_data_lock = xSemaphoreCreateMutex();
   xTaskCreatePinnedToCore(receive_can_task, "RxCAN", 4096, NULL, 2, NULL, 1);
   xTaskCreatePinnedToCore(process_can_queue_task, "ProcCAN", 4096, NULL, 2, NULL, 1);
+  xTaskCreatePinnedToCore(settings_save_task, "Settings", 3072, NULL, 1, &settings_task, 0);
 }
 
 void loop() {
-  lv_timer_handler();
+  static_layer_sync();
+  trace_begin(tr_lvgl);
+  uint32_t lv_next_ms = lv_timer_handler();
+  trace_end(tr_lvgl);
   server.handleClient();
   
   // --- FLAG HANDLERS ---
-  if (flag_reboot) { delay(500); ESP.restart(); }
+  if (pending_mode >= 0) {
+      int m = pending_mode;
+      pending_mode = -1;
+      switch_mode((GaugeMode)m);
+  }
   if (flag_theme_update) {
       flag_theme_update = false;
-      load_current_style(); 
+      apply_theme_timed(); 
+  }
+  if (flag_bench) {
+      flag_bench = false;
+      run_render_bench();
   }
   if (flag_bright_update) {
       flag_bright_update = false;
@@ -692,12 +1790,26 @@ void loop() {
   if (flag_new_peer) {
       flag_new_peer = false;
       lv_obj_clear_flag(link_icon, LV_OBJ_FLAG_HIDDEN); 
+      static_dirty = true;
   }
   if (flag_stats_update) {
       flag_stats_update = false;
       if(show_perf_stats) lv_obj_clear_flag(perf_label, LV_OBJ_FLAG_HIDDEN);
       else lv_obj_add_flag(perf_label, LV_OBJ_FLAG_HIDDEN);
   }
+  if (flag_heatmap_update) {
+      flag_heatmap_update = false;
+      heatmap_show(show_heatmap);
+  }
+  if (flag_needle_update) {
+      flag_needle_update = false;
+      needle_style_apply();
+  }
+  if (show_heatmap) heatmap_tick(millis());
+  if (shift_light && !dash_view) shift_light_apply(shift_obj, shift_state, millis());  // No-op unless a segment changed
+  if (history_tick(millis()) && trend_obj && show_trend && !dash_view) {
+      trend_update();  // New columns only, the rest scrolls by addressing
+  }
 
   // --- STATS LOGIC ---
   if (show_perf_stats) {
@@ -706,7 +1818,7 @@ void loop() {
           perf_fps = perf_frames;
           perf_frames = 0;
           perf_last_time = millis();
-          lv_label_set_text_fmt(perf_label, "FPS: %d\nMS: %d", perf_fps, perf_frame_ms);
+          update_perf_label();
       }
   }
 
@@ -719,16 +1831,54 @@ void loop() {
       unsigned long start = millis();
       last_data_time = start;
       if (test_mode_enabled) {
+          uint32_t t0 = prof_now();
           static float t=0; t+=0.05;
           HaltechData.boost_psi = -15 + (sin(t) + 1) * 22.5; 
           HaltechData.afr_gas = 8 + (sin(t*0.5) + 1) * 7.0; 
           HaltechData.water_temp_c = 50 + (sin(t*0.3) + 1) * 35.0; 
           HaltechData.oil_press_psi = 10 + (sin(t*0.7) + 1) * 45.0; 
+          HaltechData.rpm = 1000 + (sin(t*0.9) + 1) * 3600;
+          shift_state = shift_light_state(HaltechData.rpm);
+          history_sample_all();
+          input_gen++;  // Synthetic data changes every tick
+          prof_end(PROF_SAMPLE, t0);
+      }
+      // Change-driven: only update while new samples arrive or the needle is still moving
+      if (input_gen != input_gen_seen || !gauge_settled(start)) {
+          input_gen_seen = input_gen;
+          set_render_idle(false);
+          uint32_t t0 = prof_now();
+          trace_begin(tr_update);
+          uint32_t flow = input_flow;
+          if (flow != flow_updated) { trace_flow(tr_can_flow, flow); flow_updated = flow_pending = flow; }
+          if (dash_view) dash_update(false);
+          else update_gauge_master(start);
+          trace_end(tr_update);
+          prof_end(PROF_UPDATE, t0);
+      } else {
+          set_render_idle(true);
+          // A sample that landed after the check saw render_idle still false and
+          // sent no notification: don't sleep on it
+          if (input_gen != input_gen_seen) set_render_idle(false);
       }
-      update_gauge_master();
-      
-      if(show_perf_stats) perf_frame_ms = millis() - start;
   }
   yield();
-  vTaskDelay(pdMS_TO_TICKS(5));
+
+  // Sleep until the next LVGL timer is due (capped) or new data wakes us
+  uint32_t sleep_ms = render_idle ? LV_MIN(lv_next_ms, (uint32_t)IDLE_POLL_MS) : 5;
+  unsigned long sleep_start = micros();
+  uint32_t sleep_cycles = prof_now();
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(sleep_ms));
+  prof_end(PROF_IDLE, sleep_cycles);
+  trace_complete(tr_idle, prof_now() - sleep_cycles);
+  loop_sleep_us += micros() - sleep_start;
+  prof_tick(millis());
+  if (millis() - load_window_start >= 1000) {
+      unsigned long window_us = (millis() - load_window_start) * 1000UL;
+      loop_load_pct = 100 - (int)(100ULL * LV_MIN(loop_sleep_us, window_us) / window_us);
+      loop_sleep_us = 0;
+      load_window_start = millis();
+      metric_set(m_fps, perf_fps); metric_set(m_load, loop_load_pct);
+      metric_set(m_idle, render_idle); metric_set(m_displayed, gauge.displayed);
+  }
 }
\ No newline at end of file
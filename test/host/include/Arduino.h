@@ -0,0 +1,88 @@
+#pragma once
+// Host shim: the parts of the Arduino core the firmware uses, on the C++ library
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdarg.h>
+#include <string>
+#include "esp_timer.h"
+#include "esp_cpu.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+class String {
+ public:
+  String(const char *s = "") : s_(s ? s : "") {}
+  String(const std::string &s) : s_(s) {}
+  String(char c) : s_(1, c) {}
+  String(int v) : s_(std::to_string(v)) {}
+  String(unsigned int v) : s_(std::to_string(v)) {}
+  String(long v) : s_(std::to_string(v)) {}
+  String(unsigned long v) : s_(std::to_string(v)) {}
+  String(long long v) : s_(std::to_string(v)) {}
+  String(unsigned long long v) : s_(std::to_string(v)) {}
+  String(double v, unsigned int decimals = 2) {
+    char buf[48];
+    snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+    s_ = buf;
+  }
+  String(float v, unsigned int decimals = 2) : String((double)v, decimals) {}
+
+  const char *c_str() const { return s_.c_str(); }
+  unsigned int length() const { return (unsigned int)s_.size(); }
+  bool reserve(unsigned int n) { s_.reserve(n); return true; }
+  long toInt() const { return strtol(s_.c_str(), NULL, 10); }
+  float toFloat() const { return strtof(s_.c_str(), NULL); }
+  String substring(unsigned int from) const { return from < s_.size() ? String(s_.substr(from)) : String(); }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from > to) { unsigned int t = from; from = to; to = t; }
+    return from < s_.size() ? String(s_.substr(from, to - from)) : String();
+  }
+  int indexOf(char c) const { size_t p = s_.find(c); return p == std::string::npos ? -1 : (int)p; }
+  void replace(const String &find, const String &with) {
+    if (find.s_.empty()) return;
+    for (size_t p = 0; (p = s_.find(find.s_, p)) != std::string::npos; p += with.s_.size())
+      s_.replace(p, find.s_.size(), with.s_);
+  }
+
+  String &operator+=(const String &o) { s_ += o.s_; return *this; }
+  String &operator+=(const char *o) { s_ += o; return *this; }
+  String &operator+=(char c) { s_ += c; return *this; }
+  friend String operator+(const String &a, const String &b) { return String(a.s_ + b.s_); }
+  friend String operator+(const String &a, const char *b) { return String(a.s_ + b); }
+  friend String operator+(const char *a, const String &b) { return String(a + b.s_); }
+  friend String operator+(const String &a, char c) { return String(a.s_ + c); }
+  bool operator==(const String &o) const { return s_ == o.s_; }
+  bool operator==(const char *o) const { return s_ == o; }
+  bool operator!=(const String &o) const { return s_ != o.s_; }
+
+ private:
+  std::string s_;
+};
+
+// Serial goes to stdout, so harness output reads like the device log
+class HostSerial {
+ public:
+  void begin(unsigned long baud) { (void)baud; }
+  int printf(const char *fmt, ...) __attribute__((format(printf, 2, 3))) {
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vprintf(fmt, ap);
+    va_end(ap);
+    return n;
+  }
+  void print(const String &s) { fputs(s.c_str(), stdout); }
+  void println(const String &s) { puts(s.c_str()); }
+  void println() { putchar('\n'); }
+  void flush() { fflush(stdout); }
+};
+inline HostSerial Serial;
+
+inline const int64_t host_boot_us = esp_timer_get_time();
+inline unsigned long millis() { return (unsigned long)((esp_timer_get_time() - host_boot_us) / 1000); }
+inline unsigned long micros() { return (unsigned long)(esp_timer_get_time() - host_boot_us); }
+inline void delay(unsigned long ms) { vTaskDelay(ms); }
+inline void yield() {}
+inline uint32_t getCpuFrequencyMhz() { return HOST_CPU_MHZ; }
@@ -0,0 +1,17 @@
+#pragma once
+// Host shim: an empty namespace every run; reads return the defaults, writes are dropped
+#include <Arduino.h>
+
+class Preferences {
+ public:
+  bool begin(const char *name, bool read_only = false) { (void)name; (void)read_only; return true; }
+  void end() {}
+  int32_t getInt(const char *key, int32_t def = 0) { (void)key; return def; }
+  uint32_t getUInt(const char *key, uint32_t def = 0) { (void)key; return def; }
+  bool getBool(const char *key, bool def = false) { (void)key; return def; }
+  float getFloat(const char *key, float def = NAN) { (void)key; return def; }
+  size_t putInt(const char *key, int32_t v) { (void)key; (void)v; return sizeof(v); }
+  size_t putUInt(const char *key, uint32_t v) { (void)key; (void)v; return sizeof(v); }
+  size_t putBool(const char *key, bool v) { (void)key; (void)v; return sizeof(v); }
+  size_t putFloat(const char *key, float v) { (void)key; (void)v; return sizeof(v); }
+};
@@ -0,0 +1,68 @@
+#pragma once
+// Host shim: no sockets. Handlers are registered as usual and a harness calls
+// them in process with host_request("/path?a=1&b=2"); the response is kept.
+#include <Arduino.h>
+#include <functional>
+#include <map>
+#include <string>
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+
+class WebServer {
+ public:
+  typedef std::function<void(void)> THandlerFunction;
+
+  struct Response {
+    int code = 0;
+    std::string content_type;
+    std::string body;   // send() body followed by every sendContent() chunk
+  };
+
+  explicit WebServer(int port = 80) { (void)port; }
+  void begin() {}
+  void handleClient() {}
+  void on(const char *uri, THandlerFunction fn) { handlers_[uri] = fn; }
+
+  bool hasArg(const char *name) const { return args_.count(name) != 0; }
+  String arg(const char *name) const {
+    auto it = args_.find(name);
+    return it == args_.end() ? String() : String(it->second);
+  }
+
+  void sendHeader(const char *name, const char *value) { (void)name; (void)value; }
+  void setContentLength(size_t len) { (void)len; }
+  void send(int code, const char *content_type = "", const String &content = String()) {
+    resp_.code = code;
+    resp_.content_type = content_type;
+    resp_.body.append(content.c_str(), content.length());
+  }
+  void send(int code, const char *content_type, const char *content) { send(code, content_type, String(content)); }
+  void sendContent(const char *data, size_t len) { resp_.body.append(data, len); }
+  void sendContent(const String &s) { resp_.body.append(s.c_str(), s.length()); }
+
+  // Run the handler for `request` ("/golden?case=0&ref=1"); 404 if none matches
+  const Response &host_request(const char *request) {
+    std::string req = request, path = req, query;
+    size_t q = req.find('?');
+    if (q != std::string::npos) { path = req.substr(0, q); query = req.substr(q + 1); }
+    args_.clear();
+    for (size_t p = 0; p < query.size();) {
+      size_t amp = query.find('&', p);
+      if (amp == std::string::npos) amp = query.size();
+      std::string kv = query.substr(p, amp - p);
+      size_t eq = kv.find('=');
+      if (!kv.empty()) args_[kv.substr(0, eq)] = eq == std::string::npos ? "" : kv.substr(eq + 1);
+      p = amp + 1;
+    }
+    resp_ = Response();
+    auto it = handlers_.find(path);
+    if (it == handlers_.end()) resp_.code = 404;
+    else it->second();
+    return resp_;
+  }
+
+ private:
+  std::map<std::string, THandlerFunction> handlers_;
+  std::map<std::string, std::string> args_;
+  Response resp_;
+};
@@ -0,0 +1,20 @@
+#pragma once
+// Host shim: no radio
+#include <Arduino.h>
+
+#define WIFI_AP_STA 3
+
+class HostWiFi {
+ public:
+  bool mode(int m) { (void)m; return true; }
+  bool softAP(const char *ssid, const char *pass = NULL, int channel = 1) {
+    (void)ssid; (void)pass; (void)channel;
+    return true;
+  }
+  uint8_t *macAddress(uint8_t *mac) {
+    static const uint8_t HOST_MAC[6] = { 0x02, 0, 0, 0, 0, 0x01 };
+    memcpy(mac, HOST_MAC, 6);
+    return mac;
+  }
+};
+inline HostWiFi WiFi;
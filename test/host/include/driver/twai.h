@@ -0,0 +1,18 @@
+#pragma once
+// Host shim: no CAN controller, nothing is ever received
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef int gpio_num_t;
+
+typedef struct {
+  uint32_t flags;
+  uint32_t identifier;
+  uint8_t data_length_code;
+  uint8_t data[8];
+} twai_message_t;
+
+static inline esp_err_t twai_receive(twai_message_t *message, uint32_t ticks_to_wait) {
+  (void)message; (void)ticks_to_wait;
+  return ESP_ERR_TIMEOUT;
+}
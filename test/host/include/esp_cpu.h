@@ -0,0 +1,13 @@
+#pragma once
+// Host shim: the cycle counter runs at 1 GHz (nanoseconds), see getCpuFrequencyMhz()
+#include <stdint.h>
+#include <time.h>
+
+#define HOST_CPU_MHZ 1000
+
+static inline uint32_t esp_cpu_get_cycle_count(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)((uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec);
+}
+static inline int esp_cpu_get_core_id(void) { return 0; }
@@ -0,0 +1,7 @@
+#pragma once
+#include <stdio.h>
+
+typedef int esp_err_t;
+#define ESP_OK    0
+#define ESP_FAIL  -1
+#define ESP_ERR_TIMEOUT 0x107
@@ -0,0 +1,19 @@
+#pragma once
+// Host shim: one heap, every capability
+#include <stdlib.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#define MALLOC_CAP_8BIT      (1 << 2)
+#define MALLOC_CAP_DMA       (1 << 3)
+#define MALLOC_CAP_SPIRAM    (1 << 10)
+#define MALLOC_CAP_INTERNAL  (1 << 11)
+
+static inline void *heap_caps_malloc(size_t size, uint32_t caps) { (void)caps; return malloc(size); }
+static inline void *heap_caps_calloc(size_t n, size_t size, uint32_t caps) { (void)caps; return calloc(n, size); }
+static inline void *heap_caps_aligned_alloc(size_t align, size_t size, uint32_t caps) {
+  (void)caps;
+  return aligned_alloc(align, (size + align - 1) / align * align);
+}
+static inline void heap_caps_free(void *p) { free(p); }
+static inline size_t heap_caps_get_free_size(uint32_t caps) { (void)caps; return SIZE_MAX; }
@@ -0,0 +1,12 @@
+#pragma once
+// Host shim: a single core, calls run in place
+#include <stdint.h>
+
+#include "esp_err.h"
+typedef void (*esp_ipc_func_t)(void *arg);
+
+static inline esp_err_t esp_ipc_call_blocking(uint32_t cpu_id, esp_ipc_func_t func, void *arg) {
+  (void)cpu_id;
+  func(arg);
+  return 0;
+}
@@ -0,0 +1,5 @@
+#pragma once
+// Host shim: no PSRAM, everything counts as internal
+#include <stdbool.h>
+
+static inline bool esp_ptr_internal(const void *p) { return p != 0; }
@@ -0,0 +1,34 @@
+#pragma once
+// Host shim: ESP-NOW with no peers; sends go nowhere, nothing is received
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_wifi.h"
+
+#define ESP_NOW_ETH_ALEN 6
+
+typedef struct {
+  uint8_t *src_addr;
+  uint8_t *des_addr;
+} esp_now_recv_info_t;
+
+typedef struct {
+  uint8_t peer_addr[ESP_NOW_ETH_ALEN];
+  uint8_t lmk[16];
+  uint8_t channel;
+  wifi_interface_t ifidx;
+  bool encrypt;
+  void *priv;
+} esp_now_peer_info_t;
+
+typedef void (*esp_now_recv_cb_t)(const esp_now_recv_info_t *info, const uint8_t *data, int len);
+
+static inline esp_err_t esp_now_init(void) { return ESP_OK; }
+static inline esp_err_t esp_now_register_recv_cb(esp_now_recv_cb_t cb) { (void)cb; return ESP_OK; }
+static inline bool esp_now_is_peer_exist(const uint8_t *addr) { (void)addr; return true; }
+static inline esp_err_t esp_now_add_peer(const esp_now_peer_info_t *peer) { (void)peer; return ESP_OK; }
+static inline esp_err_t esp_now_send(const uint8_t *addr, const uint8_t *data, size_t len) {
+  (void)addr; (void)data; (void)len;
+  return ESP_OK;
+}
@@ -0,0 +1,22 @@
+#pragma once
+// Host shim: esp_timer on the monotonic clock
+#include <stdint.h>
+#include <time.h>
+#include "esp_err.h"
+
+// Tests can move the clock forward to replay hours of readings in a moment,
+// or freeze it so every reading lands at an exact time
+inline int64_t host_timer_offset_us = 0;
+inline int64_t host_timer_frozen_us = -1;   // >= 0: the clock stands still here
+static inline void host_timer_advance(int64_t us) {
+  if (host_timer_frozen_us >= 0) host_timer_frozen_us += us;
+  else host_timer_offset_us += us;
+}
+static inline void host_timer_freeze(int64_t us) { host_timer_frozen_us = us; }
+
+static inline int64_t esp_timer_get_time(void) {
+  if (host_timer_frozen_us >= 0) return host_timer_frozen_us;
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000 + host_timer_offset_us;
+}
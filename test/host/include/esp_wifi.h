@@ -0,0 +1,13 @@
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef enum { WIFI_SECOND_CHAN_NONE = 0 } wifi_second_chan_t;
+typedef enum { WIFI_IF_STA = 0, WIFI_IF_AP = 1 } wifi_interface_t;
+
+static inline esp_err_t esp_wifi_set_promiscuous(bool en) { (void)en; return ESP_OK; }
+static inline esp_err_t esp_wifi_set_channel(uint8_t primary, wifi_second_chan_t second) {
+  (void)primary; (void)second;
+  return ESP_OK;
+}
@@ -0,0 +1,32 @@
+#pragma once
+// Host shim: one thread and no scheduler. Tasks are registered but never run
+// (the harness drives the loop task's work itself), so critical sections and
+// notifications have nothing to exclude or wake.
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_timer.h"
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef void *TaskHandle_t;
+typedef void *QueueHandle_t;
+typedef void (*TaskFunction_t)(void *arg);
+
+#define pdTRUE   1
+#define pdFALSE  0
+#define pdPASS   pdTRUE
+#define pdFAIL   pdFALSE
+#define portMAX_DELAY ((TickType_t)0xffffffffu)
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define IRAM_ATTR
+
+typedef struct { int owner; } portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED { 0 }
+#define portENTER_CRITICAL(mux)      ((void)(mux))
+#define portEXIT_CRITICAL(mux)       ((void)(mux))
+#define portENTER_CRITICAL_ISR(mux)  ((void)(mux))
+#define portEXIT_CRITICAL_ISR(mux)   ((void)(mux))
+
+static inline TickType_t xTaskGetTickCount(void) { return (TickType_t)(esp_timer_get_time() / 1000); }
@@ -0,0 +1,22 @@
+#pragma once
+#include "FreeRTOS.h"
+#include <time.h>
+
+#define tskIDLE_PRIORITY 0
+
+static inline TaskHandle_t xTaskGetCurrentTaskHandle(void) { return (TaskHandle_t)1; }
+static inline const char *pcTaskGetName(TaskHandle_t task) { (void)task; return "loopTask"; }
+static inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                                                 UBaseType_t prio, TaskHandle_t *handle, BaseType_t core) {
+  (void)fn; (void)name; (void)stack; (void)arg; (void)prio; (void)core;
+  if (handle) *handle = (TaskHandle_t)2;
+  return pdPASS;
+}
+static inline void vTaskDelete(TaskHandle_t task) { (void)task; }
+static inline void vTaskDelay(TickType_t ticks) {
+  struct timespec ts = { (time_t)(ticks / 1000), (long)(ticks % 1000) * 1000000L };
+  nanosleep(&ts, NULL);
+}
+static inline void xTaskNotifyGive(TaskHandle_t task) { (void)task; }
+// Nothing can notify: return at once rather than sleep out the timeout
+static inline uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t wait) { (void)clear; (void)wait; return 0; }
@@ -0,0 +1,5 @@
+#pragma once
+// Host stand-in for lib/CANBus_Driver: no controller, twai_receive() times out
+#include "driver/twai.h"
+
+void canbus_init();
@@ -0,0 +1,14 @@
+#pragma once
+// Host stand-in for lib/Display_ST7701: the panel is a framebuffer in memory
+#include <stdint.h>
+#include "I2C_Driver.h"
+#include "TCA9554PWR.h"
+
+#define ESP_PANEL_LCD_WIDTH   (480)
+#define ESP_PANEL_LCD_HEIGHT  (480)
+
+extern uint8_t LCD_Backlight;
+
+void lcd_init();
+uint16_t *lcd_get_framebuffer();   // Live RGB565 frame, for snapshots
+void set_backlight(uint8_t light);
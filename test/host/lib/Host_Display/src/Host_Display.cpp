@@ -0,0 +1,45 @@
+#include "LVGL_Driver.h"
+#include "Display_ST7701.h"
+#include "CANBus_Driver.h"
+#include <esp_cpu.h>
+#include <esp_timer.h>
+#include <string.h>
+
+// Same partial buffers as the board, so a frame splits into the same flushes
+#define BUF_SIZE (LCD_WIDTH * LCD_HEIGHT / 20)
+
+static uint16_t framebuffer[LCD_WIDTH * LCD_HEIGHT];
+alignas(32) static lv_color_t buf1[BUF_SIZE], buf2[BUF_SIZE];  // Sized like the board's (BUF_SIZE * sizeof(lv_color_t) bytes)
+static lvgl_flush_hook_t flush_hook = NULL;
+uint8_t LCD_Backlight = 0;
+
+void i2c_init(void) {}
+void tca9554pwr_init(uint8_t PinState) { (void)PinState; }
+void canbus_init() {}
+void lcd_init() { memset(framebuffer, 0, sizeof(framebuffer)); }
+uint16_t *lcd_get_framebuffer() { return framebuffer; }
+void set_backlight(uint8_t light) { LCD_Backlight = light; }
+
+void lvgl_set_flush_hook(lvgl_flush_hook_t hook) { flush_hook = hook; }
+
+void lvgl_flush_callback(lv_display_t *disp, const lv_area_t *area, uint8_t *color_p) {
+  uint32_t start = esp_cpu_get_cycle_count();
+  int32_t w = lv_area_get_width(area);
+  const uint16_t *src = (const uint16_t *)color_p;
+  for (int32_t y = area->y1; y <= area->y2; y++, src += w) {
+    memcpy(&framebuffer[y * LCD_WIDTH + area->x1], src, w * sizeof(uint16_t));
+  }
+  if (flush_hook) flush_hook(area, esp_cpu_get_cycle_count() - start);
+  lv_display_flush_ready(disp);
+}
+
+static uint32_t host_tick_ms(void) { return (uint32_t)(esp_timer_get_time() / 1000); }
+
+void lvgl_init(void) {
+  lv_init();
+  lv_tick_set_cb(host_tick_ms);
+
+  lv_display_t *disp = lv_display_create(LCD_WIDTH, LCD_HEIGHT);
+  lv_display_set_buffers(disp, buf1, buf2, sizeof(buf1), LV_DISPLAY_RENDER_MODE_PARTIAL);
+  lv_display_set_flush_cb(disp, lvgl_flush_callback);
+}
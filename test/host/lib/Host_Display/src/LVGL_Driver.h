@@ -0,0 +1,12 @@
+#pragma once
+// Host stand-in for lib/LVGL_Driver: same API, flushing into a memory framebuffer
+#include <lvgl.h>
+
+#define LCD_WIDTH 480
+#define LCD_HEIGHT 480
+
+typedef void (*lvgl_flush_hook_t)(const lv_area_t *area, uint32_t copy_cycles);
+void lvgl_set_flush_hook(lvgl_flush_hook_t hook);
+
+void lvgl_flush_callback(lv_display_t *disp, const lv_area_t *area, uint8_t *color_p);
+void lvgl_init(void);
@@ -0,0 +1,6 @@
+#pragma once
+// Host stand-in for lib/TCA9554PWR: no IO expander
+#include <stdint.h>
+#include "I2C_Driver.h"
+
+void tca9554pwr_init(uint8_t PinState = 0x00);
@@ -0,0 +1,230 @@
+// Blend_Kernels against LVGL's stock RGB565 blend loops: random sizes, strides,
+// alignments, colours, opacities, masks and images must come out bit-exact
+// (padding included), then both paths are timed on a panel-wide band.
+// Run with `pio test -e native -f test_blend_kernels -v` to see the report.
+#include <unity.h>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "Blend_Kernels.h"
+
+#define CASES_PER_KERNEL 2500
+#define MAX_W      67
+#define MAX_H      9
+#define MAX_PAD    5
+#define BENCH_W    480
+#define BENCH_H    48
+#define BENCH_REPS 200
+
+enum {
+  K_FILL, K_FILL_OPA, K_FILL_MASK, K_FILL_MASK_OPA,
+  K_IMAGE, K_IMAGE_OPA, K_IMAGE_MASK, K_IMAGE_MASK_OPA, KERNEL_COUNT
+};
+static const char *KERNEL_NAMES[KERNEL_COUNT] = {
+  "fill", "fill_opa", "fill_mask", "fill_mask_opa",
+  "image", "image_opa", "image_mask", "image_mask_opa",
+};
+static inline bool has_opa(int k) { return k & 1; }
+static inline bool has_mask(int k) { return (k & 3) >= 2; }
+static inline bool is_image(int k) { return k >= K_IMAGE; }
+
+// --- Stock path: lv_draw_sw_blend_to_rgb565.c, one pixel at a time ---
+
+// lv_color_16_16_mix (lv_color.h)
+static inline uint16_t lv_color_16_16_mix(uint16_t c1, uint16_t c2, uint8_t mix) {
+  if (mix == 255) return c1;
+  if (mix == 0) return c2;
+  if (c1 == c2) return c1;
+  mix = (uint32_t)((uint32_t)mix + 4) >> 3;
+  uint32_t bg = (uint32_t)(c2 | ((uint32_t)c2 << 16)) & 0x7E0F81F;
+  uint32_t fg = (uint32_t)(c1 | ((uint32_t)c1 << 16)) & 0x7E0F81F;
+  uint32_t result = ((((fg - bg) * mix) >> 5) + bg) & 0x7E0F81F;
+  return (uint16_t)(result >> 16) | result;
+}
+
+#define LV_OPA_MIX2(a1, a2) (((int32_t)(a1) * (a2)) >> 8)
+
+typedef struct {
+  int32_t w, h;
+  int32_t dst_stride, src_stride, mask_stride;   // Bytes, as LVGL passes them
+  const uint16_t *src;
+  const uint8_t *mask;
+  uint16_t color;
+  uint8_t opa;
+} blend_case_t;
+
+static void run_stock(int k, const blend_case_t *c, uint16_t *dst) {
+  for (int32_t y = 0; y < c->h; y++) {
+    uint16_t *d = (uint16_t *)((uint8_t *)dst + y * c->dst_stride);
+    const uint16_t *s = (const uint16_t *)((const uint8_t *)c->src + y * c->src_stride);
+    const uint8_t *m = c->mask + y * c->mask_stride;
+    for (int32_t x = 0; x < c->w; x++) {
+      uint8_t a = has_opa(k) ? c->opa : 255;
+      if (has_mask(k)) a = has_opa(k) ? LV_OPA_MIX2(m[x], c->opa) : m[x];
+      d[x] = lv_color_16_16_mix(is_image(k) ? s[x] : c->color, d[x], a);
+    }
+  }
+}
+
+static void run_kernel(int k, const blend_case_t *c, uint16_t *dst) {
+  switch (k) {
+    case K_FILL: blend_fill_rgb565(dst, c->w, c->h, c->dst_stride, c->color); break;
+    case K_FILL_OPA: blend_fill_opa_rgb565(dst, c->w, c->h, c->dst_stride, c->color, c->opa); break;
+    case K_FILL_MASK:
+      blend_fill_mask_rgb565(dst, c->w, c->h, c->dst_stride, c->color, c->mask, c->mask_stride);
+      break;
+    case K_FILL_MASK_OPA:
+      blend_fill_mask_opa_rgb565(dst, c->w, c->h, c->dst_stride, c->color, c->mask, c->mask_stride, c->opa);
+      break;
+    case K_IMAGE: blend_image_rgb565(dst, c->w, c->h, c->dst_stride, c->src, c->src_stride); break;
+    case K_IMAGE_OPA:
+      blend_image_opa_rgb565(dst, c->w, c->h, c->dst_stride, c->src, c->src_stride, c->opa);
+      break;
+    case K_IMAGE_MASK:
+      blend_image_mask_rgb565(dst, c->w, c->h, c->dst_stride, c->src, c->src_stride, c->mask, c->mask_stride);
+      break;
+    case K_IMAGE_MASK_OPA:
+      blend_image_mask_opa_rgb565(dst, c->w, c->h, c->dst_stride, c->src, c->src_stride,
+                                  c->mask, c->mask_stride, c->opa);
+      break;
+  }
+}
+
+// --- Random cases ---
+
+static uint32_t rng_state = 0x2545F491u;
+static uint32_t rng() {
+  rng_state ^= rng_state << 13;
+  rng_state ^= rng_state >> 17;
+  rng_state ^= rng_state << 5;
+  return rng_state;
+}
+static int32_t rng_range(int32_t lo, int32_t hi) { return lo + (int32_t)(rng() % (uint32_t)(hi - lo + 1)); }
+
+// Runs of a few colours, like flat backgrounds and artwork: exercises the
+// kernels' repeated-pair and equal-source shortcuts as well as the mixes
+static void random_pixels(uint16_t *px, int32_t n, const uint16_t *palette) {
+  for (int32_t i = 0; i < n;) {
+    uint16_t c = (rng() & 3) ? palette[rng() & 3] : (uint16_t)rng();
+    for (int32_t run = rng_range(1, 12); run > 0 && i < n; run--) px[i++] = c;
+  }
+}
+
+// Runs of 0 and 255 with anti-aliased values between them, like glyph and arc masks
+static void random_mask(uint8_t *m, int32_t n) {
+  for (int32_t i = 0; i < n;) {
+    uint32_t kind = rng() % 3;
+    for (int32_t run = rng_range(1, 9); run > 0 && i < n; run--)
+      m[i++] = kind == 0 ? 0 : kind == 1 ? 255 : (uint8_t)rng();
+  }
+}
+
+static void check_kernel(int k) {
+  // Buffers one pixel longer than the largest case, so rows can start unaligned
+  static uint16_t dst_kernel[MAX_H * (MAX_W + MAX_PAD) + 1];
+  static uint16_t dst_stock[MAX_H * (MAX_W + MAX_PAD) + 1];
+  static uint16_t src[MAX_H * (MAX_W + MAX_PAD) + 1];
+  static uint8_t mask[MAX_H * (MAX_W + MAX_PAD) + 3];
+  const int32_t dst_px = sizeof(dst_kernel) / sizeof(dst_kernel[0]);
+
+  for (int i = 0; i < CASES_PER_KERNEL; i++) {
+    blend_case_t c;
+    c.w = rng_range(1, MAX_W);
+    c.h = rng_range(1, MAX_H);
+    c.dst_stride = (c.w + rng_range(0, MAX_PAD)) * 2;
+    c.src_stride = (c.w + rng_range(0, MAX_PAD)) * 2;
+    c.mask_stride = c.w + rng_range(0, MAX_PAD);
+    c.color = (uint16_t)rng();
+    c.opa = (uint8_t)rng();
+    int32_t dst_ofs = rng() & 1, src_ofs = rng() & 1, mask_ofs = rng() & 3;
+
+    uint16_t palette[4] = { c.color, (uint16_t)rng(), (uint16_t)rng(), (uint16_t)rng() };
+    random_pixels(dst_kernel, dst_px, palette);
+    random_pixels(src, dst_px, palette);
+    if ((rng() & 7) == 0) memcpy(src, dst_kernel, sizeof(src));   // Image over itself
+    random_mask(mask, sizeof(mask));
+    memcpy(dst_stock, dst_kernel, sizeof(dst_kernel));
+    c.src = src + src_ofs;
+    c.mask = mask + mask_ofs;
+
+    run_kernel(k, &c, dst_kernel + dst_ofs);
+    run_stock(k, &c, dst_stock + dst_ofs);
+
+    // Whole buffers: the padding between rows must be left alone too
+    if (memcmp(dst_kernel, dst_stock, sizeof(dst_kernel)) != 0) {
+      int32_t p = 0;
+      while (dst_kernel[p] == dst_stock[p]) p++;
+      char msg[160];
+      snprintf(msg, sizeof(msg), "%s case %d: %dx%d dst_stride %d ofs %d color %04X opa %d, pixel %d: %04X != %04X",
+               KERNEL_NAMES[k], i, (int)c.w, (int)c.h, (int)c.dst_stride, (int)dst_ofs, c.color, c.opa,
+               (int)p, dst_kernel[p], dst_stock[p]);
+      TEST_FAIL_MESSAGE(msg);
+    }
+  }
+}
+
+static void test_fill_bit_exact(void) {
+  check_kernel(K_FILL);
+  check_kernel(K_FILL_OPA);
+  check_kernel(K_FILL_MASK);
+  check_kernel(K_FILL_MASK_OPA);
+}
+
+static void test_image_bit_exact(void) {
+  check_kernel(K_IMAGE);
+  check_kernel(K_IMAGE_OPA);
+  check_kernel(K_IMAGE_MASK);
+  check_kernel(K_IMAGE_MASK_OPA);
+}
+
+// --- Timing ---
+
+template <typename F> static double time_us(F fn) {
+  auto t0 = std::chrono::steady_clock::now();
+  for (int r = 0; r < BENCH_REPS; r++) fn();
+  auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(t1 - t0).count() / BENCH_REPS;
+}
+
+// One partial buffer band: a dark background, a vertical gradient image and the
+// mask of a filled circle, so masks are mostly 0 / 255 runs with AA edges
+static void test_timing(void) {
+  static uint16_t background[BENCH_W * BENCH_H], dst[BENCH_W * BENCH_H], image[BENCH_W * BENCH_H];
+  static uint8_t mask[BENCH_W * BENCH_H];
+  for (int32_t y = 0; y < BENCH_H; y++) {
+    for (int32_t x = 0; x < BENCH_W; x++) {
+      int32_t i = y * BENCH_W + x;
+      background[i] = 0x0841;
+      image[i] = (uint16_t)(((y * 31 / BENCH_H) << 11) | ((x * 63 / BENCH_W) << 5) | 0x0010);
+      float dx = x - BENCH_W / 2 + 0.5f, dy = (y - BENCH_H / 2 + 0.5f) * 8;
+      float cov = 200.0f - sqrtf(dx * dx + dy * dy) + 0.5f;
+      mask[i] = cov <= 0 ? 0 : cov >= 1 ? 255 : (uint8_t)(cov * 255);
+    }
+  }
+
+  blend_case_t c;
+  c.w = BENCH_W; c.h = BENCH_H;
+  c.dst_stride = c.src_stride = BENCH_W * 2;
+  c.mask_stride = BENCH_W;
+  c.src = image; c.mask = mask;
+  c.color = 0xFD20; c.opa = 128;
+
+  printf("\n%dx%d band      stock us  kernel us  speedup\n", BENCH_W, BENCH_H);
+  for (int k = 0; k < KERNEL_COUNT; k++) {
+    double stock_us = time_us([&] { memcpy(dst, background, sizeof(dst)); run_stock(k, &c, dst); });
+    double kernel_us = time_us([&] { memcpy(dst, background, sizeof(dst)); run_kernel(k, &c, dst); });
+    printf("  %-15s %8.2f  %9.2f  %6.2fx\n", KERNEL_NAMES[k], stock_us, kernel_us, stock_us / kernel_us);
+  }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_fill_bit_exact);
+  RUN_TEST(test_image_bit_exact);
+  RUN_TEST(test_timing);
+  return UNITY_END();
+}
@@ -0,0 +1,219 @@
+// Channel_History on the host: two hours of readings replayed through the
+// shimmed clock, then the append cost and the query cost per level for a
+// full trend buffer (720 points, what /history and the trend ask for). Last,
+// on a frozen clock, every bucket is checked against min / max / avg worked
+// out from the readings themselves.
+// Run with `pio test -e native -f test_channel_history -v` to see the report.
+#include <unity.h>
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+#include "Channel_History.h"
+#include "esp_timer.h"
+
+#define CHANNELS      4
+#define QUERY_POINTS  720
+#define BENCH_REPS    200
+#define APPENDS       200000
+#define TRUTH_START_MS 10000000u   // On a 10 s boundary, so every upper bucket is whole
+#define TRUTH_SECONDS  120
+
+static const float SCALES[CHANNELS] = { 100.0f, 1000.0f, 10.0f, 100.0f };
+static history_point_t points[QUERY_POINTS];
+
+static uint32_t now_ms() { return (uint32_t)(esp_timer_get_time() / 1000); }
+
+// A slow ramp per channel, so every bucket has a distinct min / max / avg
+static float reading(int ch, uint32_t step) { return (float)((step * (ch + 1)) % 997) / SCALES[ch] * 10.0f; }
+
+// Readings every step_ms on every channel, ticking the buckets like loop() does
+static void replay(uint32_t duration_ms, uint32_t step_ms) {
+  static uint32_t step = 0;
+  for (uint32_t t = 0; t < duration_ms; t += step_ms, step++) {
+    host_timer_advance(step_ms * 1000);
+    for (int ch = 0; ch < CHANNELS; ch++) history_sample(ch, reading(ch, step));
+    history_tick(now_ms());
+  }
+}
+
+template <typename F> static double time_us(F fn, int reps) {
+  auto t0 = std::chrono::steady_clock::now();
+  for (int r = 0; r < reps; r++) fn();
+  auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(t1 - t0).count() / reps;
+}
+
+static void test_replay_two_hours(void) {
+  TEST_ASSERT_TRUE(history_init(SCALES, CHANNELS, HISTORY_DEFAULT_BUDGET));
+  replay(2 * 3600 * 1000, 100);   // Enough for 720 points of every bucket level
+  replay(60 * 1000, 10);          // Then the CAN rate, for the raw ring
+
+  const history_stats_t *st = history_stats();
+  printf("\n%u KB for %d channels: raw %u, 100 ms %u, 1 s %u, 10 s %u per channel\n",
+         (unsigned)(st->bytes / 1024), CHANNELS, (unsigned)st->capacity[HISTORY_RAW],
+         (unsigned)st->capacity[HISTORY_100MS], (unsigned)st->capacity[HISTORY_1S],
+         (unsigned)st->capacity[HISTORY_10S]);
+  for (int l = HISTORY_100MS; l < HISTORY_LEVELS; l++)
+    TEST_ASSERT_TRUE(history_available((history_level_t)l) >= QUERY_POINTS);
+}
+
+// Oldest first, inside the window, and the min / avg / max in order
+static void test_query_points(void) {
+  uint32_t to = now_ms();
+  for (int l = HISTORY_RAW; l < HISTORY_LEVELS; l++) {
+    uint32_t span = l == HISTORY_RAW ? 5000 : history_bucket_ms((history_level_t)l) * QUERY_POINTS;
+    uint32_t from = to - span;
+    int n = history_query(1, (history_level_t)l, from, to, points, QUERY_POINTS);
+    TEST_ASSERT_TRUE(n > 0);
+    for (int i = 0; i < n; i++) {
+      TEST_ASSERT_TRUE(points[i].t_ms + history_bucket_ms((history_level_t)l) >= from);
+      TEST_ASSERT_TRUE(points[i].t_ms <= to);
+      if (i) TEST_ASSERT_TRUE(points[i].t_ms > points[i - 1].t_ms);
+      TEST_ASSERT_TRUE(points[i].min <= points[i].avg && points[i].avg <= points[i].max);
+    }
+  }
+}
+
+static void test_append_cost(void) {
+  static uint32_t step = 0;
+  uint32_t appends_before = history_stats()->appends;
+  double us = time_us([&] {
+    host_timer_advance(250);   // 4 kHz across the channels: a bucket closes every 400 appends
+    history_sample(step % CHANNELS, reading(step % CHANNELS, step));
+    step++;
+  }, APPENDS);
+  const history_stats_t *st = history_stats();
+  TEST_ASSERT_EQUAL_UINT32(appends_before + APPENDS, st->appends);
+  printf("\nappend: %.3f us per reading, stats avg %u / max %u ns\n",
+         us, (unsigned)st->append_avg_cycles, (unsigned)st->append_max_cycles);
+}
+
+static void test_query_cost(void) {
+  uint32_t to = now_ms();
+  printf("\nlevel     points  query us\n");
+  for (int l = HISTORY_RAW; l < HISTORY_LEVELS; l++) {
+    uint32_t span = l == HISTORY_RAW ? 60 * 1000 : history_bucket_ms((history_level_t)l) * QUERY_POINTS;
+    int n = 0;
+    double us = time_us([&] { n = history_query(0, (history_level_t)l, to - span, to, points, QUERY_POINTS); },
+                        BENCH_REPS);
+    TEST_ASSERT_EQUAL_INT(QUERY_POINTS, n);
+    static const char *NAMES[HISTORY_LEVELS] = { "raw", "100 ms", "1 s", "10 s" };
+    printf("  %-7s %6d  %8.2f\n", NAMES[l], n, us);
+  }
+}
+
+// --- Ground truth ---
+
+typedef struct { int16_t min, max, avg; } truth_bucket_t;
+typedef struct { uint32_t t_ms; int16_t v; } truth_sample_t;
+
+// Channel_History's rounding into int16 fixed point
+static int16_t truth_fixed(float v, float scale) {
+  float f = v * scale;
+  if (f > INT16_MAX) return INT16_MAX;
+  if (f < -INT16_MAX) return -INT16_MAX;
+  return (int16_t)(f < 0 ? f - 0.5f : f + 0.5f);
+}
+
+// 100 ms buckets straight from the readings; an empty one repeats the last reading
+static std::vector<truth_bucket_t> truth_100ms(const std::vector<truth_sample_t> &s, uint32_t k0, uint32_t k1) {
+  std::vector<truth_bucket_t> out;
+  int16_t last = 0;
+  size_t i = 0;
+  for (uint32_t k = k0; k < k1; k++) {
+    int32_t sum = 0, n = 0;
+    truth_bucket_t b = { last, last, last };
+    for (; i < s.size() && s[i].t_ms / 100 == k; i++, n++) {
+      if (!n || s[i].v < b.min) b.min = s[i].v;
+      if (!n || s[i].v > b.max) b.max = s[i].v;
+      sum += s[i].v;
+      last = s[i].v;
+    }
+    if (n) b.avg = (int16_t)(sum / n);
+    out.push_back(b);
+  }
+  return out;
+}
+
+// Each upper bucket from the ten below it: min of mins, max of maxes, mean of the averages
+static std::vector<truth_bucket_t> truth_fold(const std::vector<truth_bucket_t> &lower) {
+  std::vector<truth_bucket_t> out;
+  for (size_t j = 0; j + 10 <= lower.size(); j += 10) {
+    truth_bucket_t b = lower[j];
+    int32_t sum = 0;
+    for (size_t k = j; k < j + 10; k++) {
+      if (lower[k].min < b.min) b.min = lower[k].min;
+      if (lower[k].max > b.max) b.max = lower[k].max;
+      sum += lower[k].avg;
+    }
+    b.avg = (int16_t)(sum / 10);
+    out.push_back(b);
+  }
+  return out;
+}
+
+// Irregular readings on a frozen clock: bursts, empty buckets and one stall long
+// enough to be caught up in several chunks. Every closed bucket of every level
+// must hold exactly the min / max / avg of the readings it covers.
+static void test_buckets_match_readings(void) {
+  host_timer_freeze((int64_t)TRUTH_START_MS * 1000);
+  TEST_ASSERT_TRUE(history_init(SCALES, CHANNELS, HISTORY_DEFAULT_BUDGET));
+  std::vector<truth_sample_t> samples[CHANNELS];
+  uint32_t seed = 0x1234567u, t = TRUTH_START_MS, end = TRUTH_START_MS + TRUTH_SECONDS * 1000;
+  auto rnd = [&] { seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5; return seed; };
+  bool stalled = false;
+  while (true) {
+    uint32_t r = rnd() % 100;
+    uint32_t dt = r < 90 ? 1 + rnd() % 30 : r < 99 ? 150 + rnd() % 300 : 0;
+    if (!dt && !stalled) { dt = 7300; stalled = true; }   // 73 buckets, seven chunks
+    if (t + dt >= end) break;
+    t += dt;
+    host_timer_advance((int64_t)dt * 1000);
+    int ch = rnd() % CHANNELS;
+    float v = ((int32_t)(rnd() % 20001) - 10000) / SCALES[ch] * 0.3f;
+    history_sample(ch, v);
+    samples[ch].push_back({ t, truth_fixed(v, SCALES[ch]) });
+    if (rnd() % 8 == 0) history_tick(now_ms());
+  }
+  TEST_ASSERT_TRUE(stalled);
+  host_timer_advance((int64_t)(end - t) * 1000);
+  history_tick(now_ms());   // Closes everything before `end`
+
+  const uint32_t k0 = TRUTH_START_MS / 100, k1 = end / 100;
+  for (int ch = 0; ch < CHANNELS; ch++) {
+    std::vector<truth_bucket_t> want[HISTORY_LEVELS];
+    want[HISTORY_100MS] = truth_100ms(samples[ch], k0, k1);
+    want[HISTORY_1S] = truth_fold(want[HISTORY_100MS]);
+    want[HISTORY_10S] = truth_fold(want[HISTORY_1S]);
+    float inv = 1.0f / SCALES[ch];
+    for (int l = HISTORY_100MS; l < HISTORY_LEVELS; l++) {
+      static history_point_t got[TRUTH_SECONDS * 10];
+      int n = history_query(ch, (history_level_t)l, TRUTH_START_MS, end - 1, got, TRUTH_SECONDS * 10);
+      TEST_ASSERT_EQUAL_INT((int)want[l].size(), n);
+      uint32_t ms = history_bucket_ms((history_level_t)l);
+      for (int i = 0; i < n; i++) {
+        const truth_bucket_t &b = want[l][i];
+        char msg[128];
+        snprintf(msg, sizeof(msg), "ch %d level %d bucket %d: %g/%g/%g, want %g/%g/%g", ch, l, i,
+                 got[i].min, got[i].max, got[i].avg, b.min * inv, b.max * inv, b.avg * inv);
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(TRUTH_START_MS + i * ms, got[i].t_ms, msg);
+        TEST_ASSERT_TRUE_MESSAGE(got[i].min == b.min * inv, msg);
+        TEST_ASSERT_TRUE_MESSAGE(got[i].max == b.max * inv, msg);
+        TEST_ASSERT_TRUE_MESSAGE(got[i].avg == b.avg * inv, msg);
+      }
+    }
+  }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_replay_two_hours);
+  RUN_TEST(test_query_points);
+  RUN_TEST(test_append_cost);
+  RUN_TEST(test_query_cost);
+  RUN_TEST(test_buckets_match_readings);
+  return UNITY_END();
+}
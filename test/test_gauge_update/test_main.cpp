@@ -0,0 +1,204 @@
+// The per-frame gauge arithmetic of Gauge_Update.h, the code update_gauge<M>()
+// in src/main.cpp runs: instantiated with a constexpr descriptor (one function
+// per mode, as the firmware does) against the same code fed GAUGES[mode] at
+// run time (the table-driven path it replaced). Both must produce identical
+// frames; then both are timed, median of interleaved runs.
+// Run with `pio test -e native -f test_gauge_update -v` to see the report.
+#include <unity.h>
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include "Gauge_Update.h"
+
+#define FRAMES       200000
+#define BENCH_RUNS   21
+#define FRAME_MS     33
+#define CHECK_FRAMES 50000
+#define PEAK_HOLD_MS 30000
+
+static float channel[GAUGE_COUNT];   // Latest reading per mode
+static int current_mode = 0;
+
+// What one frame hands to the UI
+typedef struct {
+  int32_t fixed;
+  float position, peak;
+  int zone;
+} frame_out_t;
+static volatile frame_out_t sink;
+
+static inline void emit(const GaugeDesc &G, const gauge_state_t *s) {
+  sink.fixed = gauge_fixed(G, s->displayed);
+  sink.position = gauge_position(G, s->displayed);
+  sink.peak = s->peak;
+  sink.zone = s->zone;
+}
+
+// --- Runtime: the descriptor is looked up per frame ---
+static gauge_state_t runtime_state = { 0, 0, -999, 0, 0, 1 };
+
+__attribute__((noinline)) static void runtime_update(unsigned long now_ms) {
+  const GaugeDesc &G = GAUGES[current_mode];
+  gauge_step(G, &runtime_state, channel[current_mode], now_ms, true, PEAK_HOLD_MS);
+  emit(G, &runtime_state);
+}
+
+// --- Templated: one instantiation per mode, picked through a table ---
+static gauge_state_t templated_state = { 0, 0, -999, 0, 0, 1 };
+
+template <int M> static void update_gauge(unsigned long now_ms) {
+  constexpr const GaugeDesc &G = GAUGES[M];
+  gauge_step(G, &templated_state, channel[M], now_ms, true, PEAK_HOLD_MS);
+  emit(G, &templated_state);
+}
+
+typedef void (*gauge_update_fn)(unsigned long now_ms);
+static const gauge_update_fn GAUGE_UPDATE[4] = {
+  update_gauge<0>, update_gauge<1>, update_gauge<2>, update_gauge<3>,
+};
+static_assert(GAUGE_COUNT == 4, "One instantiation per descriptor");
+
+__attribute__((noinline)) static void templated_update(unsigned long now_ms) {
+  GAUGE_UPDATE[current_mode](now_ms);
+}
+
+// --- Inputs ---
+
+static uint32_t rng_state;
+static uint32_t rng() {
+  rng_state ^= rng_state << 13;
+  rng_state ^= rng_state >> 17;
+  rng_state ^= rng_state << 5;
+  return rng_state;
+}
+
+// A new reading every fourth frame (the needle is mostly easing toward it),
+// sometimes past either end of the dial, and now and then another mode
+static void next_input(uint32_t frame) {
+  if (frame % 4) return;
+  for (int m = 0; m < GAUGE_COUNT; m++) {
+    float r = (rng() & 0xFFFF) / 65535.0f * 1.2f - 0.1f;
+    channel[m] = GAUGES[m].min + (GAUGES[m].max - GAUGES[m].min) * r;
+  }
+  if (frame % 600 == 0) current_mode = rng() & 3;
+}
+
+static void reset() {
+  rng_state = 0x9E3779B9u;
+  current_mode = 0;
+  runtime_state = templated_state = { 0, 0, -999, 0, 0, 1 };
+}
+
+static frame_out_t read_sink() {
+  frame_out_t o;
+  o.fixed = sink.fixed; o.position = sink.position; o.peak = sink.peak; o.zone = sink.zone;
+  return o;
+}
+
+static bool same_state(const gauge_state_t *a, const gauge_state_t *b) {
+  return a->target == b->target && a->displayed == b->displayed && a->peak == b->peak &&
+         a->peak_timer == b->peak_timer && a->last_update_ms == b->last_update_ms && a->zone == b->zone;
+}
+
+// Constant descriptors change how the numbers are reached, never the numbers
+static void test_same_frames(void) {
+  reset();
+  for (uint32_t f = 0; f < CHECK_FRAMES; f++) {
+    next_input(f);
+    unsigned long now = 1000 + f * FRAME_MS + (rng() % 5);
+    runtime_update(now);
+    frame_out_t a = read_sink();
+    templated_update(now);
+    frame_out_t b = read_sink();
+
+    char msg[96];
+    snprintf(msg, sizeof(msg), "frame %u mode %d: %.7f vs %.7f", (unsigned)f, current_mode,
+             runtime_state.displayed, templated_state.displayed);
+    TEST_ASSERT_TRUE_MESSAGE(same_state(&runtime_state, &templated_state), msg);
+    TEST_ASSERT_EQUAL_INT32_MESSAGE(a.fixed, b.fixed, msg);
+    TEST_ASSERT_TRUE_MESSAGE(memcmp(&a.position, &b.position, sizeof(float)) == 0, msg);
+    TEST_ASSERT_TRUE_MESSAGE(memcmp(&a.peak, &b.peak, sizeof(float)) == 0, msg);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(a.zone, b.zone, msg);
+  }
+}
+
+// Thresholds 10 / 15 with 0.2 hysteresis, as the AFR gauge
+static void test_zone_single_steps(void) {
+  TEST_ASSERT_EQUAL_INT(0, zone_with_hysteresis(10.1f, 10, 15, 0.2f, 0));   // Inside the band: hold
+  TEST_ASSERT_EQUAL_INT(1, zone_with_hysteresis(10.3f, 10, 15, 0.2f, 0));
+  TEST_ASSERT_EQUAL_INT(1, zone_with_hysteresis(9.9f, 10, 15, 0.2f, 1));
+  TEST_ASSERT_EQUAL_INT(0, zone_with_hysteresis(9.7f, 10, 15, 0.2f, 1));
+  TEST_ASSERT_EQUAL_INT(1, zone_with_hysteresis(15.1f, 10, 15, 0.2f, 1));
+  TEST_ASSERT_EQUAL_INT(2, zone_with_hysteresis(15.3f, 10, 15, 0.2f, 1));
+  TEST_ASSERT_EQUAL_INT(2, zone_with_hysteresis(14.9f, 10, 15, 0.2f, 2));
+  TEST_ASSERT_EQUAL_INT(1, zone_with_hysteresis(14.7f, 10, 15, 0.2f, 2));
+}
+
+// A jump across both thresholds uses each one's own band
+static void test_zone_jumps(void) {
+  TEST_ASSERT_EQUAL_INT(0, zone_with_hysteresis(9.7f, 10, 15, 0.2f, 2));
+  TEST_ASSERT_EQUAL_INT(1, zone_with_hysteresis(9.9f, 10, 15, 0.2f, 2));    // Past t_high only
+  TEST_ASSERT_EQUAL_INT(1, zone_with_hysteresis(14.7f, 10, 15, 0.2f, 2));
+  TEST_ASSERT_EQUAL_INT(2, zone_with_hysteresis(15.3f, 10, 15, 0.2f, 0));
+  TEST_ASSERT_EQUAL_INT(1, zone_with_hysteresis(15.1f, 10, 15, 0.2f, 0));   // Past t_low only
+  TEST_ASSERT_EQUAL_INT(1, zone_with_hysteresis(10.3f, 10, 15, 0.2f, 0));
+  // Without hysteresis the zone is the plain classification
+  for (float v = 5; v < 20; v += 0.25f) {
+    int raw = v < 10 ? 0 : v < 15 ? 1 : 2;
+    for (int prev = 0; prev < 3; prev++) TEST_ASSERT_EQUAL_INT(raw, zone_with_hysteresis(v, 10, 15, 0, prev));
+  }
+}
+
+template <typename F> static double run_ns(F update) {
+  reset();
+  auto t0 = std::chrono::steady_clock::now();
+  for (uint32_t f = 0; f < FRAMES; f++) {
+    next_input(f);
+    update(1000 + f * FRAME_MS);
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(t1 - t0).count() / FRAMES;
+}
+
+static double median(double *v, int n) {
+  std::sort(v, v + n);
+  return v[n / 2];
+}
+
+// Interleaved, so clock and cache drift hit both paths alike. The input
+// generator is timed alone and subtracted.
+static void test_timing(void) {
+  double input[BENCH_RUNS], runtime[BENCH_RUNS], templated[BENCH_RUNS], ratio[BENCH_RUNS];
+  for (int r = 0; r < BENCH_RUNS; r++) {
+    input[r] = run_ns([](unsigned long) {});
+    if (r & 1) {
+      templated[r] = run_ns(templated_update);
+      runtime[r] = run_ns(runtime_update);
+    } else {
+      runtime[r] = run_ns(runtime_update);
+      templated[r] = run_ns(templated_update);
+    }
+    runtime[r] -= input[r];
+    templated[r] -= input[r];
+    ratio[r] = runtime[r] / templated[r];
+  }
+  double rt = median(runtime, BENCH_RUNS), tp = median(templated, BENCH_RUNS);
+  double mid = median(ratio, BENCH_RUNS);
+  printf("\nper frame, median of %d   ns\n", BENCH_RUNS);
+  printf("  runtime descriptor   %6.2f\n", rt);
+  printf("  templated            %6.2f\n", tp);
+  printf("  speedup %.2fx (runs %.2fx .. %.2fx)\n", mid, ratio[0], ratio[BENCH_RUNS - 1]);
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_zone_single_steps);
+  RUN_TEST(test_zone_jumps);
+  RUN_TEST(test_same_frames);
+  RUN_TEST(test_timing);
+  return UNITY_END();
+}
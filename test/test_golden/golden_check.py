@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+"""Diff a board's /golden frames against the references in ref/.
+
+  python3 test/test_golden/golden_check.py 192.168.4.1            # exit 1 on regression
+  python3 test/test_golden/golden_check.py 192.168.4.1 --record   # refresh ref/
+
+Thresholds mirror GOLDEN_TOLERANCE / GOLDEN_MAX_DIFF_PPM in src/main.cpp and the
+diff mirrors fb_snapshot_diff(), so a board and the host harness agree.
+No references are committed yet: record them with --record (or GOLDEN_RECORD=1
+on the host harness) before this can catch a regression.
+"""
+import argparse
+import os
+import struct
+import sys
+import urllib.error
+import urllib.request
+
+GOLDEN_TOLERANCE = 8
+GOLDEN_MAX_DIFF_PPM = 500
+HEADER_SIZE = 66
+W = H = 480
+REF_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "ref")
+
+
+def fetch(host, case):
+    url = "http://%s/golden?case=%d" % (host, case)
+    try:
+        with urllib.request.urlopen(url, timeout=30) as r:
+            return r.read()
+    except urllib.error.HTTPError as e:
+        if e.code == 400:
+            return None  # Past the last case
+        raise
+
+
+def pixels(bmp):
+    if len(bmp) != HEADER_SIZE + W * H * 2 or bmp[:2] != b"BM":
+        raise ValueError("not a %dx%d RGB565 snapshot" % (W, H))
+    return struct.unpack("<%dH" % (W * H), bmp[HEADER_SIZE:])
+
+
+def diff(a, b):
+    diff_px = max_delta = 0
+    for pa, pb in zip(a, b):
+        if pa == pb:
+            continue
+        d = max(abs(((pa >> 11) << 3) - ((pb >> 11) << 3)),
+                abs((((pa >> 5) & 0x3F) << 2) - (((pb >> 5) & 0x3F) << 2)),
+                abs(((pa & 0x1F) << 3) - ((pb & 0x1F) << 3)))
+        max_delta = max(max_delta, d)
+        if d > GOLDEN_TOLERANCE:
+            diff_px += 1
+    return diff_px, diff_px * 1000000 // (W * H), max_delta
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("host", help="gauge address, e.g. 192.168.4.1")
+    ap.add_argument("--record", action="store_true", help="store the frames as the new references")
+    args = ap.parse_args()
+
+    failed = missing = 0
+    case = 0
+    while True:
+        bmp = fetch(args.host, case)
+        if bmp is None:
+            break
+        path = os.path.join(REF_DIR, "case_%d.bmp" % case)
+        if args.record:
+            os.makedirs(REF_DIR, exist_ok=True)
+            with open(path, "wb") as f:
+                f.write(bmp)
+            print("case %d: recorded" % case)
+        elif not os.path.exists(path):
+            print("case %d: no reference" % case)
+            missing += 1
+        else:
+            with open(path, "rb") as f:
+                diff_px, ppm, max_delta = diff(pixels(f.read()), pixels(bmp))
+            ok = ppm <= GOLDEN_MAX_DIFF_PPM
+            failed += not ok
+            print("case %d: %s diff_px=%d ppm=%d max_delta=%d" %
+                  (case, "PASS" if ok else "FAIL", diff_px, ppm, max_delta))
+        case += 1
+
+    if case == 0:
+        print("no golden cases served")
+        return 1
+    if missing:
+        print("%d reference(s) missing, run with --record" % missing)
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
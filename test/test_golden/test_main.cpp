@@ -0,0 +1,85 @@
+// Golden frames on the host: each /golden case is rendered by the firmware on
+// the memory display and diffed by the firmware's own golden_compare()
+// (GOLDEN_TOLERANCE / GOLDEN_MAX_DIFF_PPM) against ref/case_N.bmp.
+//   pio test -e native_lvgl -f test_golden -v
+// Record or refresh the references after an intended visual change with
+//   GOLDEN_RECORD=1 pio test -e native_lvgl -f test_golden
+// golden_check.py runs the same comparison against a board's /golden.
+// No references are committed yet (the harness has not been run against a real
+// LVGL build), so until they are recorded this only checks that every case
+// renders a full frame and the comparison is reported as ignored.
+#include <unity.h>
+#include <Arduino.h>
+#include <WebServer.h>
+#include <string>
+#include <sys/stat.h>
+#include "Frame_Snapshot.h"
+
+#define GOLDEN_MAX_CASES 16
+
+void setup();
+extern WebServer server;
+extern uint16_t *golden_ref[];
+
+static std::string ref_path(int i) {
+  return std::string(GOLDEN_REF_DIR) + "/case_" + std::to_string(i) + ".bmp";
+}
+
+static bool load_ref(int i, uint16_t *dst) {
+  FILE *f = fopen(ref_path(i).c_str(), "rb");
+  if (!f) return false;
+  bool ok = fseek(f, FB_BMP_HEADER_SIZE, SEEK_SET) == 0 &&
+            fread(dst, sizeof(uint16_t), FB_SNAP_PIXELS, f) == FB_SNAP_PIXELS;
+  fclose(f);
+  return ok;
+}
+
+static void save_ref(int i, const std::string &bmp) {
+  mkdir(GOLDEN_REF_DIR, 0755);
+  FILE *f = fopen(ref_path(i).c_str(), "wb");
+  TEST_ASSERT_NOT_NULL_MESSAGE(f, ref_path(i).c_str());
+  fwrite(bmp.data(), 1, bmp.size(), f);
+  fclose(f);
+}
+
+static int case_count = 0;
+
+static void test_golden_cases(void) {
+  bool record = getenv("GOLDEN_RECORD") != NULL;
+  int missing = 0, failed = 0;
+  for (int i = 0; i < GOLDEN_MAX_CASES; i++) {
+    std::string q = "/golden?case=" + std::to_string(i);
+    const WebServer::Response &r = server.host_request(q.c_str());
+    if (r.code == 400) break;   // Past the last case
+    TEST_ASSERT_EQUAL_INT_MESSAGE(200, r.code, q.c_str());
+    TEST_ASSERT_EQUAL_UINT32(FB_BMP_HEADER_SIZE + FB_SNAP_PIXELS * sizeof(uint16_t), r.body.size());
+    case_count++;
+    if (record) { save_ref(i, r.body); continue; }
+
+    if (!golden_ref[i]) golden_ref[i] = fb_snapshot_alloc();
+    TEST_ASSERT_NOT_NULL(golden_ref[i]);
+    if (!load_ref(i, golden_ref[i])) {
+      printf("case %d: no reference at %s\n", i, ref_path(i).c_str());
+      missing++;
+      continue;
+    }
+    q += "&cmp=1";
+    std::string line = server.host_request(q.c_str()).body;
+    printf("%s", line.c_str());
+    if (line.find(": PASS") == std::string::npos) failed++;
+  }
+  TEST_ASSERT_TRUE(case_count > 0);
+  TEST_ASSERT_EQUAL_INT_MESSAGE(0, failed, "golden frames differ from the references");
+  if (record) printf("Recorded %d references in %s\n", case_count, GOLDEN_REF_DIR);
+  else if (missing) TEST_IGNORE_MESSAGE("References missing, record them with GOLDEN_RECORD=1");
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+int main(int argc, char **argv) {
+  setup();
+  UNITY_BEGIN();
+  RUN_TEST(test_golden_cases);
+  return UNITY_END();
+}
@@ -0,0 +1,185 @@
+// Needle_Rotate, the rotation behind the Needle_Sprites atlas: a synthetic
+// anti-aliased arrow is turned to steps across the gauge sweep and every screen
+// pixel of each sprite is checked against a double-precision reference
+// rotation, with nothing left outside the cropped box. The coverage centroid
+// must land where the rotated artwork's does, which a mirrored or wrongly
+// signed rotation would not. Last, the host time for the whole atlas.
+// Run with `pio test -e native -f test_needle_rotate -v` to see the report.
+#include <unity.h>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Needle_Rotate.h"
+
+#define ART_W       120
+#define ART_H       17
+#define PIVOT_X     0
+#define PIVOT_Y     (ART_H / 2)
+#define CENTER      240          // Pivot on the middle of the 480x480 panel
+#define SCREEN      480
+#define SWEEP_START 135.0f       // GAUGES[0]: SSW clockwise through North to SSE
+#define SWEEP_RANGE 270.0f
+#define STEPS       1024         // NEEDLE_LUT_STEPS
+#define CHECK_EVERY 31           // Checked steps, plus both ends and the right angles
+#define SUPERSAMPLE 4
+
+static uint8_t art[ART_W * ART_H];
+static uint8_t screen[SCREEN * SCREEN];
+
+// --- Artwork ---
+
+// Shaft then arrow head along +x, both tapering; true if (x, y) in pivot space is inside
+static bool in_arrow(double x, double y) {
+  double cy = PIVOT_Y + 0.5;
+  if (x < 2 || x > ART_W - 2) return false;
+  if (x < 90) return fabs(y - cy) < 2.5 - x * 0.01;
+  return fabs(y - cy) < (ART_W - 2 - x) * 0.25;
+}
+
+static void make_art() {
+  for (int y = 0; y < ART_H; y++)
+    for (int x = 0; x < ART_W; x++) {
+      int n = 0;
+      for (int sy = 0; sy < SUPERSAMPLE; sy++)
+        for (int sx = 0; sx < SUPERSAMPLE; sx++)
+          n += in_arrow(x + (sx + 0.5) / SUPERSAMPLE, y + (sy + 0.5) / SUPERSAMPLE);
+      art[y * ART_W + x] = (uint8_t)(n * 255 / (SUPERSAMPLE * SUPERSAMPLE));
+    }
+}
+
+// --- Reference: the same inverse mapping in double precision ---
+
+static double ref_sample(double x, double y) {
+  int x0 = (int)floor(x), y0 = (int)floor(y);
+  double fx = x - x0, fy = y - y0, p[4];
+  for (int i = 0; i < 4; i++) {
+    int sx = x0 + (i & 1), sy = y0 + (i >> 1);
+    p[i] = (sx >= 0 && sy >= 0 && sx < ART_W && sy < ART_H) ? art[sy * ART_W + sx] : 0;
+  }
+  double top = p[0] + (p[1] - p[0]) * fx, bot = p[2] + (p[3] - p[2]) * fx;
+  return top + (bot - top) * fy;
+}
+
+static double ref_pixel(double angle_deg, int sx, int sy) {
+  double a = angle_deg * M_PI / 180.0, c = cos(a), s = sin(a);
+  double dx = sx + 0.5 - CENTER, dy = sy + 0.5 - CENTER;
+  double u = dx * c + dy * s, v = -dx * s + dy * c;
+  return ref_sample(PIVOT_X + u - 0.5, PIVOT_Y + v - 0.5);
+}
+
+// --- Checks ---
+
+// The sprite pasted onto an empty panel, as the recoloured A8 blit covers it
+static void paste(const needle_rot_t *rot) {
+  memset(screen, 0, sizeof(screen));
+  for (int y = 0; y < rot->h; y++)
+    for (int x = 0; x < rot->w; x++) {
+      int X = rot->x + x, Y = rot->y + y;
+      TEST_ASSERT_TRUE(X >= 0 && Y >= 0 && X < SCREEN && Y < SCREEN);
+      screen[Y * SCREEN + X] = rot->px[y * rot->stride + x];
+    }
+}
+
+static void centroid(const uint8_t *px, int w, int h, double ox, double oy, double *mx, double *my, double *mass) {
+  double sx = 0, sy = 0, m = 0;
+  for (int y = 0; y < h; y++)
+    for (int x = 0; x < w; x++) {
+      double c = px[y * w + x];
+      sx += c * (x + 0.5 - ox);
+      sy += c * (y + 0.5 - oy);
+      m += c;
+    }
+  *mx = sx / m; *my = sy / m; *mass = m;
+}
+
+static void check_angle(const needle_art_t *a, uint8_t *scratch, float angle_deg) {
+  needle_rot_t rot;
+  needle_rotate(a, angle_deg, CENTER, CENTER, scratch, &rot);
+  paste(&rot);
+
+  // Every panel pixel, so coverage cropped off the box shows up as a miss
+  int worst = 0, wx = 0, wy = 0;
+  for (int y = 0; y < SCREEN; y++)
+    for (int x = 0; x < SCREEN; x++) {
+      int want = (int)floor(ref_pixel(angle_deg, x, y) + 0.5);
+      int d = abs(screen[y * SCREEN + x] - want);
+      if (d > worst) { worst = d; wx = x; wy = y; }
+    }
+  char msg[128];
+  snprintf(msg, sizeof(msg), "%.3f deg: pixel (%d, %d) off by %d, sprite %dx%d at (%d, %d)", angle_deg, wx, wy,
+           worst, rot.w, rot.h, rot.x, rot.y);
+  TEST_ASSERT_TRUE_MESSAGE(worst <= 1, msg);
+
+  // The artwork's centroid about the pivot, turned by the angle, is where the sprite's must be
+  double au, av, am, mx, my, mm;
+  centroid(art, ART_W, ART_H, PIVOT_X, PIVOT_Y, &au, &av, &am);
+  centroid(screen, SCREEN, SCREEN, CENTER, CENTER, &mx, &my, &mm);
+  double r = angle_deg * M_PI / 180.0;
+  double ex = au * cos(r) - av * sin(r), ey = au * sin(r) + av * cos(r);
+  snprintf(msg, sizeof(msg), "%.3f deg: centroid (%.2f, %.2f), want (%.2f, %.2f), mass %.0f of %.0f", angle_deg,
+           mx, my, ex, ey, mm, am);
+  TEST_ASSERT_TRUE_MESSAGE(fabs(mx - ex) < 0.5 && fabs(my - ey) < 0.5, msg);
+  TEST_ASSERT_TRUE_MESSAGE(fabs(mm - am) < am * 0.02, msg);
+}
+
+static needle_art_t needle;
+static uint8_t *scratch;
+
+static void test_art_crop(void) {
+  make_art();
+  TEST_ASSERT_TRUE(needle_art_init(&needle, art, ART_W, ART_H, PIVOT_X, PIVOT_Y));
+  TEST_ASSERT_EQUAL_INT(2, needle.x1);
+  TEST_ASSERT_EQUAL_INT(ART_W - 3, needle.x2);
+  TEST_ASSERT_TRUE(needle.y1 > 0 && needle.y2 < ART_H - 1);
+  scratch = (uint8_t *)malloc(needle_rotate_scratch_size(&needle));
+  TEST_ASSERT_NOT_NULL(scratch);
+
+  static uint8_t empty[ART_W * ART_H];
+  needle_art_t none;
+  TEST_ASSERT_FALSE(needle_art_init(&none, empty, ART_W, ART_H, PIVOT_X, PIVOT_Y));
+}
+
+// Unturned, every destination pixel centre lands on an artwork pixel centre
+static void test_zero_is_a_copy(void) {
+  needle_rot_t rot;
+  needle_rotate(&needle, 0, CENTER, CENTER, scratch, &rot);
+  paste(&rot);
+  for (int y = 0; y < ART_H; y++)
+    TEST_ASSERT_EQUAL_MEMORY(&art[y * ART_W], &screen[(CENTER - PIVOT_Y + y) * SCREEN + CENTER - PIVOT_X], ART_W);
+  TEST_ASSERT_EQUAL_INT(CENTER - PIVOT_X + needle.x1, rot.x);
+  TEST_ASSERT_EQUAL_INT(needle.x2 - needle.x1 + 1, rot.w);
+}
+
+static void test_sweep_matches_reference(void) {
+  for (int i = 0; i <= STEPS; i += CHECK_EVERY) check_angle(&needle, scratch, SWEEP_START + SWEEP_RANGE * i / STEPS);
+  check_angle(&needle, scratch, SWEEP_START + SWEEP_RANGE);
+  for (int q = 0; q < 4; q++) check_angle(&needle, scratch, q * 90.0f);
+}
+
+static void test_atlas_time(void) {
+  uint32_t bytes = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i <= STEPS; i++) {
+    needle_rot_t rot;
+    needle_rotate(&needle, SWEEP_START + SWEEP_RANGE * i / STEPS, CENTER, CENTER, scratch, &rot);
+    bytes += rot.w * rot.h;
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  printf("\n%d sprites of a %dx%d needle: %u bytes, rotated in %.1f ms\n", STEPS + 1, ART_W, ART_H,
+         (unsigned)bytes, std::chrono::duration<double, std::milli>(t1 - t0).count());
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_art_crop);
+  RUN_TEST(test_zero_is_a_copy);
+  RUN_TEST(test_sweep_matches_reference);
+  RUN_TEST(test_atlas_time);
+  free(scratch);
+  return UNITY_END();
+}
@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+"""Extract the gauge glyphs from the old lv_font_conv DSEG14 fonts into dseg14_ref.h.
+
+The fonts were removed when Segment_Font replaced them; recover them from history
+and regenerate the reference with:
+
+  git show 44116e0^:src/dseg14_120.c > /tmp/dseg14_120.c
+  git show 44116e0^:src/dseg14_96.c  > /tmp/dseg14_96.c
+  python3 test/test_segment_font/extract_dseg14.py /tmp/dseg14_120.c /tmp/dseg14_96.c
+"""
+import os
+import re
+import sys
+
+GLYPHS = "0123456789-."
+
+
+def parse(path):
+    src = open(path).read()
+    size = int(re.search(r"\.line_height = (\d+)", src).group(1))
+    bpp = int(re.search(r"\.bpp = (\d+)", src).group(1))
+    body = re.search(r"glyph_bitmap\[\] = \{(.*?)\n\};", src, re.S).group(1)
+    # One comment per glyph, in glyph id order (id 0 is reserved)
+    chars = re.findall(r'/\* U\+([0-9A-F]{4}) ', body)
+    dsc = re.findall(r"\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), "
+                     r"\.box_h = (\d+), \.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}", src)[1:]
+    data = [int(v, 16) for v in re.findall(r"0x([0-9a-fA-F]+)", re.sub(r"/\*.*?\*/", "", body))]
+    glyphs = {}
+    for cp, d in zip(chars, dsc):
+        c = chr(int(cp, 16))
+        if c not in GLYPHS:
+            continue
+        idx, adv, bw, bh, ox, oy = map(int, d)
+        nbytes = (bw * bh * bpp + 7) // 8
+        glyphs[c] = (adv, bw, bh, ox, oy, data[idx:idx + nbytes])
+    return size, bpp, glyphs
+
+
+def main():
+    out = os.path.join(os.path.dirname(os.path.abspath(__file__)), "dseg14_ref.h")
+    fonts = [parse(p) for p in sys.argv[1:]]
+    with open(out, "w") as f:
+        f.write("#pragma once\n#include <stdint.h>\n\n")
+        f.write("// Gauge glyphs of the removed DSEG14 Classic Bold bitmap fonts (lv_font_conv,\n")
+        f.write("// packed bits, no row padding). Generated by extract_dseg14.py; do not edit.\n\n")
+        f.write("typedef struct {\n  char c;\n  uint16_t adv_w;        // 1/16 px\n"
+                "  uint8_t box_w, box_h;\n  int8_t ofs_x, ofs_y;   // ofs_y from the baseline (bottom)\n"
+                "  const uint8_t *bits;\n} dseg14_glyph_t;\n\n")
+        f.write("typedef struct {\n  int32_t size;          // Line height in px\n  uint8_t bpp;\n"
+                "  const dseg14_glyph_t *glyphs;\n} dseg14_font_t;\n\n")
+        for size, bpp, glyphs in fonts:
+            for i, c in enumerate(GLYPHS):
+                bits = glyphs[c][5]
+                f.write("static const uint8_t dseg14_%d_%d[] = {" % (size, i))
+                for j, b in enumerate(bits):
+                    f.write(("\n  " if j % 16 == 0 else " ") + "0x%02x," % b)
+                f.write("\n};\n")
+            f.write("\nstatic const dseg14_glyph_t dseg14_%d_glyphs[] = {\n" % size)
+            for i, c in enumerate(GLYPHS):
+                adv, bw, bh, ox, oy, _ = glyphs[c]
+                f.write("  { '%s', %d, %d, %d, %d, %d, dseg14_%d_%d },\n" % (c, adv, bw, bh, ox, oy, size, i))
+            f.write("};\n\n")
+        f.write("static const dseg14_font_t DSEG14_FONTS[] = {\n")
+        for size, bpp, _ in fonts:
+            f.write("  { %d, %d, dseg14_%d_glyphs },\n" % (size, bpp, size))
+        f.write("};\n#define DSEG14_FONT_COUNT %d\n#define DSEG14_GLYPH_COUNT %d\n" % (len(fonts), len(GLYPHS)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,134 @@
+// Segment_Font against the DSEG14 bitmap fonts it replaced (dseg14_120 / dseg14_96):
+// per-glyph pixel diff of the coverage and host rasterisation time of both paths.
+// Run with `pio test -e native -f test_segment_font -v` to see the report.
+#include <unity.h>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Segment_Font.h"
+#include "dseg14_ref.h"
+
+#define BENCH_REPS 200
+#define IOU_SLACK  0.02
+
+// Ink IoU against the bitmap glyphs at the time the fonts were removed, in
+// DSEG14_FONTS order. The '0' is lowest because DSEG14 Classic slashes it;
+// elsewhere the difference is outline shape (pointed ends, gaps, bar widths).
+static const double BASELINE_IOU[DSEG14_FONT_COUNT][DSEG14_GLYPH_COUNT] = {
+  //  0      1      2      3      4      5      6      7      8      9      -      .
+  { 0.720, 0.720, 0.817, 0.793, 0.764, 0.814, 0.818, 0.782, 0.804, 0.799, 0.791, 0.794 },  // 120 px
+  { 0.792, 0.742, 0.887, 0.814, 0.886, 0.887, 0.888, 0.889, 0.888, 0.888, 0.840, 0.789 },  //  96 px
+};
+
+// Glyph cell as the old Digit_Cache laid it out: advance wide, line height tall,
+// the '.' (zero advance, overhanging the previous cell) in a cell of its own
+static int32_t ref_cell_width(const dseg14_glyph_t *g) {
+  if (g->adv_w == 0) return g->box_w;
+  return (g->adv_w + 8) >> 4;
+}
+
+// Expand the packed 1 bpp glyph into an A8 cell (what the label path drew)
+static void ref_render(const dseg14_glyph_t *g, int32_t size, uint8_t *a8, int32_t w) {
+  memset(a8, 0, w * size);
+  int32_t x0 = g->adv_w == 0 ? 0 : g->ofs_x;
+  int32_t y0 = size - g->ofs_y - g->box_h;
+  uint32_t bit = 0;
+  for (int32_t y = 0; y < g->box_h; y++) {
+    for (int32_t x = 0; x < g->box_w; x++, bit++) {
+      if (!(g->bits[bit >> 3] & (0x80 >> (bit & 7)))) continue;
+      int32_t px = x0 + x, py = y0 + y;
+      if (px >= 0 && px < w && py >= 0 && py < size) a8[py * w + px] = 255;
+    }
+  }
+}
+
+typedef struct {
+  double iou;          // Ink (coverage >= 128) intersection over union
+  double mean_diff;    // Mean |coverage difference|, 0..255
+  double diff_pct;     // Pixels whose ink state differs, % of the cell
+} glyph_diff_t;
+
+// Compare over the wider of the two cells, both left-aligned as tiles are
+static glyph_diff_t diff_cells(const uint8_t *a, int32_t aw, const uint8_t *b, int32_t bw, int32_t h) {
+  int32_t w = aw > bw ? aw : bw;
+  long inter = 0, uni = 0, differ = 0;
+  double sum = 0;
+  for (int32_t y = 0; y < h; y++) {
+    for (int32_t x = 0; x < w; x++) {
+      int va = x < aw ? a[y * aw + x] : 0;
+      int vb = x < bw ? b[y * bw + x] : 0;
+      bool ia = va >= 128, ib = vb >= 128;
+      inter += ia && ib;
+      uni += ia || ib;
+      differ += ia != ib;
+      sum += abs(va - vb);
+    }
+  }
+  glyph_diff_t d;
+  d.iou = uni ? (double)inter / uni : 1.0;
+  d.mean_diff = sum / (w * h);
+  d.diff_pct = 100.0 * differ / (w * h);
+  return d;
+}
+
+template <typename F> static double time_us(F fn) {
+  auto t0 = std::chrono::steady_clock::now();
+  for (int r = 0; r < BENCH_REPS; r++) fn();
+  auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(t1 - t0).count() / BENCH_REPS;
+}
+
+static void compare_font(int f) {
+  const dseg14_font_t *font = &DSEG14_FONTS[f];
+  int32_t h = font->size;
+  int32_t max_w = seg_font_cell_width('0', h) * 2;
+  uint8_t *ref = (uint8_t *)malloc(max_w * h);
+  uint8_t *seg = (uint8_t *)malloc(max_w * h);
+  uint16_t *acc = (uint16_t *)malloc(max_w * h * sizeof(uint16_t));
+  TEST_ASSERT_NOT_NULL(ref);
+  TEST_ASSERT_NOT_NULL(seg);
+  TEST_ASSERT_NOT_NULL(acc);
+
+  printf("\n%d px    ref w  seg w     IoU  mean|d|  differ%%  bitmap us  segment us\n", (int)h);
+  double ref_total = 0, seg_total = 0;
+  for (int i = 0; i < DSEG14_GLYPH_COUNT; i++) {
+    const dseg14_glyph_t *g = &font->glyphs[i];
+    int32_t rw = ref_cell_width(g);
+    int32_t sw = seg_font_cell_width(g->c, h);
+    TEST_ASSERT_TRUE(rw <= max_w && sw <= max_w);
+
+    double ref_us = time_us([&] { ref_render(g, h, ref, rw); });
+    double seg_us = time_us([&] { seg_font_render(g->c, seg, acc, sw, h); });
+    ref_total += ref_us;
+    seg_total += seg_us;
+
+    glyph_diff_t d = diff_cells(ref, rw, seg, sw, h);
+    printf("  '%c'     %5d  %5d  %6.3f  %7.1f  %7.2f  %9.2f  %10.2f\n",
+           g->c, (int)rw, (int)sw, d.iou, d.mean_diff, d.diff_pct, ref_us, seg_us);
+
+    // A missing, extra or misplaced segment drops the IoU by far more than the slack
+    char msg[48];
+    snprintf(msg, sizeof(msg), "%d px glyph '%c'", (int)h, g->c);
+    TEST_ASSERT_TRUE_MESSAGE(d.iou >= BASELINE_IOU[f][i] - IOU_SLACK, msg);
+    TEST_ASSERT_INT_WITHIN_MESSAGE(h / 10, rw, sw, msg);
+  }
+  printf("  avg                                               %9.2f  %10.2f\n",
+         ref_total / DSEG14_GLYPH_COUNT, seg_total / DSEG14_GLYPH_COUNT);
+  free(ref);
+  free(seg);
+  free(acc);
+}
+
+static void test_matches_dseg14_120(void) { compare_font(0); }
+static void test_matches_dseg14_96(void) { compare_font(1); }
+
+void setUp(void) {}
+void tearDown(void) {}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_matches_dseg14_120);
+  RUN_TEST(test_matches_dseg14_96);
+  return UNITY_END();
+}
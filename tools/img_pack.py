@@ -0,0 +1,205 @@
+#!/usr/bin/env python3
+"""Convert an LVGL C image array (RGB565 / RGB565A8) into a compressed
+img_pack_t asset for lib/Image_Cache.
+
+    python tools/img_pack.py src/images/gauge_bg.c -o src/images/gauge_bg.c
+
+Both RLE (16-bit units) and LZ4 (single block) are tried and the smaller one
+is written, unless --method is given. The output declares
+`const img_pack_t <name>_pack`.
+"""
+import argparse
+import os
+import re
+import sys
+
+CF_NAMES = {"RGB565": "LV_COLOR_FORMAT_RGB565", "RGB565A8": "LV_COLOR_FORMAT_RGB565A8"}
+
+
+def parse_lvgl_c(text):
+    name = re.search(r"uint8_t\s+(\w+)_map\[\]", text).group(1)
+    body = text[text.index(name + "_map[]"):]
+    body = body[body.index("{") + 1:body.index("};")]
+    data = bytes(int(x, 16) for x in re.findall(r"0x([0-9a-fA-F]{2})", body))
+    dsc = text[text.index("_dsc_t " + name):]
+    w = int(re.search(r"\.w\s*=\s*(\d+)", dsc).group(1))
+    h = int(re.search(r"\.h\s*=\s*(\d+)", dsc).group(1))
+    cf = re.search(r"LV_COLOR_FORMAT_(\w+)", dsc).group(1)
+    if cf not in CF_NAMES:
+        sys.exit("unsupported colour format " + cf)
+    return name, w, h, cf, data
+
+
+def rle_encode(data):
+    units = [data[i:i + 2] for i in range(0, len(data), 2)]
+    out = bytearray()
+    i, n = 0, len(units)
+    while i < n:
+        run = 1
+        while i + run < n and run < 128 and units[i + run] == units[i]:
+            run += 1
+        if run > 1:
+            out.append(0x80 | (run - 1))
+            out += units[i]
+            i += run
+            continue
+        lit = 1
+        while i + lit < n and lit < 128 and (i + lit + 1 >= n or units[i + lit] != units[i + lit + 1]):
+            lit += 1
+        out.append(lit - 1)
+        for u in units[i:i + lit]:
+            out += u
+        i += lit
+    return bytes(out)
+
+
+def rle_decode(packed, size):
+    out = bytearray()
+    i = 0
+    while i < len(packed):
+        ctrl = packed[i]
+        count = (ctrl & 0x7F) + 1
+        if ctrl & 0x80:
+            out += packed[i + 1:i + 3] * count
+            i += 3
+        else:
+            out += packed[i + 1:i + 1 + count * 2]
+            i += 1 + count * 2
+    assert len(out) == size
+    return bytes(out)
+
+
+def lz4_put_len(out, n):
+    while n >= 255:
+        out.append(255)
+        n -= 255
+    out.append(n)
+
+
+def lz4_encode(data, window=65535, chain=32):
+    # Greedy hash-chain matcher; the last 5 bytes are always literals (LZ4 block rules)
+    n = len(data)
+    out = bytearray()
+    head, prev = {}, [0] * n
+    anchor = i = 0
+    limit = n - 12
+    while i < limit:
+        key = data[i:i + 4]
+        best_len = best_off = 0
+        cand = head.get(key, -1)
+        tries = chain
+        while cand >= 0 and i - cand <= window and tries:
+            l = 4
+            while i + l < n - 5 and data[cand + l] == data[i + l]:
+                l += 1
+            if data[cand:cand + 4] == key and l > best_len:
+                best_len, best_off = l, i - cand
+            cand = prev[cand]
+            tries -= 1
+        prev[i] = head.get(key, -1)
+        head[key] = i
+        if best_len < 4:
+            i += 1
+            continue
+        lit = i - anchor
+        out.append((min(lit, 15) << 4) | min(best_len - 4, 15))
+        if lit >= 15:
+            lz4_put_len(out, lit - 15)
+        out += data[anchor:i]
+        out += bytes((best_off & 0xFF, best_off >> 8))
+        if best_len - 4 >= 15:
+            lz4_put_len(out, best_len - 19)
+        for j in range(i + 1, min(i + best_len, limit)):
+            k = data[j:j + 4]
+            prev[j] = head.get(k, -1)
+            head[k] = j
+        i += best_len
+        anchor = i
+    lit = n - anchor
+    out.append(min(lit, 15) << 4)
+    if lit >= 15:
+        lz4_put_len(out, lit - 15)
+    out += data[anchor:]
+    return bytes(out)
+
+
+def lz4_decode(packed, size):
+    out = bytearray()
+    i = 0
+    while i < len(packed):
+        token = packed[i]
+        i += 1
+        lit = token >> 4
+        if lit == 15:
+            while True:
+                b = packed[i]
+                i += 1
+                lit += b
+                if b != 255:
+                    break
+        out += packed[i:i + lit]
+        i += lit
+        if i >= len(packed):
+            break
+        off = packed[i] | (packed[i + 1] << 8)
+        i += 2
+        ml = token & 15
+        if ml == 15:
+            while True:
+                b = packed[i]
+                i += 1
+                ml += b
+                if b != 255:
+                    break
+        for _ in range(ml + 4):
+            out.append(out[-off])
+    assert len(out) == size
+    return bytes(out)
+
+
+def write_c(path, name, w, h, cf, method, raw_size, packed):
+    guard = "LV_ATTRIBUTE_IMAGE_" + name.upper()
+    with open(path, "w") as f:
+        f.write('#include "Image_Cache.h"\n\n')
+        f.write("// %dx%d %s, %s packed: %d -> %d bytes (tools/img_pack.py)\n\n"
+                % (w, h, cf, method, raw_size, len(packed)))
+        f.write("#ifndef LV_ATTRIBUTE_MEM_ALIGN\n#define LV_ATTRIBUTE_MEM_ALIGN\n#endif\n\n")
+        f.write("#ifndef %s\n#define %s\n#endif\n\n" % (guard, guard))
+        f.write("const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST %s uint8_t %s_pack_map[] = {\n"
+                % (guard, name))
+        for i in range(0, len(packed), 32):
+            f.write("  " + ", ".join("0x%02x" % b for b in packed[i:i + 32]) + ",\n")
+        f.write("};\n\n")
+        f.write("const img_pack_t %s_pack = {\n" % name)
+        f.write("  %d, %d, %s, IMG_PACK_%s,\n" % (w, h, CF_NAMES[cf], method))
+        f.write("  %d, sizeof(%s_pack_map),\n" % (raw_size, name))
+        f.write("  %s_pack_map,\n};\n" % name)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("input")
+    ap.add_argument("-o", "--output", required=True)
+    ap.add_argument("--method", choices=["RLE", "LZ4"])
+    args = ap.parse_args()
+
+    name, w, h, cf, data = parse_lvgl_c(open(args.input).read())
+    raw_size = w * h * (3 if cf == "RGB565A8" else 2)
+    if len(data) < raw_size:
+        sys.exit("%s: %d bytes of data, expected %d" % (name, len(data), raw_size))
+    data = data[:raw_size]
+
+    candidates = {}
+    if args.method in (None, "RLE") and raw_size % 2 == 0:
+        candidates["RLE"] = rle_encode(data)
+        assert rle_decode(candidates["RLE"], raw_size) == data
+    if args.method in (None, "LZ4"):
+        candidates["LZ4"] = lz4_encode(data)
+        assert lz4_decode(candidates["LZ4"], raw_size) == data
+    method = min(candidates, key=lambda m: len(candidates[m]))
+    write_c(args.output, name, w, h, cf, method, raw_size, candidates[method])
+    print("%s: %d -> %d bytes (%s)" % (name, raw_size, len(candidates[method]), method))
+
+
+if __name__ == "__main__":
+    main()
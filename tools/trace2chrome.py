@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+"""Convert a /trace dump from lib/Event_Trace into Chrome trace JSON, for
+chrome://tracing or https://ui.perfetto.dev.
+
+    curl -o trace.bin "http://<gauge-ip>/trace"
+    python tools/trace2chrome.py trace.bin -o trace.json
+
+One lane per FreeRTOS task holding the explicit slices, instants, counters
+and flow arrows; every event also records the core it ran on.
+"""
+import argparse
+import json
+import struct
+import sys
+
+HEADER = struct.Struct("<4sHHBBBB")
+CORE = struct.Struct("<IIq")
+EVENT = struct.Struct("<IHBBI")
+BEGIN, END, COMPLETE, INSTANT, FLOW, COUNTER = range(6)
+NO_TASK = 0xFF
+PID_TASKS = 1
+
+
+def read_strings(data, pos, count):
+    out = []
+    for _ in range(count):
+        end = data.index(b"\0", pos)
+        out.append(data[pos:end].decode("utf-8", "replace"))
+        pos = end + 1
+    return out, pos
+
+
+def parse(data):
+    magic, version, mhz, cores, n_names, n_tasks, _ = HEADER.unpack_from(data, 0)
+    if magic != b"GTRC" or version != 1:
+        sys.exit("not a version 1 GTRC trace")
+    pos = HEADER.size
+    sync = []
+    for _ in range(cores):
+        sync.append(CORE.unpack_from(data, pos))
+        pos += CORE.size
+    names, pos = read_strings(data, pos, n_names)
+    tasks, pos = read_strings(data, pos, n_tasks)
+    events = []
+    for core, (count, sync_cycles, sync_us) in enumerate(sync):
+        raw = [EVENT.unpack_from(data, pos + i * EVENT.size) for i in range(count)]
+        pos += count * EVENT.size
+        # Walk back from the sync point taking signed 32-bit steps, which
+        # unwraps the cycle counter as long as no gap exceeds 2^31 cycles
+        # (~9 s at 240 MHz; the idle loop logs far more often than that)
+        t_cyc, prev = 0, sync_cycles
+        stamped = []
+        for cycles, name, phase, task, arg in reversed(raw):
+            step = (prev - cycles) & 0xFFFFFFFF
+            if step >= 1 << 31:
+                step -= 1 << 32
+            t_cyc -= step
+            prev = cycles
+            stamped.append((sync_us + t_cyc / mhz, core, name, phase, task, arg))
+        events.extend(reversed(stamped))
+    return mhz, names, tasks, cores, events
+
+
+def convert(mhz, names, tasks, events):
+    t0 = min((e[0] for e in events), default=0)
+    name_of = lambda n: names[n] if n < len(names) else "name%d" % n
+    out = [
+        {"ph": "M", "pid": PID_TASKS, "name": "process_name", "args": {"name": "Tasks"}},
+    ]
+    for t, name in enumerate(tasks):
+        out.append({"ph": "M", "pid": PID_TASKS, "tid": t, "name": "thread_name", "args": {"name": name}})
+    out.append({"ph": "M", "pid": PID_TASKS, "tid": NO_TASK, "name": "thread_name", "args": {"name": "other"}})
+
+    flows = {}
+    for ts, core, name, phase, task, arg in sorted(events, key=lambda e: e[0]):
+        ts -= t0
+        base = {"pid": PID_TASKS, "tid": task, "ts": ts, "name": name_of(name)}
+        if phase == BEGIN:
+            out.append(dict(base, ph="B", args={"arg": arg, "core": core}))
+        elif phase == END:
+            out.append(dict(base, ph="E"))
+        elif phase == COMPLETE:
+            dur = arg / mhz
+            out.append(dict(base, ph="X", ts=ts - dur, dur=dur, args={"core": core}))
+        elif phase == INSTANT:
+            out.append(dict(base, ph="i", s="t", args={"arg": arg, "core": core}))
+        elif phase == COUNTER:
+            out.append(dict(base, ph="C", tid=0, args={base["name"]: arg}))
+        elif phase == FLOW:
+            flows.setdefault((name, arg), []).append(base)
+
+    # One arrow chain per flow id: first "s", middle "t", last "f"
+    for (name, fid), chain in flows.items():
+        if len(chain) < 2:
+            continue
+        for i, ev in enumerate(chain):
+            ph = "s" if i == 0 else "f" if i == len(chain) - 1 else "t"
+            out.append(dict(ev, ph=ph, id=fid, cat="flow", bp="e"))
+    return out
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("trace", help="binary dump from /trace")
+    ap.add_argument("-o", "--output", default="-", help="JSON output (default stdout)")
+    args = ap.parse_args()
+    with open(args.trace, "rb") as f:
+        mhz, names, tasks, _, events = parse(f.read())
+    doc = {"traceEvents": convert(mhz, names, tasks, events), "displayTimeUnit": "ns"}
+    if args.output == "-":
+        json.dump(doc, sys.stdout)
+    else:
+        with open(args.output, "w") as f:
+            json.dump(doc, f)
+        print("%d events, %d tasks -> %s" % (len(events), len(tasks), args.output), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()